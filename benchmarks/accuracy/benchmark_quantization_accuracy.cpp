@@ -0,0 +1,547 @@
+#include "../../src/core/optimization/Quantizer.h"
+#include "../../src/core/optimization/KMeansTrainer.h"
+#include "../../src/core/optimization/ProductQuantizer.h"
+#include "../../src/core/logic/FlatFormat.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Accuracy-vs-speed benchmark for every vector encoding we support.
+// Usage: benchmark_quantization_accuracy [--n N] [--dim D] [--queries Q] [--k K] [--out file.json]
+// Prints one JSON document (stdout, and to --out if given) with recall@k, QPS,
+// bytes per vector and build time for each dataset x encoding x search method.
+
+using minni::optimization::Quantizer;
+using minni::optimization::KMeansTrainer;
+using minni::optimization::ProductQuantizer;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+double elapsed_ms(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+void normalize_rows(std::vector<float>& data, size_t dim) {
+    for (size_t i = 0; i < data.size(); i += dim) {
+        float norm = 0.0f;
+        for (size_t d = 0; d < dim; ++d) norm += data[i + d] * data[i + d];
+        norm = std::sqrt(norm);
+        if (norm > 0.0f) {
+            for (size_t d = 0; d < dim; ++d) data[i + d] /= norm;
+        }
+    }
+}
+
+// ========================================================
+// Datasets (all L2-normalized, so cosine == dot product)
+// ========================================================
+
+struct Dataset {
+    std::string name;
+    size_t dim;
+    std::vector<float> base;    // n x dim
+    std::vector<float> queries; // q x dim
+};
+
+Dataset make_uniform(size_t n, size_t q, size_t dim, uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<float> dis(-1.0f, 1.0f);
+    Dataset ds{"uniform", dim, std::vector<float>(n * dim), std::vector<float>(q * dim)};
+    for (auto& x : ds.base) x = dis(gen);
+    for (auto& x : ds.queries) x = dis(gen);
+    normalize_rows(ds.base, dim);
+    normalize_rows(ds.queries, dim);
+    return ds;
+}
+
+// Gaussian mixture: dense topical clusters, like sentence embeddings
+Dataset make_clustered(size_t n, size_t q, size_t dim, uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::normal_distribution<float> dis(0.0f, 1.0f);
+    const size_t num_clusters = 64;
+    std::vector<float> centers(num_clusters * dim);
+    for (auto& x : centers) x = dis(gen);
+
+    Dataset ds{"clustered", dim, std::vector<float>(n * dim), std::vector<float>(q * dim)};
+    auto fill = [&](std::vector<float>& out, size_t rows) {
+        std::uniform_int_distribution<size_t> pick(0, num_clusters - 1);
+        for (size_t i = 0; i < rows; ++i) {
+            const float* c = centers.data() + pick(gen) * dim;
+            for (size_t d = 0; d < dim; ++d) out[i * dim + d] = c[d] + 0.35f * dis(gen);
+        }
+    };
+    fill(ds.base, n);
+    fill(ds.queries, q);
+    normalize_rows(ds.base, dim);
+    normalize_rows(ds.queries, dim);
+    return ds;
+}
+
+// Decaying per-dimension variance plus a shared offset: a few dominant directions
+// and a non-zero mean, which is where per-vector and symmetric scaling differ most.
+Dataset make_anisotropic(size_t n, size_t q, size_t dim, uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::normal_distribution<float> dis(0.0f, 1.0f);
+    std::vector<float> scale(dim), offset(dim);
+    for (size_t d = 0; d < dim; ++d) {
+        scale[d] = std::exp(-static_cast<float>(d) / (dim / 8.0f));
+        offset[d] = 0.5f * dis(gen) * scale[d];
+    }
+
+    Dataset ds{"anisotropic", dim, std::vector<float>(n * dim), std::vector<float>(q * dim)};
+    auto fill = [&](std::vector<float>& out, size_t rows) {
+        for (size_t i = 0; i < rows; ++i) {
+            for (size_t d = 0; d < dim; ++d) out[i * dim + d] = offset[d] + scale[d] * dis(gen);
+        }
+    };
+    fill(ds.base, n);
+    fill(ds.queries, q);
+    normalize_rows(ds.base, dim);
+    normalize_rows(ds.queries, dim);
+    return ds;
+}
+
+// ========================================================
+// Encodings
+// ========================================================
+
+/**
+ * A vector encoding: builds codes for the base set and scores a candidate list
+ * against a prepared query. Higher scores are better.
+ */
+class Codec {
+public:
+    virtual ~Codec() = default;
+    virtual std::string name() const = 0;
+    virtual void build(const float* data, size_t n, size_t dim) = 0;
+    virtual size_t bytes_per_vector() const = 0;
+    virtual void prepare(const float* query) = 0;
+    virtual void score(const uint32_t* ids, size_t count, float* out) const = 0;
+};
+
+class Float32Codec : public Codec {
+public:
+    std::string name() const override { return "float32"; }
+    void build(const float* data, size_t n, size_t dim) override {
+        dim_ = dim;
+        data_.assign(data, data + n * dim);
+    }
+    size_t bytes_per_vector() const override { return dim_ * sizeof(float); }
+    void prepare(const float* query) override { query_ = query; }
+    void score(const uint32_t* ids, size_t count, float* out) const override {
+        for (size_t i = 0; i < count; ++i) {
+            const float* v = data_.data() + static_cast<size_t>(ids[i]) * dim_;
+            float dot = 0.0f;
+            for (size_t d = 0; d < dim_; ++d) dot += query_[d] * v[d];
+            out[i] = dot;
+        }
+    }
+
+private:
+    size_t dim_ = 0;
+    std::vector<float> data_;
+    const float* query_ = nullptr;
+};
+
+class Float16Codec : public Codec {
+public:
+    std::string name() const override { return "fp16"; }
+    void build(const float* data, size_t n, size_t dim) override {
+        dim_ = dim;
+        data_.resize(n * dim);
+        for (size_t i = 0; i < n * dim; ++i) data_[i] = Quantizer::float_to_half(data[i]);
+    }
+    size_t bytes_per_vector() const override { return dim_ * sizeof(uint16_t); }
+    void prepare(const float* query) override { query_ = query; }
+    void score(const uint32_t* ids, size_t count, float* out) const override {
+        for (size_t i = 0; i < count; ++i) {
+            const uint16_t* v = data_.data() + static_cast<size_t>(ids[i]) * dim_;
+            float dot = 0.0f;
+            for (size_t d = 0; d < dim_; ++d) dot += query_[d] * Quantizer::half_to_float(v[d]);
+            out[i] = dot;
+        }
+    }
+
+private:
+    size_t dim_ = 0;
+    std::vector<uint16_t> data_;
+    const float* query_ = nullptr;
+};
+
+// Per-vector int8. dot(q, (c - zp) * s) = s * (dot(q, c) - zp * sum(q)).
+class Int8Codec : public Codec {
+public:
+    explicit Int8Codec(bool symmetric) : symmetric_(symmetric) {}
+    std::string name() const override { return symmetric_ ? "int8_symmetric" : "int8_asymmetric"; }
+    void build(const float* data, size_t n, size_t dim) override {
+        dim_ = dim;
+        codes_.resize(n * dim);
+        params_.resize(n);
+        for (size_t i = 0; i < n; ++i) {
+            const float* v = data + i * dim;
+            params_[i] = symmetric_ ? Quantizer::calculate_symmetric_params(v, dim)
+                                    : Quantizer::calculate_params(v, dim);
+            Quantizer::quantize(v, dim, params_[i], codes_.data() + i * dim);
+        }
+    }
+    size_t bytes_per_vector() const override {
+        // Symmetric codes only need the scale
+        return dim_ + sizeof(float) + (symmetric_ ? 0 : sizeof(int32_t));
+    }
+    void prepare(const float* query) override {
+        query_ = query;
+        query_sum_ = 0.0f;
+        for (size_t d = 0; d < dim_; ++d) query_sum_ += query[d];
+    }
+    void score(const uint32_t* ids, size_t count, float* out) const override {
+        for (size_t i = 0; i < count; ++i) {
+            const int8_t* c = codes_.data() + static_cast<size_t>(ids[i]) * dim_;
+            const auto& p = params_[ids[i]];
+            float dot = 0.0f;
+            for (size_t d = 0; d < dim_; ++d) dot += query_[d] * c[d];
+            out[i] = p.scale * (dot - p.zero_point * query_sum_);
+        }
+    }
+
+private:
+    bool symmetric_;
+    size_t dim_ = 0;
+    std::vector<int8_t> codes_;
+    std::vector<Quantizer::QuantizationParams> params_;
+    const float* query_ = nullptr;
+    float query_sum_ = 0.0f;
+};
+
+class Int4Codec : public Codec {
+public:
+    std::string name() const override { return "int4"; }
+    void build(const float* data, size_t n, size_t dim) override {
+        dim_ = dim;
+        stride_ = (dim + 1) / 2;
+        codes_.resize(n * stride_);
+        params_.resize(n);
+        for (size_t i = 0; i < n; ++i) {
+            const float* v = data + i * dim;
+            params_[i] = Quantizer::calculate_int4_params(v, dim);
+            Quantizer::quantize_int4(v, dim, params_[i], codes_.data() + i * stride_);
+        }
+    }
+    size_t bytes_per_vector() const override { return stride_ + sizeof(float) + sizeof(int32_t); }
+    void prepare(const float* query) override {
+        query_ = query;
+        query_sum_ = 0.0f;
+        for (size_t d = 0; d < dim_; ++d) query_sum_ += query[d];
+    }
+    void score(const uint32_t* ids, size_t count, float* out) const override {
+        for (size_t i = 0; i < count; ++i) {
+            const uint8_t* c = codes_.data() + static_cast<size_t>(ids[i]) * stride_;
+            const auto& p = params_[ids[i]];
+            float dot = 0.0f;
+            for (size_t d = 0; d < dim_; ++d) {
+                uint8_t nibble = (d % 2) ? (c[d / 2] >> 4) : (c[d / 2] & 0x0F);
+                int32_t q = (nibble & 0x08) ? static_cast<int32_t>(nibble) - 16 : nibble;
+                dot += query_[d] * q;
+            }
+            out[i] = p.scale * (dot - p.zero_point * query_sum_);
+        }
+    }
+
+private:
+    size_t dim_ = 0;
+    size_t stride_ = 0;
+    std::vector<uint8_t> codes_;
+    std::vector<Quantizer::QuantizationParams> params_;
+    const float* query_ = nullptr;
+    float query_sum_ = 0.0f;
+};
+
+// Sign bits, same packing and score as the tiered MFVS binary hot section
+class BinaryCodec : public Codec {
+public:
+    std::string name() const override { return "binary"; }
+    void build(const float* data, size_t n, size_t dim) override {
+        dim_ = dim;
+        words_ = minni::logic::flat::binary_code_bytes(dim) / sizeof(uint64_t);
+        codes_.assign(n * words_, 0);
+        for (size_t i = 0; i < n; ++i) encode(data + i * dim, codes_.data() + i * words_);
+        query_code_.resize(words_);
+    }
+    size_t bytes_per_vector() const override { return words_ * sizeof(uint64_t); }
+    void prepare(const float* query) override {
+        std::fill(query_code_.begin(), query_code_.end(), 0);
+        encode(query, query_code_.data());
+    }
+    void score(const uint32_t* ids, size_t count, float* out) const override {
+        for (size_t i = 0; i < count; ++i) {
+            const uint64_t* c = codes_.data() + static_cast<size_t>(ids[i]) * words_;
+            size_t ham = 0;
+            for (size_t w = 0; w < words_; ++w) ham += __builtin_popcountll(c[w] ^ query_code_[w]);
+            out[i] = 1.0f - 2.0f * static_cast<float>(ham) / dim_;
+        }
+    }
+
+private:
+    void encode(const float* v, uint64_t* out) const {
+        for (size_t d = 0; d < dim_; ++d) {
+            if (v[d] > 0.0f) out[d / 64] |= (1ULL << (d % 64));
+        }
+    }
+
+    size_t dim_ = 0;
+    size_t words_ = 0;
+    std::vector<uint64_t> codes_;
+    std::vector<uint64_t> query_code_;
+};
+
+// Asymmetric distance computation; score = -||q - x||^2 (same ranking as cosine on unit vectors)
+class PQCodec : public Codec {
+public:
+    PQCodec(size_t m, size_t k) : m_(m), k_(k) {}
+    std::string name() const override { return "pq" + std::to_string(m_) + "x" + std::to_string(k_); }
+    void build(const float* data, size_t n, size_t dim) override {
+        pq_ = ProductQuantizer(dim, m_, k_);
+        KMeansTrainer::Config config;
+        config.max_iterations = 25;
+        pq_.train(data, std::min<size_t>(n, 20000), config);
+        codes_.resize(n * pq_.code_size());
+        pq_.encode_batch(data, n, codes_.data());
+        table_.resize(m_ * k_);
+    }
+    size_t bytes_per_vector() const override { return pq_.code_size(); }
+    void prepare(const float* query) override { pq_.compute_distance_table(query, table_.data()); }
+    void score(const uint32_t* ids, size_t count, float* out) const override {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = -pq_.distance_from_table(table_.data(), codes_.data() + static_cast<size_t>(ids[i]) * m_);
+        }
+    }
+
+private:
+    size_t m_;
+    size_t k_;
+    ProductQuantizer pq_;
+    std::vector<uint8_t> codes_;
+    std::vector<float> table_;
+};
+
+// ========================================================
+// Search
+// ========================================================
+
+void top_k(const uint32_t* ids, const float* scores, size_t count, size_t k, std::vector<uint32_t>& out) {
+    std::vector<uint32_t> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    k = std::min(k, count);
+    std::partial_sort(order.begin(), order.begin() + k, order.end(),
+                      [&](uint32_t a, uint32_t b) { return scores[a] > scores[b]; });
+    out.clear();
+    for (size_t i = 0; i < k; ++i) out.push_back(ids[order[i]]);
+}
+
+/**
+ * Inverted file index over k-means cells; the codec scores the probed lists.
+ */
+struct IvfIndex {
+    size_t dim = 0;
+    size_t nprobe = 8;
+    std::vector<float> centroids;
+    std::vector<std::vector<uint32_t>> lists;
+
+    void build(const float* data, size_t n, size_t d, size_t nlist) {
+        dim = d;
+        KMeansTrainer::Config config;
+        config.num_clusters = nlist;
+        config.max_iterations = 25;
+        KMeansTrainer trainer(config);
+        trainer.train(data, n, d);
+        centroids = trainer.centroids();
+
+        std::vector<uint32_t> labels(n);
+        trainer.assign_all(data, n, labels.data());
+        lists.assign(nlist, {});
+        for (size_t i = 0; i < n; ++i) lists[labels[i]].push_back(static_cast<uint32_t>(i));
+    }
+
+    void candidates(const float* query, std::vector<uint32_t>& out) const {
+        size_t nlist = lists.size();
+        std::vector<std::pair<float, uint32_t>> dist(nlist);
+        for (size_t c = 0; c < nlist; ++c) {
+            const float* cent = centroids.data() + c * dim;
+            float dd = 0.0f;
+            for (size_t d = 0; d < dim; ++d) dd += (query[d] - cent[d]) * (query[d] - cent[d]);
+            dist[c] = {dd, static_cast<uint32_t>(c)};
+        }
+        size_t probes = std::min(nprobe, nlist);
+        std::partial_sort(dist.begin(), dist.begin() + probes, dist.end());
+        out.clear();
+        for (size_t p = 0; p < probes; ++p) {
+            const auto& list = lists[dist[p].second];
+            out.insert(out.end(), list.begin(), list.end());
+        }
+    }
+};
+
+struct Result {
+    std::string dataset;
+    std::string encoding;
+    std::string search;
+    double recall = 0.0;
+    double qps = 0.0;
+    size_t bytes_per_vector = 0;
+    double build_ms = 0.0;
+};
+
+std::vector<std::vector<uint32_t>> ground_truth(const Dataset& ds, size_t n, size_t k) {
+    Float32Codec exact;
+    exact.build(ds.base.data(), n, ds.dim);
+    std::vector<uint32_t> all(n);
+    std::iota(all.begin(), all.end(), 0);
+    std::vector<float> scores(n);
+
+    size_t q = ds.queries.size() / ds.dim;
+    std::vector<std::vector<uint32_t>> truth(q);
+    for (size_t i = 0; i < q; ++i) {
+        exact.prepare(ds.queries.data() + i * ds.dim);
+        exact.score(all.data(), n, scores.data());
+        top_k(all.data(), scores.data(), n, k, truth[i]);
+    }
+    return truth;
+}
+
+Result evaluate(const Dataset& ds, size_t n, Codec& codec, double build_ms, const IvfIndex* ivf,
+                const std::vector<std::vector<uint32_t>>& truth, size_t k) {
+    const size_t q = ds.queries.size() / ds.dim;
+    std::vector<uint32_t> all(n);
+    std::iota(all.begin(), all.end(), 0);
+    std::vector<uint32_t> cand;
+    std::vector<float> scores(n);
+    std::vector<uint32_t> found;
+    size_t hits = 0;
+
+    auto start = Clock::now();
+    for (size_t i = 0; i < q; ++i) {
+        const float* query = ds.queries.data() + i * ds.dim;
+        const uint32_t* ids = all.data();
+        size_t count = n;
+        if (ivf) {
+            ivf->candidates(query, cand);
+            ids = cand.data();
+            count = cand.size();
+        }
+        codec.prepare(query);
+        codec.score(ids, count, scores.data());
+        top_k(ids, scores.data(), count, k, found);
+
+        for (uint32_t id : found) {
+            if (std::find(truth[i].begin(), truth[i].end(), id) != truth[i].end()) hits++;
+        }
+    }
+    double search_ms = elapsed_ms(start);
+
+    Result r;
+    r.dataset = ds.name;
+    r.encoding = codec.name();
+    r.search = ivf ? "ivf" : "brute_force";
+    r.recall = static_cast<double>(hits) / (q * k);
+    r.qps = search_ms > 0.0 ? q * 1000.0 / search_ms : 0.0;
+    r.bytes_per_vector = codec.bytes_per_vector();
+    r.build_ms = build_ms;
+    return r;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = 20000;
+    size_t dim = 128;
+    size_t num_queries = 200;
+    size_t k = 10;
+    std::string out_path;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        if (arg == "--n") n = std::strtoul(argv[i + 1], nullptr, 10);
+        else if (arg == "--dim") dim = std::strtoul(argv[i + 1], nullptr, 10);
+        else if (arg == "--queries") num_queries = std::strtoul(argv[i + 1], nullptr, 10);
+        else if (arg == "--k") k = std::strtoul(argv[i + 1], nullptr, 10);
+        else if (arg == "--out") out_path = argv[i + 1];
+    }
+
+    const size_t nlist = std::max<size_t>(16, static_cast<size_t>(std::sqrt(static_cast<double>(n))));
+    const size_t pq_m = (dim % 16 == 0) ? 16 : dim;
+
+    std::vector<Dataset> datasets;
+    datasets.push_back(make_uniform(n, num_queries, dim, 1));
+    datasets.push_back(make_clustered(n, num_queries, dim, 2));
+    datasets.push_back(make_anisotropic(n, num_queries, dim, 3));
+
+    std::vector<Result> results;
+    for (const auto& ds : datasets) {
+        std::cerr << "Dataset: " << ds.name << std::endl;
+        auto truth = ground_truth(ds, n, k);
+
+        auto start = Clock::now();
+        IvfIndex ivf;
+        ivf.build(ds.base.data(), n, dim, nlist);
+        double ivf_ms = elapsed_ms(start);
+
+        std::vector<std::unique_ptr<Codec>> codecs;
+        codecs.emplace_back(new Float32Codec());
+        codecs.emplace_back(new Float16Codec());
+        codecs.emplace_back(new Int8Codec(false));
+        codecs.emplace_back(new Int8Codec(true));
+        codecs.emplace_back(new Int4Codec());
+        codecs.emplace_back(new BinaryCodec());
+        codecs.emplace_back(new PQCodec(pq_m, 256));
+
+        for (auto& codec : codecs) {
+            start = Clock::now();
+            codec->build(ds.base.data(), n, dim);
+            double build_ms = elapsed_ms(start);
+
+            results.push_back(evaluate(ds, n, *codec, build_ms, nullptr, truth, k));
+            results.push_back(evaluate(ds, n, *codec, build_ms + ivf_ms, &ivf, truth, k));
+            std::cerr << "  " << codec->name() << ": recall@" << k << " "
+                      << results[results.size() - 2].recall << " (brute force), "
+                      << results.back().recall << " (ivf)" << std::endl;
+        }
+    }
+
+    std::ostringstream json;
+    json << "{\n";
+    json << "  \"benchmark\": \"quantization_accuracy\",\n";
+    json << "  \"config\": {\"n\": " << n << ", \"dim\": " << dim << ", \"queries\": " << num_queries
+         << ", \"k\": " << k << ", \"ivf_nlist\": " << nlist << ", \"ivf_nprobe\": " << IvfIndex().nprobe
+         << "},\n";
+    json << "  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        json << "    {\"dataset\": \"" << r.dataset << "\", \"encoding\": \"" << r.encoding
+             << "\", \"search\": \"" << r.search << "\", \"recall_at_k\": " << r.recall
+             << ", \"qps\": " << r.qps << ", \"bytes_per_vector\": " << r.bytes_per_vector
+             << ", \"build_ms\": " << r.build_ms << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    json << "  ]\n}\n";
+
+    std::cout << json.str();
+    if (!out_path.empty()) {
+        std::ofstream out(out_path);
+        out << json.str();
+        if (!out) {
+            std::cerr << "ERROR: could not write " << out_path << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,523 @@
+#include "../../src/core/logic/SatSolver.h"
+#include "../../src/core/logic/DimacsReader.h"
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// SAT solver benchmark over standard CNF families and DIMACS files.
+// Usage: benchmark_sat_solver [--families random,pigeonhole,coloring,parity|none]
+//                             [--dimacs DIR] [--modes dpll,cdcl,portfolio] [--threads N]
+//                             [--timeout MS] [--seed S] [--out file.json]
+// Each instance x mode runs in a forked child, so peak memory is that run's alone and
+// a run that ignores its timeout can be killed. Prints one JSON document (stdout, and
+// to --out if given) with solve time, conflicts/sec and peak RSS per run, plus a
+// per-mode summary. Exits 1 if a model is wrong or two modes disagree.
+
+using minni::logic::DimacsReader;
+using minni::logic::Lit;
+using minni::logic::lit_negated;
+using minni::logic::lit_var;
+using minni::logic::make_lit;
+using minni::logic::SatSolver;
+using minni::logic::SolverStatus;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+double elapsed_ms(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+std::vector<std::string> split(const std::string& list) {
+    std::vector<std::string> items;
+    std::stringstream in(list);
+    std::string item;
+    while (std::getline(in, item, ',')) {
+        if (!item.empty()) items.push_back(item);
+    }
+    return items;
+}
+
+bool contains(const std::vector<std::string>& items, const std::string& item) {
+    return std::find(items.begin(), items.end(), item) != items.end();
+}
+
+// ========================================================
+// Instances
+// ========================================================
+
+using Cnf = std::vector<std::vector<Lit>>;
+
+struct Instance {
+    std::string family;
+    std::string name;
+    uint32_t vars = 0;
+    Cnf clauses;             // Generated instances
+    std::string path;        // DIMACS files (clauses stay on disk)
+    size_t num_clauses = 0;
+    std::string expected;    // "sat", "unsat" or "unknown"
+};
+
+Instance make_instance(const std::string& family, const std::string& name, uint32_t vars, Cnf clauses,
+                       const std::string& expected) {
+    Instance inst;
+    inst.family = family;
+    inst.name = name;
+    inst.vars = vars;
+    inst.num_clauses = clauses.size();
+    inst.clauses = std::move(clauses);
+    inst.expected = expected;
+    return inst;
+}
+
+// Uniform random 3-SAT at clause/variable ratio 4.26, where about half the instances
+// are satisfiable and they are hardest
+Instance random_3sat(uint32_t vars, uint32_t seed) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<uint32_t> pick(0, vars - 1);
+    const size_t count = static_cast<size_t>(vars * 4.26 + 0.5);
+    Cnf cnf;
+    while (cnf.size() < count) {
+        uint32_t v[3] = {pick(gen), pick(gen), pick(gen)};
+        if (v[0] == v[1] || v[0] == v[2] || v[1] == v[2]) continue;
+        std::vector<Lit> c;
+        for (uint32_t x : v) c.push_back(make_lit(x, (gen() & 1) != 0));
+        cnf.push_back(c);
+    }
+    return make_instance("random", "uf" + std::to_string(vars) + "-s" + std::to_string(seed), vars,
+                         std::move(cnf), "unknown");
+}
+
+// holes + 1 pigeons into holes: UNSAT and exponential for resolution
+Instance pigeonhole(uint32_t holes) {
+    const uint32_t pigeons = holes + 1;
+    auto var = [holes](uint32_t p, uint32_t h) { return p * holes + h; };
+    Cnf cnf;
+    for (uint32_t p = 0; p < pigeons; ++p) {
+        std::vector<Lit> c;
+        for (uint32_t h = 0; h < holes; ++h) c.push_back(make_lit(var(p, h)));
+        cnf.push_back(c);
+    }
+    for (uint32_t h = 0; h < holes; ++h) {
+        for (uint32_t p = 0; p < pigeons; ++p) {
+            for (uint32_t q = p + 1; q < pigeons; ++q) {
+                cnf.push_back({make_lit(var(p, h), true), make_lit(var(q, h), true)});
+            }
+        }
+    }
+    return make_instance("pigeonhole", "php" + std::to_string(pigeons) + "-" + std::to_string(holes),
+                         pigeons * holes, std::move(cnf), "unsat");
+}
+
+// 3-coloring of a "flat" graph: a hidden coloring splits the vertices into three
+// equal classes and edges only join different classes, at average degree 4.6 where
+// these are hardest. Every vertex gets exactly one color, neighbours differ.
+Instance coloring(uint32_t vertices, uint32_t seed) {
+    const uint32_t colors = 3;
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<uint32_t> pick(0, vertices - 1);
+    const size_t num_edges = static_cast<size_t>(vertices * 2.3);
+    std::vector<std::pair<uint32_t, uint32_t>> edges;
+    while (edges.size() < num_edges) {
+        uint32_t a = pick(gen), b = pick(gen);
+        if (a % colors == b % colors) continue;   // Hidden color of v is v % colors
+        if (a > b) std::swap(a, b);
+        if (std::find(edges.begin(), edges.end(), std::make_pair(a, b)) != edges.end()) continue;
+        edges.emplace_back(a, b);
+    }
+
+    auto var = [colors](uint32_t v, uint32_t c) { return v * colors + c; };
+    Cnf cnf;
+    for (uint32_t v = 0; v < vertices; ++v) {
+        std::vector<Lit> some;
+        for (uint32_t c = 0; c < colors; ++c) some.push_back(make_lit(var(v, c)));
+        cnf.push_back(some);
+        for (uint32_t c = 0; c < colors; ++c) {
+            for (uint32_t d = c + 1; d < colors; ++d) cnf.push_back({make_lit(var(v, c), true), make_lit(var(v, d), true)});
+        }
+    }
+    for (const auto& e : edges) {
+        for (uint32_t c = 0; c < colors; ++c) {
+            cnf.push_back({make_lit(var(e.first, c), true), make_lit(var(e.second, c), true)});
+        }
+    }
+    return make_instance("coloring", "flat" + std::to_string(vertices) + "-s" + std::to_string(seed),
+                         vertices * colors, std::move(cnf), "sat");
+}
+
+// Parity: the XOR of n bits computed by two Tseitin chains that visit the bits in
+// different orders, with the two results required to differ. UNSAT, and hard for
+// solvers that do not reason about XOR.
+Instance parity(uint32_t bits, uint32_t seed) {
+    std::vector<uint32_t> order(bits);
+    for (uint32_t i = 0; i < bits; ++i) order[i] = i;
+    std::mt19937 gen(seed);
+    std::shuffle(order.begin(), order.end(), gen);
+
+    uint32_t next_var = bits;
+    Cnf cnf;
+    // t = a xor b
+    auto xor_gate = [&cnf](uint32_t t, uint32_t a, uint32_t b) {
+        cnf.push_back({make_lit(t, true), make_lit(a), make_lit(b)});
+        cnf.push_back({make_lit(t, true), make_lit(a, true), make_lit(b, true)});
+        cnf.push_back({make_lit(t), make_lit(a, true), make_lit(b)});
+        cnf.push_back({make_lit(t), make_lit(a), make_lit(b, true)});
+    };
+    auto chain = [&](const std::vector<uint32_t>& vars) {
+        uint32_t acc = vars[0];
+        for (uint32_t i = 1; i < vars.size(); ++i) {
+            const uint32_t t = next_var++;
+            xor_gate(t, acc, vars[i]);
+            acc = t;
+        }
+        return acc;
+    };
+    std::vector<uint32_t> identity(bits);
+    for (uint32_t i = 0; i < bits; ++i) identity[i] = i;
+    const uint32_t first = chain(identity);
+    const uint32_t second = chain(order);
+    cnf.push_back({make_lit(first), make_lit(second)});
+    cnf.push_back({make_lit(first, true), make_lit(second, true)});
+    return make_instance("parity", "par" + std::to_string(bits) + "-s" + std::to_string(seed), next_var,
+                         std::move(cnf), "unsat");
+}
+
+bool dimacs_instance(const std::string& path, Instance& inst) {
+    size_t count = 0;
+    DimacsReader reader([&count](const Lit*, size_t) { ++count; });
+    if (!reader.read_file(path)) return false;
+    inst.family = "dimacs";
+    inst.name = std::filesystem::path(path).filename().string();
+    inst.path = path;
+    inst.vars = reader.num_vars();
+    inst.num_clauses = count;
+    inst.expected = "unknown";
+    return true;
+}
+
+std::string to_dimacs(const Instance& inst) {
+    std::string text = "p cnf " + std::to_string(inst.vars) + " " + std::to_string(inst.clauses.size()) + "\n";
+    for (const auto& c : inst.clauses) {
+        for (Lit l : c) {
+            if (lit_negated(l)) text += '-';
+            text += std::to_string(lit_var(l) + 1);
+            text += ' ';
+        }
+        text += "0\n";
+    }
+    return text;
+}
+
+// ========================================================
+// Runs
+// ========================================================
+
+struct Result {
+    std::string family;
+    std::string instance;
+    std::string mode;
+    std::string status = "error";
+    double time_ms = 0.0;         // check() wall time, parsing included
+    double parse_ms = 0.0;
+    double preprocess_ms = 0.0;
+    double solve_ms = 0.0;
+    uint64_t conflicts = 0;
+    uint64_t decisions = 0;
+    uint64_t propagations = 0;
+    double conflicts_per_sec = 0.0;
+    long peak_rss_kb = 0;
+    bool model_ok = true;
+};
+
+const char* status_name(SolverStatus status) {
+    switch (status) {
+        case SolverStatus::SATISFIABLE: return "sat";
+        case SolverStatus::UNSATISFIABLE: return "unsat";
+        case SolverStatus::TIMEOUT: return "timeout";
+        default: return "unknown";
+    }
+}
+
+bool model_satisfies(std::unordered_map<std::string, std::string>& model, const Instance& inst) {
+    auto holds = [&model](const Lit* lits, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            const bool value = model[std::to_string(lit_var(lits[i]) + 1)] == "true";
+            if (value != lit_negated(lits[i])) return true;
+        }
+        return false;
+    };
+    if (inst.path.empty()) {
+        for (const auto& c : inst.clauses) {
+            if (!holds(c.data(), c.size())) return false;
+        }
+        return true;
+    }
+    bool ok = true;
+    DimacsReader reader([&](const Lit* lits, size_t size) { ok = ok && holds(lits, size); });
+    return reader.read_file(inst.path) && ok;
+}
+
+// Child side: solve once and write the measurements as one line
+void run_child(const Instance& inst, const std::string& text, const std::string& mode, size_t threads,
+               uint64_t timeout_ms, int fd) {
+    SatSolver solver;
+    solver.set_param("mode", mode == "dpll" ? "dpll" : "cdcl");
+    solver.set_param("threads", mode == "portfolio" ? std::to_string(threads) : "1");
+    solver.set_param("timeout", std::to_string(timeout_ms));
+
+    const Clock::time_point start = Clock::now();
+    const SolverStatus status = inst.path.empty() ? solver.check(text) : solver.check_dimacs_file(inst.path);
+    const double time_ms = elapsed_ms(start);
+
+    auto stats = solver.get_stats();
+    bool model_ok = true;
+    if (status == SolverStatus::SATISFIABLE) {
+        auto model = solver.get_model();
+        model_ok = model_satisfies(model, inst);
+    }
+    std::ostringstream line;
+    line << status_name(status) << ' ' << time_ms << ' ' << stats["parse_ms"] << ' ' << stats["preprocess_ms"]
+         << ' ' << stats["solve_ms"] << ' ' << stats["conflicts"] << ' ' << stats["decisions"] << ' '
+         << stats["propagations"] << ' ' << stats["conflicts_per_sec"] << ' ' << (model_ok ? 1 : 0) << '\n';
+    const std::string out = line.str();
+    if (write(fd, out.data(), out.size()) != static_cast<ssize_t>(out.size())) _exit(2);
+}
+
+Result run(const Instance& inst, const std::string& text, const std::string& mode, size_t threads,
+           uint64_t timeout_ms) {
+    Result r;
+    r.family = inst.family;
+    r.instance = inst.name;
+    r.mode = mode;
+
+    int fds[2];
+    if (pipe(fds) != 0) return r;
+    std::cout.flush();
+    std::cerr.flush();
+    const pid_t pid = fork();
+    if (pid < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        return r;
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        run_child(inst, text, mode, threads, timeout_ms, fds[1]);
+        _exit(0);
+    }
+    close(fds[1]);
+
+    // A run gets twice its timeout (plus a second for parsing) before it is killed
+    const Clock::time_point start = Clock::now();
+    const double kill_ms = 2.0 * timeout_ms + 1000.0;
+    int wstatus = 0;
+    struct rusage usage;
+    bool killed = false;
+    for (;;) {
+        const pid_t done = wait4(pid, &wstatus, WNOHANG, &usage);
+        if (done == pid) break;
+        if (done < 0) return r;
+        if (!killed && elapsed_ms(start) > kill_ms) {
+            kill(pid, SIGKILL);
+            killed = true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    r.peak_rss_kb = usage.ru_maxrss;   // Kilobytes on Linux
+
+    std::string line;
+    char buffer[512];
+    ssize_t n;
+    while ((n = read(fds[0], buffer, sizeof(buffer))) > 0) line.append(buffer, n);
+    close(fds[0]);
+    if (killed) {
+        r.status = "killed";
+        r.time_ms = elapsed_ms(start);
+        return r;
+    }
+    std::istringstream in(line);
+    int model_ok = 1;
+    if (!(in >> r.status >> r.time_ms >> r.parse_ms >> r.preprocess_ms >> r.solve_ms >> r.conflicts >>
+          r.decisions >> r.propagations >> r.conflicts_per_sec >> model_ok)) {
+        r.status = "error";
+    }
+    r.model_ok = model_ok != 0;
+    return r;
+}
+
+// Peak RSS of a child that does nothing: the harness share of every peak_rss_kb
+long baseline_rss_kb() {
+    const pid_t pid = fork();
+    if (pid == 0) _exit(0);
+    int wstatus = 0;
+    struct rusage usage;
+    if (pid < 0 || wait4(pid, &wstatus, 0, &usage) != pid) return 0;
+    return usage.ru_maxrss;
+}
+
+std::string json_string(const std::string& s) {
+    std::string out = "\"";
+    for (char c : s) {
+        if (c == '"' || c == '\\') out += '\\';
+        if (static_cast<unsigned char>(c) >= 0x20) out += c;
+    }
+    return out + "\"";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string families_arg = "random,pigeonhole,coloring,parity";
+    std::string modes_arg = "dpll,cdcl,portfolio";
+    std::string dimacs_dir;
+    std::string out_path;
+    size_t threads = std::max(2u, std::thread::hardware_concurrency());
+    uint64_t timeout_ms = 5000;
+    uint32_t seed = 1;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        if (arg == "--families") families_arg = argv[i + 1];
+        else if (arg == "--modes") modes_arg = argv[i + 1];
+        else if (arg == "--dimacs") dimacs_dir = argv[i + 1];
+        else if (arg == "--threads") threads = std::strtoul(argv[i + 1], nullptr, 10);
+        else if (arg == "--timeout") timeout_ms = std::strtoull(argv[i + 1], nullptr, 10);
+        else if (arg == "--seed") seed = static_cast<uint32_t>(std::strtoul(argv[i + 1], nullptr, 10));
+        else if (arg == "--out") out_path = argv[i + 1];
+    }
+    const std::vector<std::string> families = split(families_arg);
+    const std::vector<std::string> modes = split(modes_arg);
+
+    std::vector<Instance> instances;
+    if (contains(families, "random")) {
+        for (uint32_t vars : {50u, 100u, 150u, 200u}) {
+            for (uint32_t s = seed; s < seed + 2; ++s) instances.push_back(random_3sat(vars, s));
+        }
+    }
+    if (contains(families, "pigeonhole")) {
+        for (uint32_t holes : {6u, 7u, 8u, 9u}) instances.push_back(pigeonhole(holes));
+    }
+    if (contains(families, "coloring")) {
+        for (uint32_t vertices : {100u, 200u, 400u, 600u}) instances.push_back(coloring(vertices, seed));
+    }
+    if (contains(families, "parity")) {
+        for (uint32_t bits : {16u, 20u, 24u, 28u}) instances.push_back(parity(bits, seed));
+    }
+    if (!dimacs_dir.empty()) {
+        std::vector<std::string> paths;
+        std::error_code error;
+        for (const auto& entry : std::filesystem::directory_iterator(dimacs_dir, error)) {
+            const std::string ext = entry.path().extension().string();
+            if (entry.is_regular_file() && (ext == ".cnf" || ext == ".dimacs")) paths.push_back(entry.path().string());
+        }
+        if (error) {
+            std::cerr << "ERROR: cannot list " << dimacs_dir << ": " << error.message() << std::endl;
+            return 1;
+        }
+        std::sort(paths.begin(), paths.end());
+        for (const auto& path : paths) {
+            Instance inst;
+            if (dimacs_instance(path, inst)) {
+                instances.push_back(std::move(inst));
+            } else {
+                std::cerr << "Skipping unreadable DIMACS file " << path << std::endl;
+            }
+        }
+    }
+
+    const long baseline_kb = baseline_rss_kb();
+    std::vector<Result> results;
+    bool consistent = true;
+    for (const auto& inst : instances) {
+        const std::string text = inst.path.empty() ? to_dimacs(inst) : std::string();
+        std::cerr << inst.family << "/" << inst.name << " (" << inst.vars << " vars, " << inst.num_clauses
+                  << " clauses):";
+        std::string answer = inst.expected;
+        for (const auto& mode : modes) {
+            Result r = run(inst, text, mode, threads, timeout_ms);
+            std::cerr << " " << mode << " " << r.status << " " << static_cast<long>(r.time_ms) << " ms";
+            if (r.status == "sat" || r.status == "unsat") {
+                if (answer != "unknown" && answer != r.status) {
+                    std::cerr << " [DISAGREES: expected " << answer << "]";
+                    consistent = false;
+                }
+                answer = r.status;
+            }
+            if (!r.model_ok) {
+                std::cerr << " [WRONG MODEL]";
+                consistent = false;
+            }
+            results.push_back(r);
+        }
+        std::cerr << std::endl;
+    }
+
+    std::ostringstream json;
+    json << "{\n";
+    json << "  \"benchmark\": \"sat_solver\",\n";
+    json << "  \"config\": {\"modes\": " << json_string(modes_arg) << ", \"threads\": " << threads
+         << ", \"timeout_ms\": " << timeout_ms << ", \"seed\": " << seed << ", \"baseline_rss_kb\": " << baseline_kb
+         << "},\n";
+    json << "  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        json << "    {\"family\": " << json_string(r.family) << ", \"instance\": " << json_string(r.instance)
+             << ", \"mode\": " << json_string(r.mode) << ", \"status\": " << json_string(r.status)
+             << ", \"time_ms\": " << r.time_ms << ", \"parse_ms\": " << r.parse_ms
+             << ", \"preprocess_ms\": " << r.preprocess_ms << ", \"solve_ms\": " << r.solve_ms
+             << ", \"conflicts\": " << r.conflicts << ", \"decisions\": " << r.decisions
+             << ", \"propagations\": " << r.propagations << ", \"conflicts_per_sec\": " << r.conflicts_per_sec
+             << ", \"peak_rss_kb\": " << r.peak_rss_kb << ", \"model_ok\": " << (r.model_ok ? "true" : "false")
+             << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    json << "  ],\n";
+
+    // Per mode: solved count and PAR-2 (unsolved runs count as twice the timeout)
+    json << "  \"summary\": [\n";
+    for (size_t m = 0; m < modes.size(); ++m) {
+        size_t solved = 0;
+        double solved_ms = 0.0, par2_ms = 0.0;
+        for (const auto& r : results) {
+            if (r.mode != modes[m]) continue;
+            if (r.status == "sat" || r.status == "unsat") {
+                ++solved;
+                solved_ms += r.time_ms;
+                par2_ms += r.time_ms;
+            } else {
+                par2_ms += 2.0 * timeout_ms;
+            }
+        }
+        json << "    {\"mode\": " << json_string(modes[m]) << ", \"instances\": " << instances.size()
+             << ", \"solved\": " << solved << ", \"solved_time_ms\": " << solved_ms << ", \"par2_ms\": " << par2_ms
+             << "}" << (m + 1 < modes.size() ? "," : "") << "\n";
+    }
+    json << "  ],\n";
+    json << "  \"consistent\": " << (consistent ? "true" : "false") << "\n";
+    json << "}\n";
+
+    std::cout << json.str();
+    if (!out_path.empty()) {
+        std::ofstream out(out_path);
+        out << json.str();
+        if (!out) {
+            std::cerr << "ERROR: could not write " << out_path << std::endl;
+            return 1;
+        }
+    }
+    return consistent ? 0 : 1;
+}
@@ -13,6 +13,9 @@ g++ -std=c++17 -O3 -Isrc/core \
     benchmarks/memory/benchmark_quantization.cpp \
     src/core/logic/VectorStore.cpp \
     src/core/signal/DSPKernel.cpp \
+    src/core/signal/VectorMath.cpp \
+    src/core/signal/FFTPlan.cpp \
+    src/core/signal/PartitionedConvolver.cpp \
     src/core/optimization/Quantizer.cpp \
     -o benchmarks/bin/benchmark_quantization
 
@@ -33,6 +36,9 @@ g++ -std=c++17 -O3 -Isrc/core \
     benchmarks/memory/benchmark_kg.cpp \
     src/core/logic/KnowledgeGraph.cpp \
     src/core/signal/DSPKernel.cpp \
+    src/core/signal/VectorMath.cpp \
+    src/core/signal/FFTPlan.cpp \
+    src/core/signal/PartitionedConvolver.cpp \
     src/core/optimization/Quantizer.cpp \
     -o benchmarks/bin/benchmark_kg
 
@@ -55,6 +61,9 @@ g++ -std=c++17 -O3 -Isrc/core \
     src/core/logic/FlatVectorStore.cpp \
     src/core/platform/MemoryMapper.cpp \
     src/core/signal/DSPKernel.cpp \
+    src/core/signal/VectorMath.cpp \
+    src/core/signal/FFTPlan.cpp \
+    src/core/signal/PartitionedConvolver.cpp \
     src/core/optimization/Quantizer.cpp \
     -o benchmarks/bin/benchmark_flat_vs
 
@@ -65,3 +74,53 @@ else
     echo "ERROR: Compilation failed for FlatVectorStore Benchmark."
     exit 1
 fi
+
+echo ""
+echo "========================================"
+echo "Compiling Quantization Accuracy Benchmark..."
+echo "========================================"
+
+g++ -std=c++17 -O3 -pthread -Isrc/core \
+    benchmarks/accuracy/benchmark_quantization_accuracy.cpp \
+    src/core/signal/DSPKernel.cpp \
+    src/core/signal/VectorMath.cpp \
+    src/core/signal/FFTPlan.cpp \
+    src/core/signal/PartitionedConvolver.cpp \
+    src/core/optimization/Quantizer.cpp \
+    src/core/optimization/KMeansTrainer.cpp \
+    src/core/optimization/ProductQuantizer.cpp \
+    -o benchmarks/bin/benchmark_quantization_accuracy
+
+if [ $? -eq 0 ]; then
+    echo "Compilation success. Running benchmark..."
+    ./benchmarks/bin/benchmark_quantization_accuracy --out benchmarks/bin/quantization_accuracy.json
+else
+    echo "ERROR: Compilation failed for Quantization Accuracy Benchmark."
+    exit 1
+fi
+
+echo ""
+echo "========================================"
+echo "Compiling SAT Solver Benchmark..."
+echo "========================================"
+
+g++ -std=c++17 -O3 -pthread -Isrc/core \
+    benchmarks/latency/benchmark_sat_solver.cpp \
+    src/core/logic/SatSolver.cpp \
+    src/core/logic/PbEncoder.cpp \
+    src/core/logic/CdclSolver.cpp \
+    src/core/logic/ClauseArena.cpp \
+    src/core/logic/DratWriter.cpp \
+    src/core/logic/DimacsReader.cpp \
+    src/core/logic/PortfolioSolver.cpp \
+    src/core/logic/ClauseExchange.cpp \
+    src/core/logic/Preprocessor.cpp \
+    -o benchmarks/bin/benchmark_sat_solver
+
+if [ $? -eq 0 ]; then
+    echo "Compilation success. Running benchmark..."
+    ./benchmarks/bin/benchmark_sat_solver --out benchmarks/bin/sat_solver.json
+else
+    echo "ERROR: Compilation failed for SAT Solver Benchmark."
+    exit 1
+fi
@@ -0,0 +1,67 @@
+package com.minni.framework.core;
+
+/**
+ * Java wrapper for the native streaming FIR filter.
+ * The delay line persists between process() calls, so a sensor stream can be
+ * filtered block by block without discontinuities at the block boundaries.
+ */
+public class FirFilter {
+    private long nativeHandle;
+    private final int channels;
+
+    static {
+        System.loadLibrary("minni_core");
+    }
+
+    /**
+     * @param taps Filter coefficients
+     * @param channels Number of interleaved channels
+     */
+    public FirFilter(float[] taps, int channels) {
+        this.channels = channels;
+        nativeInit(taps, channels);
+    }
+
+    public FirFilter(float[] taps) {
+        this(taps, 1);
+    }
+
+    public void close() {
+        nativeFree();
+    }
+
+    @Override
+    protected void finalize() throws Throwable {
+        try {
+            close();
+        } finally {
+            super.finalize();
+        }
+    }
+
+    public int getChannels() {
+        return channels;
+    }
+
+    /**
+     * Filter interleaved frames, continuing from the previous call.
+     * @param input Samples (length must be a multiple of the channel count)
+     * @param output Receives the filtered samples (may be the input array)
+     */
+    public void process(float[] input, float[] output) {
+        nativeProcess(input, output);
+    }
+
+    /**
+     * Clear the delay line.
+     */
+    public void reset() {
+        nativeReset();
+    }
+
+    // Native methods
+    private native void nativeInit(float[] taps, int channels);
+    private native void nativeFree();
+    private native void nativeProcess(float[] input, float[] output);
+    private native void nativeReset();
+}
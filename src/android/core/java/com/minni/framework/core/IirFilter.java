@@ -0,0 +1,79 @@
+package com.minni.framework.core;
+
+/**
+ * Java wrapper for the native streaming IIR filter (cascade of biquad sections).
+ * Section state persists between process() calls.
+ */
+public class IirFilter {
+    private long nativeHandle;
+    private final int channels;
+
+    static {
+        System.loadLibrary("minni_core");
+    }
+
+    /**
+     * @param coefficients Biquad sections as consecutive (b0, b1, b2, a1, a2) groups, a0 == 1
+     * @param channels Number of interleaved channels
+     */
+    public IirFilter(float[] coefficients, int channels) {
+        this.channels = channels;
+        nativeInit(coefficients, channels);
+    }
+
+    private IirFilter(int order, float sampleRate, float cutoff, int channels) {
+        this.channels = channels;
+        nativeInitButterworth(order, sampleRate, cutoff, channels);
+    }
+
+    /**
+     * Butterworth low-pass filter.
+     * @param order Filter order
+     * @param sampleRate Sample rate in Hz
+     * @param cutoff -3 dB frequency in Hz
+     * @param channels Number of interleaved channels
+     */
+    public static IirFilter butterworthLowpass(int order, float sampleRate, float cutoff, int channels) {
+        return new IirFilter(order, sampleRate, cutoff, channels);
+    }
+
+    public void close() {
+        nativeFree();
+    }
+
+    @Override
+    protected void finalize() throws Throwable {
+        try {
+            close();
+        } finally {
+            super.finalize();
+        }
+    }
+
+    public int getChannels() {
+        return channels;
+    }
+
+    /**
+     * Filter interleaved frames, continuing from the previous call.
+     * @param input Samples (length must be a multiple of the channel count)
+     * @param output Receives the filtered samples (may be the input array)
+     */
+    public void process(float[] input, float[] output) {
+        nativeProcess(input, output);
+    }
+
+    /**
+     * Clear the filter state.
+     */
+    public void reset() {
+        nativeReset();
+    }
+
+    // Native methods
+    private native void nativeInit(float[] coefficients, int channels);
+    private native void nativeInitButterworth(int order, float sampleRate, float cutoff, int channels);
+    private native void nativeFree();
+    private native void nativeProcess(float[] input, float[] output);
+    private native void nativeReset();
+}
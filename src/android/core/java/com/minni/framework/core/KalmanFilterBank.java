@@ -0,0 +1,107 @@
+package com.minni.framework.core;
+
+/**
+ * Java wrapper for the native bank of 1D Kalman filters.
+ * Holds any number of independent tracks (e.g. one per RSSI/BLE beacon) behind a
+ * single handle and updates a whole batch of measurements in one JNI call.
+ */
+public class KalmanFilterBank {
+    private long nativeHandle;
+    private final int tracks;
+
+    static {
+        System.loadLibrary("minni_core");
+    }
+
+    /**
+     * @param tracks Number of independent filters
+     * @param measurementUncertainty How much noise we expect in the measurement
+     * @param estimationUncertainty How much noise we expect in the system/process
+     * @param processNoise How fast the value changes
+     * @throws IllegalArgumentException if tracks is negative
+     */
+    public KalmanFilterBank(int tracks, float measurementUncertainty, float estimationUncertainty, float processNoise) {
+        if (tracks < 0) {
+            throw new IllegalArgumentException("tracks cannot be negative");
+        }
+        this.tracks = tracks;
+        nativeInit(tracks, measurementUncertainty, estimationUncertainty, processNoise);
+    }
+
+    public void close() {
+        nativeFree();
+    }
+
+    @Override
+    protected void finalize() throws Throwable {
+        try {
+            close();
+        } finally {
+            super.finalize();
+        }
+    }
+
+    public int size() {
+        return tracks;
+    }
+
+    /**
+     * Update the listed tracks. A track may appear several times; its readings are applied in order.
+     * @param measurements Raw sensor values
+     * @param trackIndices Track of each measurement (out-of-range indices are skipped)
+     * @param estimates Optional (may be null): receives the filtered estimate of each measurement
+     * @return Number of measurements applied
+     * @throws IllegalArgumentException if measurements or trackIndices is null
+     */
+    public int update(float[] measurements, int[] trackIndices, float[] estimates) {
+        if (measurements == null || trackIndices == null) {
+            throw new IllegalArgumentException("Arguments cannot be null");
+        }
+        return nativeUpdate(measurements, trackIndices, estimates);
+    }
+
+    /**
+     * Update every track: measurements[t] belongs to track t.
+     * @param estimates Optional (may be null): receives all estimates
+     * @throws IllegalArgumentException if measurements is null
+     */
+    public void updateAll(float[] measurements, float[] estimates) {
+        if (measurements == null) {
+            throw new IllegalArgumentException("measurements cannot be null");
+        }
+        nativeUpdateAll(measurements, estimates);
+    }
+
+    /**
+     * Copy the current estimates of all tracks.
+     */
+    public void getEstimates(float[] out) {
+        if (out == null) {
+            throw new IllegalArgumentException("out cannot be null");
+        }
+        nativeGetEstimates(out);
+    }
+
+    /**
+     * Reset one track's estimate.
+     */
+    public void reset(int track, float initialValue) {
+        nativeReset(track, initialValue);
+    }
+
+    /**
+     * Per-track noise parameters.
+     */
+    public void setParams(int track, float measurementUncertainty, float estimationUncertainty, float processNoise) {
+        nativeSetParams(track, measurementUncertainty, estimationUncertainty, processNoise);
+    }
+
+    // Native methods
+    private native void nativeInit(int tracks, float measurementUncertainty, float estimationUncertainty, float processNoise);
+    private native void nativeFree();
+    private native int nativeUpdate(float[] measurements, int[] trackIndices, float[] estimates);
+    private native void nativeUpdateAll(float[] measurements, float[] estimates);
+    private native void nativeGetEstimates(float[] out);
+    private native void nativeReset(int track, float initialValue);
+    private native void nativeSetParams(int track, float measurementUncertainty, float estimationUncertainty, float processNoise);
+}
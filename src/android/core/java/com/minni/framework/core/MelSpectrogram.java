@@ -0,0 +1,94 @@
+package com.minni.framework.core;
+
+/**
+ * Java wrapper for the native STFT + log-mel feature extractor.
+ * A whole clip is converted in a single JNI call, straight into a caller-provided
+ * array (e.g. the {1, nMels, frames} input buffer of an audio model).
+ */
+public class MelSpectrogram {
+    private long nativeHandle;
+    private final int nMels;
+
+    static {
+        System.loadLibrary("minni_core");
+    }
+
+    /**
+     * @param sampleRate Sample rate in Hz
+     * @param nFft Frame / FFT length
+     * @param hopLength Samples between frames
+     * @param nMels Number of mel bands
+     */
+    public MelSpectrogram(int sampleRate, int nFft, int hopLength, int nMels) {
+        this.nMels = nMels;
+        nativeInit(sampleRate, nFft, hopLength, nMels);
+    }
+
+    /**
+     * Whisper front end: 16 kHz, 400-point window, hop 160, 80 mel bands.
+     */
+    public static MelSpectrogram whisper() {
+        return new MelSpectrogram(16000, 400, 160, 80);
+    }
+
+    public void close() {
+        nativeFree();
+    }
+
+    @Override
+    protected void finalize() throws Throwable {
+        try {
+            close();
+        } finally {
+            super.finalize();
+        }
+    }
+
+    public int getMelCount() {
+        return nMels;
+    }
+
+    /**
+     * Number of (centered) frames for a clip of numSamples samples.
+     */
+    public int numFrames(int numSamples) {
+        return nativeNumFrames(numSamples);
+    }
+
+    /**
+     * Log-mel spectrogram of a whole clip.
+     * @param audio Samples
+     * @param out Receives the features; length >= maxFrames * nMels
+     * @param maxFrames Frame capacity (also the row stride when melMajor)
+     * @param melMajor true: out[mel * maxFrames + frame], false: out[frame * nMels + mel]
+     * @param whisperNormalize Apply Whisper's clip-level scaling (with melMajor, frames past
+     *                         the returned count are filled as padded silence)
+     * @return Number of frames written
+     */
+    public int compute(float[] audio, float[] out, int maxFrames, boolean melMajor, boolean whisperNormalize) {
+        return nativeCompute(audio, out, maxFrames, melMajor, whisperNormalize);
+    }
+
+    /**
+     * Streaming STFT: append samples, write completed frames (frame-major) to out.
+     * @return Number of frames written
+     */
+    public int process(float[] samples, float[] out) {
+        return nativeProcess(samples, out);
+    }
+
+    /**
+     * Clear the streaming buffer.
+     */
+    public void reset() {
+        nativeReset();
+    }
+
+    // Native methods
+    private native void nativeInit(int sampleRate, int nFft, int hopLength, int nMels);
+    private native void nativeFree();
+    private native int nativeCompute(float[] audio, float[] out, int maxFrames, boolean melMajor, boolean whisperNormalize);
+    private native int nativeProcess(float[] samples, float[] out);
+    private native int nativeNumFrames(int numSamples);
+    private native void nativeReset();
+}
@@ -43,9 +43,94 @@ public class SatSolver implements Closeable {
         return getModelNative();
     }
 
+    /** Result of an incremental {@link #solve} call (matches the native SolverStatus order). */
+    public static final int SATISFIABLE = 0;
+    public static final int UNSATISFIABLE = 1;
+    public static final int UNKNOWN = 2;
+    public static final int TIMEOUT = 3;
+
+    /**
+     * Add clauses to the persistent formula (incremental use; check() starts over).
+     * @return false if the formula cannot be parsed
+     */
+    public boolean add(String formula) {
+        if (formula == null) return false;
+        return nativeAdd(formula);
+    }
+
+    /**
+     * Solve the formula built with add(), with the given atoms ("x" or "!x") assumed
+     * true for this call only. Learned clauses are kept between calls.
+     * @return SATISFIABLE, UNSATISFIABLE, UNKNOWN or TIMEOUT
+     */
+    public int solve(String... assumptions) {
+        return nativeSolve(assumptions);
+    }
+
+    /**
+     * After solve() returned UNSATISFIABLE: the assumptions that conflict.
+     */
+    public String[] getUnsatCore() {
+        return nativeGetUnsatCore();
+    }
+
+    /** Open a scope: clauses added until the matching pop() are removed by it. */
+    public void push() {
+        nativePush();
+    }
+
+    /**
+     * Close the innermost scope, dropping its clauses and what was learned from them.
+     * @return false if no scope is open
+     */
+    public boolean pop() {
+        return nativePop();
+    }
+
+    /**
+     * Set a solver parameter, e.g. "timeout" (ms), "max_conflicts", "max_propagations",
+     * "mode" ("cdcl" / "dpll"), "threads" (portfolio workers, "0" = one per core),
+     * "preprocess" ("true" / "false", check() only), "proof" (DRAT proof file written
+     * by check(), "" for none), "proof_format" ("binary" / "text"), "stats" ("true"
+     * also times the solver phases, see getStats()). Limits apply to every later
+     * check() / solve() call.
+     */
+    public void setParam(String key, String value) {
+        if (key == null || value == null) return;
+        nativeSetParam(key, value);
+    }
+
+    /**
+     * Counters and timings since the last check(): "decisions", "conflicts",
+     * "propagations_per_sec", "learned_size_avg", "restarts", "solve_ms", ...
+     * @return Map of statistic name -> value (numbers as strings)
+     */
+    public Map<String, String> getStats() {
+        return nativeGetStats();
+    }
+
+    /**
+     * Cancel the check() / solve() running on another thread; it returns UNKNOWN
+     * (check() returns false). A cancel issued while nothing runs cancels the next call.
+     * Must not race with close().
+     */
+    public void cancel() {
+        if (nativeHandle != 0) {
+            nativeInterrupt();
+        }
+    }
+
     // Native declarations
     private native void nativeInit();
     private native void nativeFree();
     private native boolean checkNative(String formula);
     private native Map<String, String> getModelNative();
+    private native Map<String, String> nativeGetStats();
+    private native boolean nativeAdd(String formula);
+    private native int nativeSolve(String[] assumptions);
+    private native String[] nativeGetUnsatCore();
+    private native void nativePush();
+    private native boolean nativePop();
+    private native void nativeSetParam(String key, String value);
+    private native void nativeInterrupt();
 }
@@ -1,12 +1,22 @@
 package com.minni.framework.core;
 
+import java.nio.ByteBuffer;
+
 /**
  * High-level signal processor that chains DSP operations.
  * State is maintained in native memory to reduce JNI copying.
+ *
+ * Steady-state frames allocate nothing when using load / applyWindow / copyOutput
+ * with reused arrays, or direct ByteBuffers (native byte order) with the *Direct
+ * variants and bind(). getOutput() allocates a new array per call.
  */
 public class SignalProcessor {
     private long nativeHandle;
 
+    // Keeps bound direct buffers reachable while native code points into them
+    private ByteBuffer boundReal;
+    private ByteBuffer boundImag;
+
     static {
         System.loadLibrary("minni_core");
     }
@@ -32,9 +42,31 @@ public class SignalProcessor {
      * Load data into the processor. Resets state.
      */
     public void load(float[] data) {
+        boundReal = null;
+        boundImag = null;
         nativeLoad(data);
     }
 
+    /**
+     * Load `size` floats from a direct buffer (no JNI array access at all).
+     */
+    public void loadDirect(ByteBuffer data, int size) {
+        boundReal = null;
+        boundImag = null;
+        nativeLoadDirect(data, size);
+    }
+
+    /**
+     * Process a direct buffer in place: every following operation reads and writes
+     * `real` (and `imag`, or an internal zeroed buffer when null) until the next load.
+     * The buffers must stay untouched by Java while bound.
+     */
+    public void bind(ByteBuffer real, ByteBuffer imag, int size) {
+        boundReal = real;
+        boundImag = imag;
+        nativeBindDirect(real, imag, size);
+    }
+
     /**
      * Apply a window function (e.g., Hanning).
      * Window size must match data size.
@@ -43,6 +75,13 @@ public class SignalProcessor {
         nativeApplyWindow(window);
     }
 
+    /**
+     * Apply a window held in a direct buffer of `size` floats.
+     */
+    public void applyWindowDirect(ByteBuffer window, int size) {
+        nativeApplyWindowDirect(window, size);
+    }
+
     /**
      * Perform in-place FFT.
      */
@@ -50,6 +89,15 @@ public class SignalProcessor {
         nativeFft(inverse);
     }
 
+    /**
+     * Real-input FFT: N real samples become N/2 + 1 complex bins (DC .. Nyquist).
+     * About twice as fast as fft() for audio and sensor data.
+     * The inverse turns N/2 + 1 bins back into N samples.
+     */
+    public void rfft(boolean inverse) {
+        nativeRfft(inverse);
+    }
+
     /**
      * Compute magnitude of the current complex signal.
      * Result replaces the real part; imaginary part becomes 0.
@@ -65,12 +113,34 @@ public class SignalProcessor {
         return nativeGetOutput();
     }
 
+    /**
+     * Copy the current result (real part) into a reusable array.
+     * @return Number of values written
+     */
+    public int copyOutput(float[] out) {
+        return nativeCopyOutput(out);
+    }
+
+    /**
+     * Copy the current result (real part) into a direct buffer.
+     * @return Number of values written
+     */
+    public int copyOutputDirect(ByteBuffer out) {
+        return nativeCopyOutputDirect(out);
+    }
+
     // Native methods
     private native void nativeInit();
     private native void nativeFree();
     private native void nativeLoad(float[] data);
+    private native void nativeLoadDirect(ByteBuffer data, int size);
+    private native void nativeBindDirect(ByteBuffer real, ByteBuffer imag, int size);
     private native void nativeApplyWindow(float[] window);
+    private native void nativeApplyWindowDirect(ByteBuffer window, int size);
     private native void nativeFft(boolean inverse);
+    private native void nativeRfft(boolean inverse);
     private native void nativeMagnitude();
     private native float[] nativeGetOutput();
+    private native int nativeCopyOutput(float[] out);
+    private native int nativeCopyOutputDirect(ByteBuffer out);
 }
@@ -111,6 +111,28 @@ public class VectorStore {
         return nativeLoad(path, encryptionKey);
     }
 
+    /**
+     * Bulk import embeddings written by numpy.save() (2D float32 or float16).
+     * Much faster than calling addVector() per row: the file is memory-mapped
+     * and converted/quantized in parallel chunks.
+     * @param npyPath Path to the ".npy" file.
+     * @param idsPath Text file with one ID per line, in row order.
+     * @return Number of vectors added.
+     */
+    public int importNpy(String npyPath, String idsPath) {
+        return nativeImportNpy(npyPath, idsPath);
+    }
+
+    /**
+     * Convert a ".npy" file straight into a flat (memory-mappable) store file
+     * without building an in-memory store first.
+     * @param quantize If true, vectors are stored as 8-bit integers.
+     * @return true if successful.
+     */
+    public static boolean importNpyToFlat(String npyPath, String idsPath, String outPath, boolean quantize) {
+        return nativeImportNpyToFlat(npyPath, idsPath, outPath, quantize);
+    }
+
     // Result helper class
     public static class SearchResult {
         public final String id;
@@ -136,4 +158,6 @@ public class VectorStore {
     private native void nativeClear();
     private native boolean nativeSave(String path, String encryptionKey);
     private native boolean nativeLoad(String path, String encryptionKey);
+    private native int nativeImportNpy(String npyPath, String idsPath);
+    private static native boolean nativeImportNpyToFlat(String npyPath, String idsPath, String outPath, boolean quantize);
 }
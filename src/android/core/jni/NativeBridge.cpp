@@ -1,22 +1,55 @@
 #include <jni.h>
+#include <algorithm>
+#include <cmath>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include "logic/SatSolver.h"
 #include "logic/RuleEngine.h"
 #include "logic/VectorStore.h"
+#include "logic/EmbeddingImporter.h"
 #include "signal/DSPKernel.h"
 #include "signal/SignalProcessor.h"
 #include "signal/KalmanFilter.h"
+#include "signal/KalmanFilterBank.h"
+#include "signal/FirFilter.h"
+#include "signal/IirFilter.h"
+#include "signal/MelSpectrogram.h"
 #include "genai/ModelRunner.h"
 
 // JNI Helper to throw Java exceptions
-void throwJavaException(JNIEnv* env, const char* msg) {
-    jclass cls = env->FindClass("java/lang/RuntimeException");
+void throwJavaException(JNIEnv* env, const char* msg, const char* className = "java/lang/RuntimeException") {
+    jclass cls = env->FindClass(className);
     if (cls) {
         env->ThrowNew(cls, msg);
     }
 }
 
+// Shared by FirFilter / IirFilter process(): interleaved frames, input may be output.
+// Critical access avoids the element copy of GetFloatArrayElements on the audio path.
+template <typename Filter>
+static void processInterleaved(JNIEnv* env, Filter* filter, jfloatArray input, jfloatArray output) {
+    jsize len = env->GetArrayLength(input);
+    if (len != env->GetArrayLength(output)) {
+        throwJavaException(env, "Array lengths must match");
+        return;
+    }
+    size_t channels = filter->channels();
+    if (static_cast<size_t>(len) % channels != 0) {
+        throwJavaException(env, "Array length must be a multiple of the channel count");
+        return;
+    }
+
+    bool in_place = env->IsSameObject(input, output);
+    auto* pIn = static_cast<jfloat*>(env->GetPrimitiveArrayCritical(input, nullptr));
+    auto* pOut = in_place ? pIn : static_cast<jfloat*>(env->GetPrimitiveArrayCritical(output, nullptr));
+    filter->process(pIn, pOut, static_cast<size_t>(len) / channels);
+    if (!in_place) {
+        env->ReleasePrimitiveArrayCritical(output, pOut, 0);
+    }
+    env->ReleasePrimitiveArrayCritical(input, pIn, in_place ? 0 : JNI_ABORT);
+}
+
 extern "C" {
 
 // ========================================================
@@ -149,13 +182,7 @@ Java_com_minni_framework_core_SatSolver_checkNative(JNIEnv* env, jobject obj, js
     return (status == minni::logic::SolverStatus::SATISFIABLE) ? JNI_TRUE : JNI_FALSE;
 }
 
-JNIEXPORT jobject JNICALL
-Java_com_minni_framework_core_SatSolver_getModelNative(JNIEnv* env, jobject obj) {
-    auto* solver = getHandleSat(env, obj);
-    if (!solver) return nullptr;
-
-    auto model = solver->get_model();
-
+static jobject toHashMap(JNIEnv* env, const std::unordered_map<std::string, std::string>& entries) {
     jclass mapClass = env->FindClass("java/util/HashMap");
     if (mapClass == nullptr) return nullptr;
 
@@ -165,7 +192,7 @@ Java_com_minni_framework_core_SatSolver_getModelNative(JNIEnv* env, jobject obj)
     jmethodID put = env->GetMethodID(mapClass, "put",
                                      "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
 
-    for (const auto& pair : model) {
+    for (const auto& pair : entries) {
         jstring key = env->NewStringUTF(pair.first.c_str());
         jstring value = env->NewStringUTF(pair.second.c_str());
         env->CallObjectMethod(hashMap, put, key, value);
@@ -176,6 +203,100 @@ Java_com_minni_framework_core_SatSolver_getModelNative(JNIEnv* env, jobject obj)
     return hashMap;
 }
 
+JNIEXPORT jobject JNICALL
+Java_com_minni_framework_core_SatSolver_getModelNative(JNIEnv* env, jobject obj) {
+    auto* solver = getHandleSat(env, obj);
+    if (!solver) return nullptr;
+    return toHashMap(env, solver->get_model());
+}
+
+JNIEXPORT jobject JNICALL
+Java_com_minni_framework_core_SatSolver_nativeGetStats(JNIEnv* env, jobject obj) {
+    auto* solver = getHandleSat(env, obj);
+    if (!solver) return nullptr;
+    return toHashMap(env, solver->get_stats());
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_minni_framework_core_SatSolver_nativeAdd(JNIEnv* env, jobject obj, jstring formula) {
+    auto* solver = getHandleSat(env, obj);
+    if (!solver) return JNI_FALSE;
+
+    const char* s_formula = env->GetStringUTFChars(formula, nullptr);
+    bool ok = solver->add(std::string(s_formula));
+    env->ReleaseStringUTFChars(formula, s_formula);
+    return ok ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT jint JNICALL
+Java_com_minni_framework_core_SatSolver_nativeSolve(JNIEnv* env, jobject obj, jobjectArray assumptions) {
+    auto* solver = getHandleSat(env, obj);
+    if (!solver) return static_cast<jint>(minni::logic::SolverStatus::UNKNOWN);
+
+    std::vector<std::string> atoms;
+    const jsize count = assumptions ? env->GetArrayLength(assumptions) : 0;
+    atoms.reserve(count);
+    for (jsize i = 0; i < count; ++i) {
+        auto atom = static_cast<jstring>(env->GetObjectArrayElement(assumptions, i));
+        if (atom == nullptr) {
+            throwJavaException(env, "Assumptions cannot contain null", "java/lang/IllegalArgumentException");
+            return static_cast<jint>(minni::logic::SolverStatus::UNKNOWN);
+        }
+        const char* s_atom = env->GetStringUTFChars(atom, nullptr);
+        atoms.emplace_back(s_atom);
+        env->ReleaseStringUTFChars(atom, s_atom);
+        env->DeleteLocalRef(atom);
+    }
+    return static_cast<jint>(solver->solve(atoms));
+}
+
+JNIEXPORT jobjectArray JNICALL
+Java_com_minni_framework_core_SatSolver_nativeGetUnsatCore(JNIEnv* env, jobject obj) {
+    auto* solver = getHandleSat(env, obj);
+    if (!solver) return nullptr;
+
+    std::vector<std::string> core = solver->get_unsat_core();
+    jclass stringCls = env->FindClass("java/lang/String");
+    jobjectArray result = env->NewObjectArray(static_cast<jsize>(core.size()), stringCls, nullptr);
+    for (size_t i = 0; i < core.size(); ++i) {
+        jstring atom = env->NewStringUTF(core[i].c_str());
+        env->SetObjectArrayElement(result, static_cast<jsize>(i), atom);
+        env->DeleteLocalRef(atom);
+    }
+    return result;
+}
+
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_SatSolver_nativePush(JNIEnv* env, jobject obj) {
+    auto* solver = getHandleSat(env, obj);
+    if (solver) solver->push();
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_minni_framework_core_SatSolver_nativePop(JNIEnv* env, jobject obj) {
+    auto* solver = getHandleSat(env, obj);
+    return (solver && solver->pop()) ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_SatSolver_nativeSetParam(JNIEnv* env, jobject obj, jstring key, jstring value) {
+    auto* solver = getHandleSat(env, obj);
+    if (!solver) return;
+
+    const char* s_key = env->GetStringUTFChars(key, nullptr);
+    const char* s_value = env->GetStringUTFChars(value, nullptr);
+    solver->set_param(std::string(s_key), std::string(s_value));
+    env->ReleaseStringUTFChars(key, s_key);
+    env->ReleaseStringUTFChars(value, s_value);
+}
+
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_SatSolver_nativeInterrupt(JNIEnv* env, jobject obj) {
+    // Called from a thread other than the solving one; only touches an atomic flag
+    auto* solver = getHandleSat(env, obj);
+    if (solver) solver->interrupt();
+}
+
 // ========================================================
 // RuleEngine JNI Bindings
 // ========================================================
@@ -407,14 +528,47 @@ Java_com_minni_framework_core_SignalProcessor_nativeLoad(JNIEnv* env, jobject ob
     auto* proc = getHandleSignalProc(env, obj);
     if (!proc) return;
 
+    // Critical access: no element copy, and load() reuses the native buffers
     jsize len = env->GetArrayLength(data);
-    jfloat* pData = env->GetFloatArrayElements(data, nullptr);
+    auto* pData = static_cast<jfloat*>(env->GetPrimitiveArrayCritical(data, nullptr));
+    proc->load(pData, static_cast<size_t>(len));
+    env->ReleasePrimitiveArrayCritical(data, pData, JNI_ABORT);
+}
+
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_SignalProcessor_nativeLoadDirect(JNIEnv* env, jobject obj, jobject buffer, jint size) {
+    auto* proc = getHandleSignalProc(env, obj);
+    if (!proc) return;
 
-    // Copy to vector
-    std::vector<float> vec(pData, pData + len);
-    proc->load(vec);
+    auto* pData = static_cast<float*>(env->GetDirectBufferAddress(buffer));
+    jlong capacity = env->GetDirectBufferCapacity(buffer);
+    if (!pData || size < 0 || static_cast<jlong>(size) * 4 > capacity) {
+        throwJavaException(env, "Expected a direct buffer holding `size` floats");
+        return;
+    }
+    proc->load(pData, static_cast<size_t>(size));
+}
+
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_SignalProcessor_nativeBindDirect(JNIEnv* env, jobject obj,
+                                                              jobject real, jobject imag, jint size) {
+    auto* proc = getHandleSignalProc(env, obj);
+    if (!proc) return;
 
-    env->ReleaseFloatArrayElements(data, pData, JNI_ABORT);
+    auto* pReal = static_cast<float*>(env->GetDirectBufferAddress(real));
+    if (!pReal || size < 0 || static_cast<jlong>(size) * 4 > env->GetDirectBufferCapacity(real)) {
+        throwJavaException(env, "Expected a direct buffer holding `size` floats");
+        return;
+    }
+    float* pImag = nullptr;
+    if (imag) {
+        pImag = static_cast<float*>(env->GetDirectBufferAddress(imag));
+        if (!pImag || static_cast<jlong>(size) * 4 > env->GetDirectBufferCapacity(imag)) {
+            throwJavaException(env, "Expected a direct buffer holding `size` floats");
+            return;
+        }
+    }
+    proc->bind(pReal, pImag, static_cast<size_t>(size));
 }
 
 JNIEXPORT void JNICALL
@@ -423,12 +577,23 @@ Java_com_minni_framework_core_SignalProcessor_nativeApplyWindow(JNIEnv* env, job
     if (!proc) return;
 
     jsize len = env->GetArrayLength(window);
-    jfloat* pWin = env->GetFloatArrayElements(window, nullptr);
+    auto* pWin = static_cast<jfloat*>(env->GetPrimitiveArrayCritical(window, nullptr));
+    proc->apply_window(pWin, static_cast<size_t>(len));
+    env->ReleasePrimitiveArrayCritical(window, pWin, JNI_ABORT);
+}
 
-    std::vector<float> vec(pWin, pWin + len);
-    proc->apply_window(vec);
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_SignalProcessor_nativeApplyWindowDirect(JNIEnv* env, jobject obj,
+                                                                     jobject window, jint size) {
+    auto* proc = getHandleSignalProc(env, obj);
+    if (!proc) return;
 
-    env->ReleaseFloatArrayElements(window, pWin, JNI_ABORT);
+    auto* pWin = static_cast<float*>(env->GetDirectBufferAddress(window));
+    if (!pWin || size < 0 || static_cast<jlong>(size) * 4 > env->GetDirectBufferCapacity(window)) {
+        throwJavaException(env, "Expected a direct buffer holding `size` floats");
+        return;
+    }
+    proc->apply_window(pWin, static_cast<size_t>(size));
 }
 
 JNIEXPORT void JNICALL
@@ -439,6 +604,18 @@ Java_com_minni_framework_core_SignalProcessor_nativeFft(JNIEnv* env, jobject obj
     }
 }
 
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_SignalProcessor_nativeRfft(JNIEnv* env, jobject obj, jboolean inverse) {
+    auto* proc = getHandleSignalProc(env, obj);
+    if (proc) {
+        if (inverse) {
+            proc->irfft();
+        } else {
+            proc->rfft();
+        }
+    }
+}
+
 JNIEXPORT void JNICALL
 Java_com_minni_framework_core_SignalProcessor_nativeMagnitude(JNIEnv* env, jobject obj) {
     auto* proc = getHandleSignalProc(env, obj);
@@ -452,15 +629,40 @@ Java_com_minni_framework_core_SignalProcessor_nativeGetOutput(JNIEnv* env, jobje
     auto* proc = getHandleSignalProc(env, obj);
     if (!proc) return nullptr;
 
-    std::vector<float> output = proc->get_output();
-
-    jfloatArray result = env->NewFloatArray(output.size());
+    // Allocates a new Java array per call; copyOutput() reuses the caller's
+    jsize size = static_cast<jsize>(proc->size());
+    jfloatArray result = env->NewFloatArray(size);
     if (result == nullptr) return nullptr;
 
-    env->SetFloatArrayRegion(result, 0, output.size(), output.data());
+    env->SetFloatArrayRegion(result, 0, size, proc->real_data());
     return result;
 }
 
+JNIEXPORT jint JNICALL
+Java_com_minni_framework_core_SignalProcessor_nativeCopyOutput(JNIEnv* env, jobject obj, jfloatArray out) {
+    auto* proc = getHandleSignalProc(env, obj);
+    if (!proc) return 0;
+
+    jsize len = env->GetArrayLength(out);
+    size_t count = std::min(proc->size(), static_cast<size_t>(len));
+    env->SetFloatArrayRegion(out, 0, static_cast<jsize>(count), proc->real_data());
+    return static_cast<jint>(count);
+}
+
+JNIEXPORT jint JNICALL
+Java_com_minni_framework_core_SignalProcessor_nativeCopyOutputDirect(JNIEnv* env, jobject obj, jobject buffer) {
+    auto* proc = getHandleSignalProc(env, obj);
+    if (!proc) return 0;
+
+    auto* pOut = static_cast<float*>(env->GetDirectBufferAddress(buffer));
+    if (!pOut) {
+        throwJavaException(env, "Expected a direct buffer");
+        return 0;
+    }
+    size_t capacity = static_cast<size_t>(env->GetDirectBufferCapacity(buffer)) / sizeof(float);
+    return static_cast<jint>(proc->copy_output(pOut, capacity));
+}
+
 // ========================================================
 // KalmanFilter JNI Bindings
 // ========================================================
@@ -516,6 +718,365 @@ Java_com_minni_framework_core_KalmanFilter_nativeReset(JNIEnv* env, jobject obj,
     }
 }
 
+// ========================================================
+// KalmanFilterBank JNI Bindings
+// ========================================================
+
+static minni::signal::KalmanFilterBank* getHandleKalmanBank(JNIEnv* env, jobject obj) {
+    jclass cls = env->GetObjectClass(obj);
+    jfieldID fid = env->GetFieldID(cls, "nativeHandle", "J");
+    jlong handle = env->GetLongField(obj, fid);
+    return reinterpret_cast<minni::signal::KalmanFilterBank*>(handle);
+}
+
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_KalmanFilterBank_nativeInit(JNIEnv* env, jobject obj, jint tracks,
+                                                          jfloat measureUncertainty,
+                                                          jfloat estUncertainty,
+                                                          jfloat processNoise) {
+    // The Java wrapper checks too; a negative count must not become a huge size_t
+    if (tracks < 0) {
+        throwJavaException(env, "Track count cannot be negative");
+        return;
+    }
+    auto* bank = new minni::signal::KalmanFilterBank(static_cast<size_t>(tracks), measureUncertainty,
+                                                     estUncertainty, processNoise);
+    jclass cls = env->GetObjectClass(obj);
+    jfieldID fid = env->GetFieldID(cls, "nativeHandle", "J");
+    env->SetLongField(obj, fid, reinterpret_cast<jlong>(bank));
+}
+
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_KalmanFilterBank_nativeFree(JNIEnv* env, jobject obj) {
+    auto* bank = getHandleKalmanBank(env, obj);
+    if (bank) {
+        delete bank;
+        jclass cls = env->GetObjectClass(obj);
+        jfieldID fid = env->GetFieldID(cls, "nativeHandle", "J");
+        env->SetLongField(obj, fid, 0);
+    }
+}
+
+JNIEXPORT jint JNICALL
+Java_com_minni_framework_core_KalmanFilterBank_nativeUpdate(JNIEnv* env, jobject obj,
+                                                            jfloatArray measurements, jintArray tracks,
+                                                            jfloatArray estimates) {
+    auto* bank = getHandleKalmanBank(env, obj);
+    if (!bank) return 0;
+    if (!measurements || !tracks) {
+        throwJavaException(env, "Arrays cannot be null");
+        return 0;
+    }
+
+    jsize count = env->GetArrayLength(measurements);
+    if (count != env->GetArrayLength(tracks) || (estimates && env->GetArrayLength(estimates) < count)) {
+        throwJavaException(env, "Array lengths must match");
+        return 0;
+    }
+
+    // One JNI transition for the whole batch; critical access avoids copying the arrays
+    auto* pMeas = static_cast<jfloat*>(env->GetPrimitiveArrayCritical(measurements, nullptr));
+    auto* pTracks = static_cast<jint*>(env->GetPrimitiveArrayCritical(tracks, nullptr));
+    auto* pOut = estimates ? static_cast<jfloat*>(env->GetPrimitiveArrayCritical(estimates, nullptr)) : nullptr;
+
+    size_t applied = bank->update(reinterpret_cast<const int32_t*>(pTracks), pMeas,
+                                  static_cast<size_t>(count), pOut);
+
+    if (pOut) env->ReleasePrimitiveArrayCritical(estimates, pOut, 0);
+    env->ReleasePrimitiveArrayCritical(tracks, pTracks, JNI_ABORT);
+    env->ReleasePrimitiveArrayCritical(measurements, pMeas, JNI_ABORT);
+    return static_cast<jint>(applied);
+}
+
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_KalmanFilterBank_nativeUpdateAll(JNIEnv* env, jobject obj,
+                                                               jfloatArray measurements, jfloatArray estimates) {
+    auto* bank = getHandleKalmanBank(env, obj);
+    if (!bank) return;
+    if (!measurements) {
+        throwJavaException(env, "Measurements cannot be null");
+        return;
+    }
+
+    size_t n = bank->size();
+    if (static_cast<size_t>(env->GetArrayLength(measurements)) != n ||
+        (estimates && static_cast<size_t>(env->GetArrayLength(estimates)) < n)) {
+        throwJavaException(env, "Array length must equal the number of tracks");
+        return;
+    }
+
+    auto* pMeas = static_cast<jfloat*>(env->GetPrimitiveArrayCritical(measurements, nullptr));
+    auto* pOut = estimates ? static_cast<jfloat*>(env->GetPrimitiveArrayCritical(estimates, nullptr)) : nullptr;
+    bank->update_all(pMeas, pOut);
+    if (pOut) env->ReleasePrimitiveArrayCritical(estimates, pOut, 0);
+    env->ReleasePrimitiveArrayCritical(measurements, pMeas, JNI_ABORT);
+}
+
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_KalmanFilterBank_nativeGetEstimates(JNIEnv* env, jobject obj, jfloatArray out) {
+    auto* bank = getHandleKalmanBank(env, obj);
+    if (!bank || !out) return;
+
+    jsize count = static_cast<jsize>(std::min(bank->size(), static_cast<size_t>(env->GetArrayLength(out))));
+    env->SetFloatArrayRegion(out, 0, count, bank->estimates());
+}
+
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_KalmanFilterBank_nativeReset(JNIEnv* env, jobject obj, jint track, jfloat initialValue) {
+    auto* bank = getHandleKalmanBank(env, obj);
+    if (bank && track >= 0) {
+        bank->reset(static_cast<size_t>(track), initialValue);
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_KalmanFilterBank_nativeSetParams(JNIEnv* env, jobject obj, jint track,
+                                                               jfloat measureUncertainty,
+                                                               jfloat estUncertainty,
+                                                               jfloat processNoise) {
+    auto* bank = getHandleKalmanBank(env, obj);
+    if (bank && track >= 0) {
+        bank->set_params(static_cast<size_t>(track), measureUncertainty, estUncertainty, processNoise);
+    }
+}
+
+// ========================================================
+// FirFilter / IirFilter JNI Bindings
+// ========================================================
+
+static minni::signal::FirFilter* getHandleFir(JNIEnv* env, jobject obj) {
+    jclass cls = env->GetObjectClass(obj);
+    jfieldID fid = env->GetFieldID(cls, "nativeHandle", "J");
+    jlong handle = env->GetLongField(obj, fid);
+    return reinterpret_cast<minni::signal::FirFilter*>(handle);
+}
+
+static minni::signal::IirFilter* getHandleIir(JNIEnv* env, jobject obj) {
+    jclass cls = env->GetObjectClass(obj);
+    jfieldID fid = env->GetFieldID(cls, "nativeHandle", "J");
+    jlong handle = env->GetLongField(obj, fid);
+    return reinterpret_cast<minni::signal::IirFilter*>(handle);
+}
+
+static void setNativeHandle(JNIEnv* env, jobject obj, void* ptr) {
+    jclass cls = env->GetObjectClass(obj);
+    jfieldID fid = env->GetFieldID(cls, "nativeHandle", "J");
+    env->SetLongField(obj, fid, reinterpret_cast<jlong>(ptr));
+}
+
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_FirFilter_nativeInit(JNIEnv* env, jobject obj, jfloatArray taps, jint channels) {
+    if (channels <= 0) {
+        throwJavaException(env, "Channel count must be positive", "java/lang/IllegalArgumentException");
+        return;
+    }
+    jsize len = env->GetArrayLength(taps);
+    jfloat* pTaps = env->GetFloatArrayElements(taps, nullptr);
+    auto* fir = new minni::signal::FirFilter(pTaps, static_cast<size_t>(len), static_cast<size_t>(channels));
+    env->ReleaseFloatArrayElements(taps, pTaps, JNI_ABORT);
+    setNativeHandle(env, obj, fir);
+}
+
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_FirFilter_nativeFree(JNIEnv* env, jobject obj) {
+    auto* fir = getHandleFir(env, obj);
+    if (fir) {
+        delete fir;
+        setNativeHandle(env, obj, nullptr);
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_FirFilter_nativeProcess(JNIEnv* env, jobject obj,
+                                                     jfloatArray input, jfloatArray output) {
+    auto* fir = getHandleFir(env, obj);
+    if (fir) {
+        processInterleaved(env, fir, input, output);
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_FirFilter_nativeReset(JNIEnv* env, jobject obj) {
+    auto* fir = getHandleFir(env, obj);
+    if (fir) {
+        fir->reset();
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_IirFilter_nativeInit(JNIEnv* env, jobject obj, jfloatArray coeffs, jint channels) {
+    if (channels <= 0) {
+        throwJavaException(env, "Channel count must be positive", "java/lang/IllegalArgumentException");
+        return;
+    }
+    jsize len = env->GetArrayLength(coeffs);
+    if (len % 5 != 0) {
+        throwJavaException(env, "Biquad coefficients must come in groups of 5 (b0, b1, b2, a1, a2)");
+        return;
+    }
+    jfloat* pCoeffs = env->GetFloatArrayElements(coeffs, nullptr);
+    std::vector<minni::signal::IirFilter::Biquad> sections(static_cast<size_t>(len / 5));
+    for (size_t s = 0; s < sections.size(); ++s) {
+        const jfloat* c = pCoeffs + 5 * s;
+        sections[s] = {c[0], c[1], c[2], c[3], c[4]};
+    }
+    env->ReleaseFloatArrayElements(coeffs, pCoeffs, JNI_ABORT);
+
+    auto* iir = new minni::signal::IirFilter(sections.data(), sections.size(), static_cast<size_t>(channels));
+    setNativeHandle(env, obj, iir);
+}
+
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_IirFilter_nativeInitButterworth(JNIEnv* env, jobject obj, jint order,
+                                                             jfloat sampleRate, jfloat cutoff, jint channels) {
+    if (order <= 0 || channels <= 0) {
+        throwJavaException(env, "Filter order and channel count must be positive", "java/lang/IllegalArgumentException");
+        return;
+    }
+    auto sections = minni::signal::IirFilter::butterworth_lowpass(static_cast<size_t>(order), sampleRate, cutoff);
+    auto* iir = new minni::signal::IirFilter(sections.data(), sections.size(), static_cast<size_t>(channels));
+    setNativeHandle(env, obj, iir);
+}
+
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_IirFilter_nativeFree(JNIEnv* env, jobject obj) {
+    auto* iir = getHandleIir(env, obj);
+    if (iir) {
+        delete iir;
+        setNativeHandle(env, obj, nullptr);
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_IirFilter_nativeProcess(JNIEnv* env, jobject obj,
+                                                     jfloatArray input, jfloatArray output) {
+    auto* iir = getHandleIir(env, obj);
+    if (iir) {
+        processInterleaved(env, iir, input, output);
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_IirFilter_nativeReset(JNIEnv* env, jobject obj) {
+    auto* iir = getHandleIir(env, obj);
+    if (iir) {
+        iir->reset();
+    }
+}
+
+// ========================================================
+// MelSpectrogram JNI Bindings
+// ========================================================
+
+static minni::signal::MelSpectrogram* getHandleMel(JNIEnv* env, jobject obj) {
+    jclass cls = env->GetObjectClass(obj);
+    jfieldID fid = env->GetFieldID(cls, "nativeHandle", "J");
+    jlong handle = env->GetLongField(obj, fid);
+    return reinterpret_cast<minni::signal::MelSpectrogram*>(handle);
+}
+
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_MelSpectrogram_nativeInit(JNIEnv* env, jobject obj, jint sampleRate,
+                                                       jint nFft, jint hopLength, jint nMels) {
+    if (sampleRate <= 0 || nFft <= 0 || hopLength <= 0 || nMels <= 0) {
+        throwJavaException(env, "Sample rate, FFT size, hop length and mel count must be positive",
+                           "java/lang/IllegalArgumentException");
+        return;
+    }
+    minni::signal::MelSpectrogram::Config config;
+    config.sample_rate = static_cast<size_t>(sampleRate);
+    config.n_fft = static_cast<size_t>(nFft);
+    config.hop_length = static_cast<size_t>(hopLength);
+    config.n_mels = static_cast<size_t>(nMels);
+    setNativeHandle(env, obj, new minni::signal::MelSpectrogram(config));
+}
+
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_MelSpectrogram_nativeFree(JNIEnv* env, jobject obj) {
+    auto* mel = getHandleMel(env, obj);
+    if (mel) {
+        delete mel;
+        setNativeHandle(env, obj, nullptr);
+    }
+}
+
+JNIEXPORT jint JNICALL
+Java_com_minni_framework_core_MelSpectrogram_nativeCompute(JNIEnv* env, jobject obj, jfloatArray audio,
+                                                          jfloatArray out, jint maxFrames,
+                                                          jboolean melMajor, jboolean whisperNormalize) {
+    auto* mel = getHandleMel(env, obj);
+    if (!mel) return 0;
+
+    size_t n_mels = mel->config().n_mels;
+    if (maxFrames <= 0 || static_cast<size_t>(env->GetArrayLength(out)) < static_cast<size_t>(maxFrames) * n_mels) {
+        throwJavaException(env, "Output array too small for maxFrames * nMels");
+        return 0;
+    }
+
+    // One JNI call per clip; critical access avoids copying the audio and the feature buffer
+    jsize len = env->GetArrayLength(audio);
+    auto* pAudio = static_cast<jfloat*>(env->GetPrimitiveArrayCritical(audio, nullptr));
+    auto* pOut = static_cast<jfloat*>(env->GetPrimitiveArrayCritical(out, nullptr));
+
+    auto layout = melMajor ? minni::signal::MelSpectrogram::Layout::MEL_MAJOR
+                           : minni::signal::MelSpectrogram::Layout::FRAME_MAJOR;
+    size_t frames = mel->compute(pAudio, static_cast<size_t>(len), pOut, static_cast<size_t>(maxFrames), layout);
+    if (whisperNormalize) {
+        size_t count = frames * n_mels;
+        if (melMajor) {
+            // Rows are maxFrames long. Fill the unwritten tail with the log-mel of silence,
+            // as Whisper pads clips to 30 s, so stale values cannot set the clamp.
+            const size_t stride = static_cast<size_t>(maxFrames);
+            const float silence = std::log10(mel->config().log_floor);
+            for (size_t m = 0; m < n_mels; ++m) {
+                std::fill(pOut + m * stride + frames, pOut + (m + 1) * stride, silence);
+            }
+            count = stride * n_mels;
+        }
+        minni::signal::MelSpectrogram::normalize_whisper(pOut, count);
+    }
+
+    env->ReleasePrimitiveArrayCritical(out, pOut, 0);
+    env->ReleasePrimitiveArrayCritical(audio, pAudio, JNI_ABORT);
+    return static_cast<jint>(frames);
+}
+
+JNIEXPORT jint JNICALL
+Java_com_minni_framework_core_MelSpectrogram_nativeProcess(JNIEnv* env, jobject obj,
+                                                          jfloatArray samples, jfloatArray out) {
+    auto* mel = getHandleMel(env, obj);
+    if (!mel) return 0;
+
+    jsize len = env->GetArrayLength(samples);
+    size_t needed = mel->pending_frames(static_cast<size_t>(len)) * mel->config().n_mels;
+    if (static_cast<size_t>(env->GetArrayLength(out)) < needed) {
+        throwJavaException(env, "Output array too small for the pending frames");
+        return 0;
+    }
+
+    auto* pIn = static_cast<jfloat*>(env->GetPrimitiveArrayCritical(samples, nullptr));
+    auto* pOut = static_cast<jfloat*>(env->GetPrimitiveArrayCritical(out, nullptr));
+    size_t frames = mel->process(pIn, static_cast<size_t>(len), pOut);
+    env->ReleasePrimitiveArrayCritical(out, pOut, 0);
+    env->ReleasePrimitiveArrayCritical(samples, pIn, JNI_ABORT);
+    return static_cast<jint>(frames);
+}
+
+JNIEXPORT jint JNICALL
+Java_com_minni_framework_core_MelSpectrogram_nativeNumFrames(JNIEnv* env, jobject obj, jint numSamples) {
+    auto* mel = getHandleMel(env, obj);
+    if (!mel) return 0;
+    return static_cast<jint>(mel->num_frames(static_cast<size_t>(numSamples)));
+}
+
+JNIEXPORT void JNICALL
+Java_com_minni_framework_core_MelSpectrogram_nativeReset(JNIEnv* env, jobject obj) {
+    auto* mel = getHandleMel(env, obj);
+    if (mel) {
+        mel->reset();
+    }
+}
+
 // ========================================================
 // VectorStore JNI Bindings
 // ========================================================
@@ -641,6 +1202,38 @@ Java_com_minni_framework_core_VectorStore_nativeLoad(JNIEnv* env, jobject obj, j
     return result ? JNI_TRUE : JNI_FALSE;
 }
 
+JNIEXPORT jint JNICALL
+Java_com_minni_framework_core_VectorStore_nativeImportNpy(JNIEnv* env, jobject obj, jstring npyPath, jstring idsPath) {
+    auto* vs = getHandleVectorStore(env, obj);
+    if (!vs) return 0;
+
+    const char* s_npy = env->GetStringUTFChars(npyPath, nullptr);
+    const char* s_ids = env->GetStringUTFChars(idsPath, nullptr);
+
+    size_t added = minni::logic::EmbeddingImporter::import_to_store(std::string(s_npy), std::string(s_ids), *vs);
+
+    env->ReleaseStringUTFChars(npyPath, s_npy);
+    env->ReleaseStringUTFChars(idsPath, s_ids);
+
+    return static_cast<jint>(added);
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_minni_framework_core_VectorStore_nativeImportNpyToFlat(JNIEnv* env, jclass clazz, jstring npyPath, jstring idsPath, jstring outPath, jboolean quantize) {
+    const char* s_npy = env->GetStringUTFChars(npyPath, nullptr);
+    const char* s_ids = env->GetStringUTFChars(idsPath, nullptr);
+    const char* s_out = env->GetStringUTFChars(outPath, nullptr);
+
+    bool result = minni::logic::EmbeddingImporter::import_to_flat(
+        std::string(s_npy), std::string(s_ids), std::string(s_out), quantize);
+
+    env->ReleaseStringUTFChars(npyPath, s_npy);
+    env->ReleaseStringUTFChars(idsPath, s_ids);
+    env->ReleaseStringUTFChars(outPath, s_out);
+
+    return result ? JNI_TRUE : JNI_FALSE;
+}
+
 // ========================================================
 // ModelRunner (GenAI) JNI Bindings
 // ========================================================
@@ -204,6 +204,7 @@ class InferenceService : Service() {
 
             val input = FloatArray(fftSize) { it.toFloat() * 0.01f }
             val window = FloatArray(fftSize) { 0.5f } // Simple window
+            val output = FloatArray(fftSize) // Reused result buffer
 
             val start = System.nanoTime()
 
@@ -212,7 +213,7 @@ class InferenceService : Service() {
             signalProcessor.applyWindow(window)
             signalProcessor.fft(false)
             signalProcessor.magnitude()
-            val output = signalProcessor.getOutput() // Retrieve result
+            signalProcessor.copyOutput(output) // Retrieve result without allocating
 
             val end = System.nanoTime()
 
@@ -19,7 +19,7 @@ import android.os.Looper
 import android.util.Log
 import androidx.core.app.ActivityCompat
 import com.minni.framework.core.RuleEngine
-import com.minni.framework.core.KalmanFilter
+import com.minni.framework.core.KalmanFilterBank
 import kotlin.random.Random
 
 /**
@@ -34,11 +34,12 @@ class WifiSensingService : Service() {
     private val handler = Handler(Looper.getMainLooper())
     private val ruleEngine by lazy { RuleEngine() }
 
-    // Kalman filters for 3 APs (mocked)
+    // One Kalman track per AP (3 mocked), updated in a single batched call
     // measurement_err=0.5m, est_err=1.0m, process_noise=0.01
-    private val kf1 by lazy { KalmanFilter(0.5f, 1.0f, 0.01f) }
-    private val kf2 by lazy { KalmanFilter(0.5f, 1.0f, 0.01f) }
-    private val kf3 by lazy { KalmanFilter(0.5f, 1.0f, 0.01f) }
+    private val kfBank by lazy { KalmanFilterBank(3, 0.5f, 1.0f, 0.01f) }
+    private val apTracks = intArrayOf(0, 1, 2)
+    private val rawDistances = FloatArray(3)
+    private val smoothDistances = FloatArray(3)
 
     // True distances (simulated)
     private var dist1 = 1.5f
@@ -70,9 +71,9 @@ class WifiSensingService : Service() {
         ruleEngine.loadRules(inferenceRules)
 
         // Initialize filters
-        kf1.reset(dist1)
-        kf2.reset(dist2)
-        kf3.reset(dist3)
+        kfBank.reset(0, dist1)
+        kfBank.reset(1, dist2)
+        kfBank.reset(2, dist3)
 
         Log.i(TAG, "WifiSensingService created. RTT Available: ${wifiRttManager?.isAvailable}")
     }
@@ -80,9 +81,7 @@ class WifiSensingService : Service() {
     override fun onDestroy() {
         super.onDestroy()
         ruleEngine.close()
-        kf1.close()
-        kf2.close()
-        kf3.close()
+        kfBank.close()
     }
 
     @SuppressLint("MissingPermission")
@@ -125,10 +124,14 @@ class WifiSensingService : Service() {
             val raw2 = dist2 + noise2
             val raw3 = dist3 + noise3
 
-            // Apply Kalman Filter
-            val smooth1 = kf1.update(raw1)
-            val smooth2 = kf2.update(raw2)
-            val smooth3 = kf3.update(raw3)
+            // Apply Kalman Filter (all APs in one native call)
+            rawDistances[0] = raw1
+            rawDistances[1] = raw2
+            rawDistances[2] = raw3
+            kfBank.update(rawDistances, apTracks, smoothDistances)
+            val smooth1 = smoothDistances[0]
+            val smooth2 = smoothDistances[1]
+            val smooth3 = smoothDistances[2]
 
             val distances = listOf(
                 "AP_1: Raw=%.2fm Smooth=%.2fm".format(raw1, smooth1),
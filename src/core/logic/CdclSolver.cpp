@@ -0,0 +1,822 @@
+#include "CdclSolver.h"
+#include "ClauseExchange.h"
+#include "DratWriter.h"
+#include <algorithm>
+
+namespace minni {
+namespace logic {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double elapsed_ms(Clock::time_point since) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - since).count();
+}
+
+// Luby sequence 1, 1, 2, 1, 1, 2, 4, 1, ... (0-based index)
+double luby(uint64_t i) {
+    uint64_t size = 1;
+    int seq = 0;
+    while (size < i + 1) {
+        ++seq;
+        size = 2 * size + 1;
+    }
+    while (size - 1 != i) {
+        size = (size - 1) >> 1;
+        --seq;
+        i = i % size;
+    }
+    return static_cast<double>(1ull << seq);
+}
+
+const double kLbdFastAlpha = 1.0 / 32.0;
+const double kLbdSlowAlpha = 1.0 / 4096.0;
+const double kGlucoseMargin = 1.25;     // Restart when recent LBD > 1.25 x long-term LBD
+const uint64_t kGlucoseMinConflicts = 50;
+const uint32_t kPollInterval = 256;     // Budget checks between two clock reads
+const uint32_t kShareLbd = 3;           // Learned clauses shared if this glue-like
+const double kGarbageFraction = 0.2;    // Compact the arena when this much of it is freed
+
+} // namespace
+
+CdclSolver::CdclSolver() : CdclSolver(Options()) {}
+
+CdclSolver::CdclSolver(const Options& options)
+    : options_(options),
+      ok_(true),
+      qhead_(0),
+      var_inc_(1.0),
+      cla_inc_(1.0),
+      stamp_(0),
+      lbd_fast_(0.0),
+      lbd_slow_(0.0),
+      next_reduce_(static_cast<uint64_t>(options.reduce_first)),
+      interrupted_(false),
+      interrupt_flag_(nullptr),
+      conflict_stop_(0),
+      propagation_stop_(0),
+      poll_(0),
+      timed_out_(false),
+      exchange_(nullptr),
+      exchange_id_(0),
+      exchange_cursor_(0),
+      rng_(options.seed * 0x9E3779B97F4A7C15ull + 1),
+      proof_(nullptr) {
+}
+
+CdclSolver::~CdclSolver() = default;
+
+uint32_t CdclSolver::new_var() {
+    const uint32_t var = static_cast<uint32_t>(assigns_.size());
+    assigns_.push_back(0);
+    level_.push_back(0);
+    reason_.push_back(kNoClause);
+    // A seeded solver starts from a random order; real bumps (>= 1) dominate at once
+    activity_.push_back(options_.seed != 0 ? 1e-3 * random_unit() : 0.0);
+    polarity_.push_back(options_.random_phase && options_.seed != 0 ? random_unit() < 0.5
+                                                                    : !options_.initial_phase);
+    heap_index_.push_back(-1);
+    seen_.push_back(0);
+    watches_.emplace_back();
+    watches_.emplace_back();
+    heap_insert(var);
+    return var;
+}
+
+uint32_t CdclSolver::num_vars() const {
+    return static_cast<uint32_t>(assigns_.size());
+}
+
+size_t CdclSolver::num_clauses() const { return clauses_.size(); }
+size_t CdclSolver::num_learnts() const { return learnts_.size(); }
+uint64_t CdclSolver::num_conflicts() const { return stats_.conflicts; }
+uint64_t CdclSolver::num_decisions() const { return stats_.decisions; }
+uint64_t CdclSolver::num_propagations() const { return stats_.propagations; }
+uint64_t CdclSolver::num_imported() const { return stats_.imported; }
+const CdclSolver::Stats& CdclSolver::stats() const { return stats_; }
+
+CdclSolver::Stats& CdclSolver::Stats::operator+=(const Stats& other) {
+    decisions += other.decisions;
+    propagations += other.propagations;
+    conflicts += other.conflicts;
+    restarts += other.restarts;
+    learned += other.learned;
+    learned_literals += other.learned_literals;
+    learned_max = std::max(learned_max, other.learned_max);
+    minimized_literals += other.minimized_literals;
+    deleted += other.deleted;
+    reductions += other.reductions;
+    garbage_collections += other.garbage_collections;
+    imported += other.imported;
+    solve_ms += other.solve_ms;
+    propagate_ms += other.propagate_ms;
+    analyze_ms += other.analyze_ms;
+    reduce_ms += other.reduce_ms;
+    return *this;
+}
+
+CdclSolver::Stats CdclSolver::Stats::operator-(const Stats& since) const {
+    Stats d = *this;   // learned_max stays: a maximum has no difference
+    d.decisions -= since.decisions;
+    d.propagations -= since.propagations;
+    d.conflicts -= since.conflicts;
+    d.restarts -= since.restarts;
+    d.learned -= since.learned;
+    d.learned_literals -= since.learned_literals;
+    d.minimized_literals -= since.minimized_literals;
+    d.deleted -= since.deleted;
+    d.reductions -= since.reductions;
+    d.garbage_collections -= since.garbage_collections;
+    d.imported -= since.imported;
+    d.solve_ms -= since.solve_ms;
+    d.propagate_ms -= since.propagate_ms;
+    d.analyze_ms -= since.analyze_ms;
+    d.reduce_ms -= since.reduce_ms;
+    return d;
+}
+
+void CdclSolver::set_proof(DratWriter* proof) {
+    proof_ = proof;
+}
+
+double CdclSolver::random_unit() {
+    // xorshift64*
+    rng_ ^= rng_ >> 12;
+    rng_ ^= rng_ << 25;
+    rng_ ^= rng_ >> 27;
+    return static_cast<double>((rng_ * 0x2545F4914F6CDD1Dull) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+bool CdclSolver::model_value(uint32_t var) const {
+    return var < model_.size() && model_[var] > 0;
+}
+
+int8_t CdclSolver::value(Lit l) const {
+    const int8_t v = assigns_[lit_var(l)];
+    return lit_negated(l) ? static_cast<int8_t>(-v) : v;
+}
+
+int CdclSolver::decision_level() const {
+    return static_cast<int>(trail_lim_.size());
+}
+
+void CdclSolver::enqueue(Lit l, CRef reason) {
+    const uint32_t var = lit_var(l);
+    assigns_[var] = lit_negated(l) ? -1 : 1;
+    level_[var] = decision_level();
+    reason_[var] = reason;
+    trail_.push_back(l);
+}
+
+bool CdclSolver::add_clause(const std::vector<Lit>& lits) {
+    return add_clause(lits.data(), lits.size());
+}
+
+bool CdclSolver::add_clause(const Lit* lits, size_t size) {
+    if (!ok_) return false;
+    cancel_until(0);
+
+    std::vector<Lit> clause(lits, lits + size);
+    if (!scopes_.empty()) {
+        // Scoped clause: (C | !s) is only active while s is assumed
+        clause.push_back(make_lit(scopes_.back(), true));
+    }
+    std::sort(clause.begin(), clause.end());
+    while (!clause.empty() && lit_var(clause.back()) >= num_vars()) new_var();
+    return insert_clause(clause, false);
+}
+
+bool CdclSolver::insert_clause(std::vector<Lit>& clause, bool learnt) {
+    // Called at level 0 with a sorted clause. Drop duplicates and literals false at
+    // level 0; skip tautologies and satisfied clauses
+    size_t j = 0;
+    Lit prev = 0;
+    bool shortened = false;
+    for (size_t i = 0; i < clause.size(); ++i) {
+        const Lit l = clause[i];
+        if (value(l) > 0 || (j > 0 && l == lit_neg(prev))) return true;
+        if (value(l) < 0) shortened = true;
+        if (value(l) < 0 || (j > 0 && l == prev)) continue;
+        clause[j++] = prev = l;
+    }
+    clause.resize(j);
+    // What is stored instead of the input clause must be in the proof (it is RUP)
+    if (proof_ && shortened) proof_->add(clause.data(), clause.size());
+
+    if (clause.empty()) {
+        ok_ = false;
+    } else if (clause.size() == 1) {
+        enqueue(clause[0], kNoClause);
+        ok_ = (propagate() == kNoClause);
+        if (!ok_ && proof_) proof_->add(nullptr, 0);
+    } else {
+        // A learned clause starts with LBD = size (imported: its real LBD is unknown)
+        const CRef c = arena_.alloc(clause.data(), static_cast<uint32_t>(clause.size()), learnt);
+        (learnt ? learnts_ : clauses_).push_back(c);
+        attach(c);
+    }
+    return ok_;
+}
+
+bool CdclSolver::import_shared() {
+    // At level 0: other solvers' clauses are implied by the same formula, so they are
+    // added as (deletable) learned clauses
+    std::vector<Lit> clause;
+    exchange_->fetch(exchange_id_, exchange_cursor_, [&](const Lit* lits, size_t size) {
+        if (!ok_) return;
+        clause.assign(lits, lits + size);
+        std::sort(clause.begin(), clause.end());
+        if (lit_var(clause.back()) >= num_vars()) return;
+        ++stats_.imported;
+        insert_clause(clause, true);
+    });
+    return ok_;
+}
+
+void CdclSolver::set_exchange(ClauseExchange* exchange, uint32_t id) {
+    exchange_ = exchange;
+    exchange_id_ = id;
+    exchange_cursor_ = 0;
+}
+
+void CdclSolver::attach(CRef c) {
+    const Lit* lits = arena_.lits(c);
+    watches_[lits[0]].push_back({c, lits[1]});
+    watches_[lits[1]].push_back({c, lits[0]});
+}
+
+CRef CdclSolver::propagate() {
+    CRef conflict = kNoClause;
+    while (qhead_ < trail_.size()) {
+        const Lit false_lit = lit_neg(trail_[qhead_++]);
+        std::vector<Watcher>& ws = watches_[false_lit];
+        ++stats_.propagations;
+
+        // Watchers are compacted in place: i reads, j writes. New watches go to other
+        // lists (never false_lit's), so the pointers stay valid.
+        Watcher* i = ws.data();
+        Watcher* j = i;
+        Watcher* const end = i + ws.size();
+        while (i != end) {
+            const Watcher w = *i++;
+            if (value(w.blocker) > 0) {
+                *j++ = w;
+                continue;
+            }
+
+            // Make sure the false literal is lits[1]
+            Lit* lits = arena_.lits(w.clause);
+            if (lits[0] == false_lit) {
+                lits[0] = lits[1];
+                lits[1] = false_lit;
+            }
+            const Lit first = lits[0];
+            const Watcher updated{w.clause, first};
+            if (first != w.blocker && value(first) > 0) {
+                *j++ = updated;
+                continue;
+            }
+
+            // Look for a new literal to watch
+            const uint32_t size = arena_.clause_size(w.clause);
+            bool moved = false;
+            for (uint32_t k = 2; k < size; ++k) {
+                if (value(lits[k]) >= 0) {
+                    lits[1] = lits[k];
+                    lits[k] = false_lit;
+                    watches_[lits[1]].push_back(updated);
+                    moved = true;
+                    break;
+                }
+            }
+            if (moved) continue;
+
+            // Unit or conflicting
+            *j++ = updated;
+            if (value(first) < 0) {
+                conflict = w.clause;
+                qhead_ = trail_.size();
+                while (i != end) *j++ = *i++;
+            } else {
+                enqueue(first, w.clause);
+            }
+        }
+        ws.resize(static_cast<size_t>(j - ws.data()));
+        if (conflict != kNoClause) break;
+    }
+    return conflict;
+}
+
+void CdclSolver::bump_var(uint32_t var) {
+    if ((activity_[var] += var_inc_) > 1e100) {
+        for (double& a : activity_) a *= 1e-100;
+        var_inc_ *= 1e-100;
+    }
+    if (heap_index_[var] >= 0) heap_up(static_cast<size_t>(heap_index_[var]));
+}
+
+void CdclSolver::bump_clause(CRef c) {
+    const float activity = arena_.activity(c) + static_cast<float>(cla_inc_);
+    arena_.set_activity(c, activity);
+    if (activity > 1e20f) {
+        for (CRef l : learnts_) arena_.set_activity(l, arena_.activity(l) * 1e-20f);
+        cla_inc_ *= 1e-20;
+    }
+}
+
+void CdclSolver::analyze(CRef conflict, int& backjump_level, uint32_t& lbd) {
+    learnt_.clear();
+    learnt_.push_back(0); // Asserting literal goes here
+
+    int open = 0;              // Current-level literals still to resolve
+    Lit p = 0;
+    bool first = true;
+    size_t index = trail_.size();
+    CRef c = conflict;
+
+    do {
+        if (arena_.learnt(c)) bump_clause(c);
+        const Lit* lits = arena_.lits(c);
+        const uint32_t size = arena_.clause_size(c);
+        for (uint32_t k = first ? 0 : 1; k < size; ++k) {
+            const Lit q = lits[k];
+            const uint32_t v = lit_var(q);
+            if (!seen_[v] && level_[v] > 0) {
+                seen_[v] = 1;
+                bump_var(v);
+                if (level_[v] >= decision_level()) {
+                    ++open;
+                } else {
+                    learnt_.push_back(q);
+                }
+            }
+        }
+        // Next literal of the current level on the trail
+        while (!seen_[lit_var(trail_[--index])]) {}
+        p = trail_[index];
+        c = reason_[lit_var(p)];
+        seen_[lit_var(p)] = 0;
+        --open;
+        first = false;
+    } while (open > 0);
+    learnt_[0] = lit_neg(p);
+
+    // Minimize: drop literals implied by other literals of the clause
+    to_clear_.assign(learnt_.begin() + 1, learnt_.end());
+    size_t j = 1;
+    for (size_t i = 1; i < learnt_.size(); ++i) {
+        if (!redundant(learnt_[i])) learnt_[j++] = learnt_[i];
+    }
+    stats_.minimized_literals += learnt_.size() - j;
+    learnt_.resize(j);
+    for (Lit l : to_clear_) seen_[lit_var(l)] = 0;
+
+    // Backjump to the second highest level; keep that literal in lits[1] for watching
+    backjump_level = 0;
+    if (learnt_.size() > 1) {
+        size_t max_i = 1;
+        for (size_t i = 2; i < learnt_.size(); ++i) {
+            if (level_[lit_var(learnt_[i])] > level_[lit_var(learnt_[max_i])]) max_i = i;
+        }
+        std::swap(learnt_[1], learnt_[max_i]);
+        backjump_level = level_[lit_var(learnt_[1])];
+    }
+
+    // Literal block distance: number of distinct decision levels
+    if (level_stamp_.size() < trail_lim_.size() + 1) level_stamp_.resize(trail_lim_.size() + 1, 0);
+    ++stamp_;
+    lbd = 0;
+    for (Lit l : learnt_) {
+        const int lv = level_[lit_var(l)];
+        if (level_stamp_[lv] != stamp_) {
+            level_stamp_[lv] = stamp_;
+            ++lbd;
+        }
+    }
+}
+
+void CdclSolver::analyze_final(Lit failed) {
+    // Walk the implication graph back from the falsified assumption to the
+    // assumptions (decisions) it depends on
+    core_.assign(1, failed);
+    if (decision_level() == 0) return;
+    seen_[lit_var(failed)] = 1;
+    for (size_t i = trail_.size(); i > trail_lim_[0]; --i) {
+        const uint32_t v = lit_var(trail_[i - 1]);
+        if (!seen_[v]) continue;
+        const CRef r = reason_[v];
+        if (r != kNoClause) {
+            const Lit* lits = arena_.lits(r);
+            for (uint32_t k = 1; k < arena_.clause_size(r); ++k) {
+                const uint32_t u = lit_var(lits[k]);
+                if (level_[u] > 0) seen_[u] = 1;
+            }
+        } else {
+            core_.push_back(trail_[i - 1]);
+        }
+        seen_[v] = 0;
+    }
+    seen_[lit_var(failed)] = 0;
+}
+
+bool CdclSolver::redundant(Lit l) const {
+    // seen_ marks the literals of the learnt clause at this point
+    const CRef r = reason_[lit_var(l)];
+    if (r == kNoClause) return false;
+    const Lit* lits = arena_.lits(r);
+    for (uint32_t k = 1; k < arena_.clause_size(r); ++k) {
+        const uint32_t v = lit_var(lits[k]);
+        if (!seen_[v] && level_[v] > 0) return false;
+    }
+    return true;
+}
+
+void CdclSolver::cancel_until(int level) {
+    if (decision_level() <= level) return;
+    const size_t keep = trail_lim_[level];
+    for (size_t i = trail_.size(); i > keep; --i) {
+        const Lit l = trail_[i - 1];
+        const uint32_t v = lit_var(l);
+        polarity_[v] = lit_negated(l);
+        assigns_[v] = 0;
+        reason_[v] = kNoClause;
+        if (heap_index_[v] < 0) heap_insert(v);
+    }
+    trail_.resize(keep);
+    trail_lim_.resize(level);
+    qhead_ = keep;
+}
+
+Lit CdclSolver::pick_branch() {
+    if (options_.random_branch > 0.0 && !heap_.empty() && random_unit() < options_.random_branch) {
+        const uint32_t v = heap_[static_cast<size_t>(random_unit() * heap_.size())];
+        if (assigns_[v] == 0) return make_lit(v, polarity_[v]);
+    }
+    while (!heap_.empty()) {
+        const uint32_t v = heap_pop();
+        if (assigns_[v] == 0) return make_lit(v, polarity_[v]);
+    }
+    return static_cast<Lit>(-1);
+}
+
+bool CdclSolver::locked(CRef c) const {
+    const Lit l = arena_.lits(c)[0];
+    return reason_[lit_var(l)] == c && value(l) > 0;
+}
+
+void CdclSolver::reduce_db() {
+    // Glue clauses (LBD <= 2) and reasons stay; the worse half of the rest goes
+    std::vector<CRef> candidates;
+    candidates.reserve(learnts_.size());
+    for (CRef c : learnts_) {
+        if (arena_.lbd(c) > 2 && !locked(c)) candidates.push_back(c);
+    }
+    std::sort(candidates.begin(), candidates.end(), [this](CRef a, CRef b) {
+        if (arena_.lbd(a) != arena_.lbd(b)) return arena_.lbd(a) > arena_.lbd(b);
+        return arena_.activity(a) < arena_.activity(b);
+    });
+    const size_t remove = candidates.size() / 2;
+    if (remove == 0) return;
+    for (size_t i = 0; i < remove; ++i) {
+        if (proof_) proof_->remove(arena_.lits(candidates[i]), arena_.clause_size(candidates[i]));
+        arena_.free(candidates[i]);
+    }
+    stats_.deleted += remove;
+
+    for (std::vector<Watcher>& ws : watches_) {
+        ws.erase(std::remove_if(ws.begin(), ws.end(),
+                                [this](const Watcher& w) { return arena_.deleted(w.clause); }),
+                 ws.end());
+    }
+    learnts_.erase(std::remove_if(learnts_.begin(), learnts_.end(),
+                                  [this](CRef c) { return arena_.deleted(c); }),
+                   learnts_.end());
+    if (arena_.wasted() > kGarbageFraction * arena_.size()) garbage_collect();
+}
+
+void CdclSolver::garbage_collect() {
+    // Copy the live clauses into a fresh arena, originals first and in order so that
+    // clauses added together stay together, then redirect watchers and reasons
+    ++stats_.garbage_collections;
+    ClauseArena to;
+    to.reserve(arena_.size() - arena_.wasted());
+    for (CRef& c : clauses_) arena_.move_to(to, c);
+    for (CRef& c : learnts_) arena_.move_to(to, c);
+    for (std::vector<Watcher>& ws : watches_) {
+        for (Watcher& w : ws) arena_.move_to(to, w.clause);
+    }
+    for (Lit l : trail_) {
+        CRef& r = reason_[lit_var(l)];
+        if (r != kNoClause) arena_.move_to(to, r);
+    }
+    arena_ = std::move(to);
+}
+
+SolverStatus CdclSolver::search(uint64_t conflict_limit) {
+    uint64_t conflicts_here = 0;
+    const bool timing = options_.timing;
+    for (;;) {
+        const Clock::time_point propagate_start = timing ? Clock::now() : Clock::time_point();
+        const CRef conflict = propagate();
+        if (timing) stats_.propagate_ms += elapsed_ms(propagate_start);
+        if (conflict != kNoClause) {
+            ++stats_.conflicts;
+            ++conflicts_here;
+            if (decision_level() == 0) {
+                ok_ = false;
+                if (proof_) proof_->add(nullptr, 0);
+                return SolverStatus::UNSATISFIABLE;
+            }
+
+            int backjump_level = 0;
+            uint32_t lbd = 0;
+            const Clock::time_point analyze_start = timing ? Clock::now() : Clock::time_point();
+            analyze(conflict, backjump_level, lbd);
+            cancel_until(backjump_level);
+            if (timing) stats_.analyze_ms += elapsed_ms(analyze_start);
+
+            ++stats_.learned;
+            stats_.learned_literals += learnt_.size();
+            stats_.learned_max = std::max<uint64_t>(stats_.learned_max, learnt_.size());
+            if (proof_) proof_->add(learnt_.data(), learnt_.size());
+            if (exchange_ && lbd <= kShareLbd && learnt_.size() <= ClauseExchange::kMaxSize) {
+                exchange_->publish(exchange_id_, learnt_.data(), learnt_.size());
+            }
+            if (learnt_.size() == 1) {
+                enqueue(learnt_[0], kNoClause);
+            } else {
+                const CRef c = arena_.alloc(learnt_.data(), static_cast<uint32_t>(learnt_.size()), true);
+                arena_.set_lbd(c, lbd);
+                learnts_.push_back(c);
+                attach(c);
+                bump_clause(c);
+                enqueue(learnt_[0], c);
+            }
+
+            var_inc_ /= options_.var_decay;
+            cla_inc_ /= options_.clause_decay;
+            if (stats_.conflicts == 1) lbd_slow_ = lbd_fast_ = lbd;
+            lbd_fast_ += kLbdFastAlpha * (lbd - lbd_fast_);
+            lbd_slow_ += kLbdSlowAlpha * (lbd - lbd_slow_);
+            if (out_of_budget()) return SolverStatus::TIMEOUT;
+            continue;
+        }
+        if (out_of_budget()) return SolverStatus::TIMEOUT;
+
+        // No conflict: restart, reduce, or decide
+        const bool restart = options_.restart == Restart::LUBY
+            ? conflicts_here >= conflict_limit
+            : conflicts_here >= kGlucoseMinConflicts && lbd_fast_ > kGlucoseMargin * lbd_slow_;
+        if (restart) {
+            ++stats_.restarts;
+            cancel_until(0);
+            return SolverStatus::UNKNOWN;
+        }
+        if (stats_.conflicts >= next_reduce_) {
+            ++stats_.reductions;
+            next_reduce_ = stats_.conflicts + options_.reduce_first + stats_.reductions * options_.reduce_increment;
+            const Clock::time_point reduce_start = timing ? Clock::now() : Clock::time_point();
+            reduce_db();
+            if (timing) stats_.reduce_ms += elapsed_ms(reduce_start);
+        }
+
+        // Assumptions first, one decision level each
+        Lit next = static_cast<Lit>(-1);
+        while (static_cast<size_t>(decision_level()) < assumptions_.size()) {
+            const Lit a = assumptions_[decision_level()];
+            if (value(a) > 0) {
+                trail_lim_.push_back(trail_.size());   // Already true: empty level
+            } else if (value(a) < 0) {
+                analyze_final(a);
+                return SolverStatus::UNSATISFIABLE;
+            } else {
+                next = a;
+                break;
+            }
+        }
+        if (next == static_cast<Lit>(-1)) {
+            next = pick_branch();
+            if (next == static_cast<Lit>(-1)) {
+                model_.assign(assigns_.begin(), assigns_.end());
+                return SolverStatus::SATISFIABLE;
+            }
+        }
+        ++stats_.decisions;
+        trail_lim_.push_back(trail_.size());
+        enqueue(next, kNoClause);
+    }
+}
+
+bool CdclSolver::out_of_budget() {
+    if (interrupted_.load(std::memory_order_relaxed)) return true;
+    if (interrupt_flag_ && interrupt_flag_->load(std::memory_order_relaxed)) return true;
+    if (stats_.conflicts >= conflict_stop_ || stats_.propagations >= propagation_stop_) return true;
+    if (limits_.timeout_ms > 0 && ++poll_ >= kPollInterval) {
+        poll_ = 0;
+        if (std::chrono::steady_clock::now() >= deadline_) {
+            timed_out_ = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+SolverStatus CdclSolver::solve() {
+    return solve(nullptr, 0);
+}
+
+SolverStatus CdclSolver::solve(const std::vector<Lit>& assumptions) {
+    return solve(assumptions.data(), assumptions.size());
+}
+
+SolverStatus CdclSolver::solve(const Lit* assumptions, size_t size) {
+    model_.clear();
+    core_.clear();
+    if (!ok_) return SolverStatus::UNSATISFIABLE;
+    const Clock::time_point start = Clock::now();
+
+    assumptions_.clear();
+    for (uint32_t s : scopes_) assumptions_.push_back(make_lit(s));
+    for (size_t i = 0; i < size; ++i) {
+        while (lit_var(assumptions[i]) >= num_vars()) new_var();
+        assumptions_.push_back(assumptions[i]);
+    }
+
+    const uint64_t unlimited = ~0ull;
+    conflict_stop_ = limits_.conflicts > 0 ? stats_.conflicts + limits_.conflicts : unlimited;
+    propagation_stop_ = limits_.propagations > 0 ? stats_.propagations + limits_.propagations : unlimited;
+    deadline_ = std::chrono::steady_clock::now() + std::chrono::milliseconds(limits_.timeout_ms);
+    poll_ = 0;
+    timed_out_ = false;
+
+    SolverStatus status = SolverStatus::UNKNOWN;
+    for (uint64_t restarts = 0; status == SolverStatus::UNKNOWN; ++restarts) {
+        if (exchange_ && !import_shared()) {
+            status = SolverStatus::UNSATISFIABLE;
+            break;
+        }
+        const uint64_t limit = static_cast<uint64_t>(luby(restarts) * options_.luby_unit);
+        status = search(limit);
+    }
+    cancel_until(0);
+    stats_.solve_ms += elapsed_ms(start);
+    if (status == SolverStatus::TIMEOUT) {
+        // search() stopped on a budget: only the wall clock is reported as TIMEOUT
+        core_.clear();
+        return timed_out_ ? SolverStatus::TIMEOUT : SolverStatus::UNKNOWN;
+    }
+
+    // Scope selectors are an implementation detail: keep only the caller's literals
+    if (!scopes_.empty()) {
+        core_.erase(std::remove_if(core_.begin(), core_.end(), [this](Lit l) {
+                        return std::find(scopes_.begin(), scopes_.end(), lit_var(l)) != scopes_.end();
+                    }),
+                    core_.end());
+    }
+    return status;
+}
+
+const std::vector<Lit>& CdclSolver::core() const {
+    return core_;
+}
+
+void CdclSolver::push() {
+    if (free_selectors_.empty()) {
+        scopes_.push_back(new_var());
+    } else {
+        scopes_.push_back(free_selectors_.back());
+        free_selectors_.pop_back();
+    }
+}
+
+bool CdclSolver::pop() {
+    if (scopes_.empty()) return false;
+    const uint32_t selector = scopes_.back();
+    scopes_.pop_back();
+    cancel_until(0);
+    // Clauses other workers learned in this scope must not arrive once the selector
+    // is reused: take them in now so they are deleted with the rest
+    if (exchange_) import_shared();
+
+    // The selector is only ever assumed, so resolution never removes !s: the scope's
+    // clauses and every clause learned from them are exactly those containing it
+    const Lit off = make_lit(selector, true);
+    std::vector<Lit> dirty;
+    for (std::vector<CRef>* list : {&clauses_, &learnts_}) {
+        for (CRef c : *list) {
+            const Lit* lits = arena_.lits(c);
+            const uint32_t size = arena_.clause_size(c);
+            if (std::find(lits, lits + size, off) == lits + size) continue;
+            if (proof_) proof_->remove(lits, size);
+            dirty.push_back(lits[0]);
+            dirty.push_back(lits[1]);
+            arena_.free(c);
+        }
+        list->erase(std::remove_if(list->begin(), list->end(), [this](CRef c) { return arena_.deleted(c); }),
+                    list->end());
+    }
+    std::sort(dirty.begin(), dirty.end());
+    dirty.erase(std::unique(dirty.begin(), dirty.end()), dirty.end());
+    for (Lit l : dirty) {
+        std::vector<Watcher>& ws = watches_[l];
+        ws.erase(std::remove_if(ws.begin(), ws.end(),
+                                [this](const Watcher& w) { return arena_.deleted(w.clause); }),
+                 ws.end());
+    }
+
+    // A scope inconsistent at level 0 left !s on the trail. Nothing else follows from
+    // it (no clause contains s), so it can simply be taken back.
+    if (assigns_[selector] != 0) {
+        if (proof_) proof_->remove(&off, 1);
+        const size_t pos = static_cast<size_t>(std::find(trail_.begin(), trail_.end(), off) - trail_.begin());
+        trail_.erase(trail_.begin() + pos);
+        if (pos < qhead_) --qhead_;
+        assigns_[selector] = 0;
+        reason_[selector] = kNoClause;
+        if (heap_index_[selector] < 0) heap_insert(selector);
+    }
+    free_selectors_.push_back(selector);
+
+    if (arena_.wasted() > kGarbageFraction * arena_.size()) garbage_collect();
+    return true;
+}
+
+size_t CdclSolver::scope_depth() const {
+    return scopes_.size();
+}
+
+void CdclSolver::set_limits(const Limits& limits) {
+    limits_ = limits;
+}
+
+const CdclSolver::Limits& CdclSolver::limits() const {
+    return limits_;
+}
+
+void CdclSolver::interrupt() {
+    interrupted_.store(true, std::memory_order_relaxed);
+}
+
+void CdclSolver::clear_interrupt() {
+    interrupted_.store(false, std::memory_order_relaxed);
+}
+
+void CdclSolver::set_interrupt_flag(const std::atomic<bool>* flag) {
+    interrupt_flag_ = flag;
+}
+
+// ---------------------------------------------------------------------------
+// Variable heap (max activity on top)
+// ---------------------------------------------------------------------------
+
+void CdclSolver::heap_insert(uint32_t var) {
+    heap_index_[var] = static_cast<int>(heap_.size());
+    heap_.push_back(var);
+    heap_up(heap_.size() - 1);
+}
+
+void CdclSolver::heap_up(size_t pos) {
+    const uint32_t var = heap_[pos];
+    while (pos > 0) {
+        const size_t parent = (pos - 1) / 2;
+        if (activity_[heap_[parent]] >= activity_[var]) break;
+        heap_[pos] = heap_[parent];
+        heap_index_[heap_[pos]] = static_cast<int>(pos);
+        pos = parent;
+    }
+    heap_[pos] = var;
+    heap_index_[var] = static_cast<int>(pos);
+}
+
+void CdclSolver::heap_down(size_t pos) {
+    const uint32_t var = heap_[pos];
+    const size_t n = heap_.size();
+    for (;;) {
+        size_t child = 2 * pos + 1;
+        if (child >= n) break;
+        if (child + 1 < n && activity_[heap_[child + 1]] > activity_[heap_[child]]) ++child;
+        if (activity_[heap_[child]] <= activity_[var]) break;
+        heap_[pos] = heap_[child];
+        heap_index_[heap_[pos]] = static_cast<int>(pos);
+        pos = child;
+    }
+    heap_[pos] = var;
+    heap_index_[var] = static_cast<int>(pos);
+}
+
+uint32_t CdclSolver::heap_pop() {
+    const uint32_t top = heap_[0];
+    heap_index_[top] = -1;
+    const uint32_t last = heap_.back();
+    heap_.pop_back();
+    if (!heap_.empty()) {
+        heap_[0] = last;
+        heap_index_[last] = 0;
+        heap_down(0);
+    }
+    return top;
+}
+
+} // namespace logic
+} // namespace minni
@@ -0,0 +1,316 @@
+#ifndef MINNI_CORE_LOGIC_CDCL_SOLVER_H_
+#define MINNI_CORE_LOGIC_CDCL_SOLVER_H_
+
+#include "SolverInterface.h"
+#include "ClauseArena.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace minni {
+namespace logic {
+
+class ClauseExchange;
+class DratWriter;
+
+/**
+ * Integer literal: 2 * var + (negated ? 1 : 0). Variables are dense 0-based ids
+ * handed out by CdclSolver::new_var().
+ */
+using Lit = uint32_t;
+
+inline Lit make_lit(uint32_t var, bool negated = false) { return (var << 1) | (negated ? 1u : 0u); }
+inline uint32_t lit_var(Lit l) { return l >> 1; }
+inline bool lit_negated(Lit l) { return (l & 1u) != 0; }
+inline Lit lit_neg(Lit l) { return l ^ 1u; }
+
+/**
+ * Conflict-driven clause-learning SAT engine over integer literals.
+ *
+ * - Two-watched-literal unit propagation with blocker literals.
+ * - First-UIP conflict analysis with clause minimization, non-chronological backjumping.
+ * - EVSIDS branching (exponentially growing bump, binary heap) with phase saving.
+ * - Luby or glucose-style (LBD moving average) restarts.
+ * - Periodic deletion of learned clauses, keeping low-LBD ("glue") clauses.
+ * - All clauses in one ClauseArena (flat 32-bit words, offset references); freed
+ *   clauses are compacted away once they waste a fifth of it.
+ *
+ * Incremental: clauses can be added between solve() calls, solve() takes assumption
+ * literals (decided first, MiniSat style) and reports the failed ones as an UNSAT core,
+ * and push()/pop() scope clauses through activation literals. Learned clauses
+ * are kept across all of these, except those derived from a popped scope.
+ *
+ * Resource limits: every solve() call can be bounded by wall-clock time and by
+ * conflict / propagation counts (set_limits()), and interrupt() stops a running
+ * solve() from any thread. The search polls these between conflicts and decisions.
+ *
+ * Instrumentation: stats() counts the search as it goes; Options::timing adds
+ * per-phase timers, and set_proof() streams a DRAT proof. Both are off by default
+ * and cost one predictable branch per event when off.
+ */
+class CdclSolver {
+public:
+    enum class Restart {
+        LUBY,
+        GLUCOSE
+    };
+
+    struct Options {
+        Restart restart = Restart::GLUCOSE;
+        int luby_unit = 100;          // Conflicts per Luby unit
+        double var_decay = 0.95;      // EVSIDS decay
+        double clause_decay = 0.999;  // Learned clause activity decay
+        bool initial_phase = false;   // Polarity of first decisions (then phase saving)
+        int reduce_first = 2000;      // Conflicts before the first learned clause reduction
+        int reduce_increment = 300;   // Growth of the reduction interval
+
+        // Diversification (portfolio workers); the defaults are fully deterministic
+        uint64_t seed = 0;            // Nonzero: random initial variable order
+        bool random_phase = false;    // Random initial polarity (needs seed)
+        double random_branch = 0.0;   // Fraction of decisions on a random variable
+
+        bool timing = false;          // Time propagation / analysis / reduction (Stats)
+    };
+
+    /**
+     * Totals since construction. propagate_ms, analyze_ms and reduce_ms need
+     * Options::timing; solve_ms is always measured.
+     */
+    struct Stats {
+        uint64_t decisions = 0;
+        uint64_t propagations = 0;
+        uint64_t conflicts = 0;
+        uint64_t restarts = 0;
+        uint64_t learned = 0;              // Learned clauses, units included
+        uint64_t learned_literals = 0;     // Their total size after minimization
+        uint64_t learned_max = 0;          // Longest learned clause
+        uint64_t minimized_literals = 0;   // Removed by clause minimization
+        uint64_t deleted = 0;              // Learned clauses dropped by reductions
+        uint64_t reductions = 0;
+        uint64_t garbage_collections = 0;  // Arena compactions
+        uint64_t imported = 0;             // Clauses from other portfolio workers
+        double solve_ms = 0.0;
+        double propagate_ms = 0.0;
+        double analyze_ms = 0.0;
+        double reduce_ms = 0.0;            // Reductions and compactions
+
+        Stats& operator+=(const Stats& other);
+        Stats operator-(const Stats& since) const;
+    };
+
+    /**
+     * Per-call budgets; 0 means unlimited. Counts are relative to the start of each
+     * solve() call. An exhausted time limit yields TIMEOUT, a count budget UNKNOWN.
+     */
+    struct Limits {
+        uint64_t timeout_ms = 0;
+        uint64_t conflicts = 0;
+        uint64_t propagations = 0;
+    };
+
+    CdclSolver();
+    explicit CdclSolver(const Options& options);
+    ~CdclSolver();
+
+    CdclSolver(const CdclSolver&) = delete;
+    CdclSolver& operator=(const CdclSolver&) = delete;
+
+    /**
+     * Create a new variable.
+     * @return Its id (num_vars() - 1).
+     */
+    uint32_t new_var();
+    uint32_t num_vars() const;
+
+    /**
+     * Add a clause (disjunction of literals). Variables beyond num_vars() are created.
+     * Duplicate literals and tautologies are handled.
+     * @return false if the formula is now trivially unsatisfiable.
+     */
+    bool add_clause(const Lit* lits, size_t size);
+    bool add_clause(const std::vector<Lit>& lits);
+
+    /**
+     * Search for a satisfying assignment of all clauses added so far.
+     * @return SATISFIABLE or UNSATISFIABLE; TIMEOUT / UNKNOWN when stopped by the
+     *         time limit / a count budget or interrupt() (see set_limits()).
+     */
+    SolverStatus solve();
+
+    /**
+     * Solve with the given literals forced true for this call only.
+     * On UNSATISFIABLE, core() holds the assumptions responsible.
+     */
+    SolverStatus solve(const Lit* assumptions, size_t size);
+    SolverStatus solve(const std::vector<Lit>& assumptions);
+
+    /**
+     * Subset of the last call's assumptions that cannot all hold together (not
+     * necessarily minimal). Empty if the clauses are UNSAT without any assumption.
+     */
+    const std::vector<Lit>& core() const;
+
+    /**
+     * Open a scope: clauses added until the matching pop() are removed by it.
+     */
+    void push();
+
+    /**
+     * Close the innermost scope: delete its clauses and every clause learned from
+     * them, and keep its activation variable for the next push().
+     * @return false if no scope is open.
+     */
+    bool pop();
+    size_t scope_depth() const;
+
+    void set_limits(const Limits& limits);
+    const Limits& limits() const;
+
+    /**
+     * Ask a running solve() to stop; it returns UNKNOWN at its next check.
+     * Thread-safe. The request stays pending (a solve() started later returns
+     * UNKNOWN at once) until clear_interrupt().
+     */
+    void interrupt();
+    void clear_interrupt();
+
+    /**
+     * Also stop when *flag becomes true (nullptr to detach). Lets one flag cancel
+     * several solvers; the flag must outlive its use by solve().
+     */
+    void set_interrupt_flag(const std::atomic<bool>* flag);
+
+    /**
+     * Share short learned clauses through `exchange` as reader/producer `id`: clauses
+     * learned here are published, and clauses from other solvers are imported at
+     * restarts. All solvers on one exchange must have the same variables and clauses.
+     */
+    void set_exchange(ClauseExchange* exchange, uint32_t id);
+    uint64_t num_imported() const;
+
+    /**
+     * Write a DRAT proof of everything the solver derives from here on (nullptr to
+     * stop); attach it before adding clauses. Imported clauses are not RUP in this
+     * solver's proof, so do not combine with set_exchange().
+     */
+    void set_proof(DratWriter* proof);
+
+    /**
+     * Value of var in the last model (valid after solve() returned SATISFIABLE).
+     */
+    bool model_value(uint32_t var) const;
+
+    size_t num_clauses() const;
+    size_t num_learnts() const;
+    uint64_t num_conflicts() const;
+    uint64_t num_decisions() const;
+    uint64_t num_propagations() const;
+    const Stats& stats() const;
+
+private:
+    // Clause literals live in arena_; lits[0] is the implied literal when the clause
+    // is a reason, and lits[0..1] are the watched ones
+    struct Watcher {
+        CRef clause;
+        Lit blocker;            // Some other literal of the clause: if true, skip the clause
+    };
+
+    Options options_;
+    Limits limits_;
+    bool ok_;                   // false once the clause set is UNSAT at level 0
+
+    // Clause database
+    ClauseArena arena_;
+    std::vector<CRef> clauses_;
+    std::vector<CRef> learnts_;
+    std::vector<std::vector<Watcher>> watches_;  // watches_[l]: clauses watching literal l
+
+    // Assignment (indexed by variable): +1 true, -1 false, 0 unassigned
+    std::vector<int8_t> assigns_;
+    std::vector<int> level_;
+    std::vector<CRef> reason_;       // kNoClause for decisions and level-0 units
+    std::vector<Lit> trail_;
+    std::vector<size_t> trail_lim_;  // Trail size at the start of each decision level
+    size_t qhead_;
+
+    // Branching
+    std::vector<double> activity_;
+    double var_inc_;
+    double cla_inc_;
+    std::vector<bool> polarity_;     // Saved phase (true = assign negated literal)
+    std::vector<uint32_t> heap_;     // Max-heap of variables by activity
+    std::vector<int> heap_index_;    // Position in heap_, -1 if absent
+
+    // Conflict analysis scratch
+    std::vector<uint8_t> seen_;
+    std::vector<Lit> learnt_;
+    std::vector<Lit> to_clear_;
+    std::vector<uint64_t> level_stamp_;
+    uint64_t stamp_;
+
+    // Restarts and reduction
+    double lbd_fast_;
+    double lbd_slow_;
+    uint64_t next_reduce_;
+
+    // Assumptions of the current call: active scope selectors, then the caller's
+    std::vector<Lit> assumptions_;
+    std::vector<uint32_t> scopes_;   // Activation variable of each open scope
+    std::vector<uint32_t> free_selectors_;  // Activation variables of closed scopes, reused
+    std::vector<Lit> core_;
+
+    // Budgets of the current call
+    std::atomic<bool> interrupted_;
+    const std::atomic<bool>* interrupt_flag_;
+    std::chrono::steady_clock::time_point deadline_;
+    uint64_t conflict_stop_;
+    uint64_t propagation_stop_;
+    uint32_t poll_;                  // Clock reads are amortized over kPollInterval checks
+    bool timed_out_;
+
+    // Clause sharing and diversification
+    ClauseExchange* exchange_;
+    uint32_t exchange_id_;
+    uint64_t exchange_cursor_;
+    uint64_t rng_;
+
+    DratWriter* proof_;
+
+    // Result
+    std::vector<int8_t> model_;
+
+    Stats stats_;
+
+    int8_t value(Lit l) const;
+    int decision_level() const;
+    void enqueue(Lit l, CRef reason);
+    CRef propagate();
+    void analyze(CRef conflict, int& backjump_level, uint32_t& lbd);
+    void analyze_final(Lit failed);
+    bool redundant(Lit l) const;
+    void cancel_until(int level);
+    Lit pick_branch();
+    void attach(CRef c);
+    bool insert_clause(std::vector<Lit>& clause, bool learnt);
+    bool import_shared();
+    double random_unit();
+    bool locked(CRef c) const;
+    void reduce_db();
+    void garbage_collect();
+    void bump_var(uint32_t var);
+    void bump_clause(CRef c);
+    SolverStatus search(uint64_t conflict_limit);
+    bool out_of_budget();
+
+    void heap_insert(uint32_t var);
+    void heap_up(size_t pos);
+    void heap_down(size_t pos);
+    uint32_t heap_pop();
+};
+
+} // namespace logic
+} // namespace minni
+
+#endif // MINNI_CORE_LOGIC_CDCL_SOLVER_H_
@@ -0,0 +1,70 @@
+#include "ClauseArena.h"
+
+namespace minni {
+namespace logic {
+
+namespace {
+
+const uint32_t kLearnt = 1u;
+const uint32_t kDeleted = 2u;
+const uint32_t kReloced = 4u;
+
+} // namespace
+
+ClauseArena::ClauseArena() : wasted_(0) {}
+
+CRef ClauseArena::alloc(const uint32_t* lits, uint32_t size, bool learnt) {
+    const CRef c = static_cast<CRef>(words_.size());
+    words_.push_back(size << 3 | (learnt ? kLearnt : 0u));
+    words_.insert(words_.end(), lits, lits + size);
+    if (learnt) {
+        words_.push_back(size);   // LBD until the caller knows better
+        words_.push_back(0);      // Activity 0.0f
+    }
+    return c;
+}
+
+void ClauseArena::free(CRef c) {
+    if (deleted(c)) return;
+    words_[c] |= kDeleted;
+    wasted_ += footprint(clause_size(c), learnt(c));
+}
+
+void ClauseArena::move_to(ClauseArena& to, CRef& ref) {
+    const CRef c = ref;
+    if (words_[c] & kReloced) {
+        ref = words_[c + 1];
+        return;
+    }
+    const uint32_t size = clause_size(c);
+    const bool is_learnt = learnt(c);
+    const CRef copy = to.alloc(lits(c), size, is_learnt);
+    if (is_learnt) {
+        to.set_lbd(copy, lbd(c));
+        to.set_activity(copy, activity(c));
+    }
+    // Leave a forwarding reference where the first literal was
+    words_[c] |= kReloced;
+    words_[c + 1] = copy;
+    ref = copy;
+}
+
+size_t ClauseArena::size() const {
+    return words_.size();
+}
+
+size_t ClauseArena::wasted() const {
+    return wasted_;
+}
+
+void ClauseArena::reserve(size_t words) {
+    words_.reserve(words);
+}
+
+void ClauseArena::clear() {
+    words_.clear();
+    wasted_ = 0;
+}
+
+} // namespace logic
+} // namespace minni
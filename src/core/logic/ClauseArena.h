@@ -0,0 +1,85 @@
+#ifndef MINNI_CORE_LOGIC_CLAUSE_ARENA_H_
+#define MINNI_CORE_LOGIC_CLAUSE_ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace minni {
+namespace logic {
+
+/**
+ * Clause reference: word offset of a clause in its ClauseArena.
+ */
+using CRef = uint32_t;
+const CRef kNoClause = ~static_cast<CRef>(0);
+
+/**
+ * Flat clause storage for the CDCL engine: every clause lives in one contiguous
+ * buffer of 32-bit words, so propagation walks memory instead of chasing one heap
+ * allocation per clause, and a clause reference is a 4-byte offset.
+ *
+ * Layout of a clause at offset c:
+ *   words[c]                 size << 3 | reloced << 2 | deleted << 1 | learnt
+ *   words[c + 1 ...]         the literals
+ *   words[c + 1 + size]      LBD       (learnt clauses only)
+ *   words[c + 2 + size]      activity  (learnt clauses only, float bits)
+ * Keeping the literals right after the header means the hot path never branches on
+ * the clause kind.
+ *
+ * free() only marks a clause; the space is reclaimed by copying the live clauses
+ * into a fresh arena (move_to() for each reference, then replace the old arena),
+ * which the owner does once wasted() passes a fraction of size().
+ *
+ * Pointers from lits() are invalidated by alloc(); references stay valid until the
+ * next compaction.
+ */
+class ClauseArena {
+public:
+    ClauseArena();
+
+    CRef alloc(const uint32_t* lits, uint32_t size, bool learnt);
+    void free(CRef c);
+
+    uint32_t* lits(CRef c) { return &words_[c + 1]; }
+    const uint32_t* lits(CRef c) const { return &words_[c + 1]; }
+    uint32_t clause_size(CRef c) const { return words_[c] >> 3; }
+    bool learnt(CRef c) const { return (words_[c] & 1u) != 0; }
+    bool deleted(CRef c) const { return (words_[c] & 2u) != 0; }
+
+    uint32_t lbd(CRef c) const { return words_[c + 1 + clause_size(c)]; }
+    void set_lbd(CRef c, uint32_t lbd) { words_[c + 1 + clause_size(c)] = lbd; }
+    float activity(CRef c) const {
+        float a;
+        std::memcpy(&a, &words_[c + 2 + clause_size(c)], sizeof(a));
+        return a;
+    }
+    void set_activity(CRef c, float a) { std::memcpy(&words_[c + 2 + clause_size(c)], &a, sizeof(a)); }
+
+    /**
+     * Copy clause `ref` into `to` (once: later calls for the same clause return the
+     * same copy through a forwarding reference) and update `ref`.
+     */
+    void move_to(ClauseArena& to, CRef& ref);
+
+    /**
+     * Words in use (live and freed) and words held by freed clauses.
+     */
+    size_t size() const;
+    size_t wasted() const;
+
+    void reserve(size_t words);
+    void clear();
+
+private:
+    std::vector<uint32_t> words_;
+    size_t wasted_;
+
+    static uint32_t footprint(uint32_t size, bool learnt) { return 1 + size + (learnt ? 2 : 0); }
+};
+
+} // namespace logic
+} // namespace minni
+
+#endif // MINNI_CORE_LOGIC_CLAUSE_ARENA_H_
@@ -0,0 +1,67 @@
+#include "ClauseExchange.h"
+
+namespace minni {
+namespace logic {
+
+ClauseExchange::ClauseExchange(size_t capacity) : head_(0) {
+    size_t n = 1;
+    while (n < capacity) n <<= 1;
+    slots_.reset(new Slot[n]);
+    mask_ = n - 1;
+}
+
+size_t ClauseExchange::capacity() const {
+    return mask_ + 1;
+}
+
+bool ClauseExchange::publish(uint32_t producer, const Lit* lits, size_t size) {
+    if (size == 0 || size > kMaxSize) return false;
+    const uint64_t ticket = head_.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = slots_[ticket & mask_];
+
+    // Claim the slot unless a writer from another lap is still on it (or already
+    // past us): then drop the clause rather than wait
+    uint64_t seq = slot.seq.load(std::memory_order_relaxed);
+    if ((seq & 1) || seq > 2 * ticket) return false;
+    if (!slot.seq.compare_exchange_strong(seq, 2 * ticket + 1, std::memory_order_relaxed)) {
+        return false;
+    }
+    std::atomic_thread_fence(std::memory_order_release);
+
+    slot.producer.store(producer, std::memory_order_relaxed);
+    slot.size.store(static_cast<uint32_t>(size), std::memory_order_relaxed);
+    for (size_t i = 0; i < size; ++i) slot.lits[i].store(lits[i], std::memory_order_relaxed);
+    slot.seq.store(2 * ticket + 2, std::memory_order_release);
+    return true;
+}
+
+size_t ClauseExchange::fetch(uint32_t consumer, uint64_t& cursor, const ClauseHandler& on_clause) const {
+    const uint64_t head = head_.load(std::memory_order_acquire);
+    // Slots more than one lap behind have been overwritten
+    if (head - cursor > capacity()) cursor = head - capacity();
+
+    Lit lits[kMaxSize];
+    size_t delivered = 0;
+    for (; cursor < head; ++cursor) {
+        const Slot& slot = slots_[cursor & mask_];
+        const uint64_t seq = slot.seq.load(std::memory_order_acquire);
+        if (seq != 2 * cursor + 2) continue;   // Still being written, dropped or overwritten
+
+        const uint32_t producer = slot.producer.load(std::memory_order_relaxed);
+        const size_t size = slot.size.load(std::memory_order_relaxed);
+        if (size == 0 || size > kMaxSize) continue;
+        for (size_t i = 0; i < size; ++i) lits[i] = slot.lits[i].load(std::memory_order_relaxed);
+
+        // Seqlock validation: discard a copy torn by a concurrent overwrite
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.seq.load(std::memory_order_relaxed) != seq) continue;
+        if (producer == consumer) continue;
+
+        on_clause(lits, size);
+        ++delivered;
+    }
+    return delivered;
+}
+
+} // namespace logic
+} // namespace minni
@@ -0,0 +1,67 @@
+#ifndef MINNI_CORE_LOGIC_CLAUSE_EXCHANGE_H_
+#define MINNI_CORE_LOGIC_CLAUSE_EXCHANGE_H_
+
+#include "CdclSolver.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace minni {
+namespace logic {
+
+/**
+ * Lock-free bounded broadcast buffer for sharing short learned clauses between
+ * solver threads (see PortfolioSolver).
+ *
+ * A ring of fixed-size slots: publishing claims the next ticket with one fetch_add
+ * and writes the slot under a per-slot sequence number (seqlock), so producers never
+ * wait and readers never block producers. Every reader keeps its own cursor and sees
+ * each clause at most once. Sharing is lossy by design: a clause overwritten before a
+ * slow reader gets to it, or whose slot is busy, is simply skipped; clauses are only
+ * hints since every solver can derive them itself.
+ */
+class ClauseExchange {
+public:
+    static const size_t kMaxSize = 8;   // Longest clause that can be shared
+
+    using ClauseHandler = std::function<void(const Lit* lits, size_t size)>;
+
+    /**
+     * @param capacity Number of slots, rounded up to a power of two.
+     */
+    explicit ClauseExchange(size_t capacity = 4096);
+
+    /**
+     * Offer a clause to the other readers. Thread-safe, wait-free.
+     * @return false if it was dropped (too long, empty, or its slot was busy).
+     */
+    bool publish(uint32_t producer, const Lit* lits, size_t size);
+
+    /**
+     * Deliver the clauses published since *cursor by producers other than
+     * `consumer`, then advance *cursor. Each reader owns its cursor (start at 0).
+     * @return Number of clauses delivered.
+     */
+    size_t fetch(uint32_t consumer, uint64_t& cursor, const ClauseHandler& on_clause) const;
+
+    size_t capacity() const;
+
+private:
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> seq{0};   // 2t+1 while ticket t is written, 2t+2 once complete
+        std::atomic<uint32_t> producer{0};
+        std::atomic<uint32_t> size{0};
+        std::atomic<Lit> lits[kMaxSize];
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    size_t mask_;
+    alignas(64) std::atomic<uint64_t> head_;   // Next ticket
+};
+
+} // namespace logic
+} // namespace minni
+
+#endif // MINNI_CORE_LOGIC_CLAUSE_EXCHANGE_H_
@@ -0,0 +1,191 @@
+#include "DimacsReader.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace minni {
+namespace logic {
+
+namespace {
+
+const size_t kReadChunk = 256 * 1024;
+const uint64_t kMaxVar = (1ull << 31) - 1;   // Lit keeps 31 bits of variable id
+
+} // namespace
+
+DimacsReader::DimacsReader(ClauseHandler on_clause)
+    : on_clause_(std::move(on_clause)),
+      state_(State::LINE_START),
+      in_number_(false),
+      negative_(false),
+      number_(0),
+      header_vars_(0),
+      header_clauses_(0),
+      max_var_(0),
+      clauses_(0),
+      line_(1) {
+    clause_.reserve(64);
+}
+
+bool DimacsReader::fail(const char* message) {
+    if (error_.empty()) {
+        error_ = "line " + std::to_string(line_) + ": " + message;
+    }
+    return false;
+}
+
+bool DimacsReader::end_number() {
+    if (!in_number_) return fail("'-' without a number");
+    if (number_ == 0) {
+        if (on_clause_) on_clause_(clause_.data(), clause_.size());
+        ++clauses_;
+        clause_.clear();
+    } else {
+        const uint32_t var = static_cast<uint32_t>(number_);
+        max_var_ = std::max(max_var_, var);
+        clause_.push_back(make_lit(var - 1, negative_));
+    }
+    in_number_ = false;
+    negative_ = false;
+    number_ = 0;
+    return true;
+}
+
+bool DimacsReader::parse_header() {
+    char format[8] = {0};
+    unsigned vars = 0;
+    unsigned long long clauses = 0;
+    if (std::sscanf(header_.c_str(), " %7s %u %llu", format, &vars, &clauses) != 3 ||
+        std::strcmp(format, "cnf") != 0) {
+        return fail("malformed \"p cnf\" header");
+    }
+    if (vars > kMaxVar) return fail("too many variables");
+    header_vars_ = vars;
+    header_clauses_ = static_cast<size_t>(clauses);
+    return true;
+}
+
+bool DimacsReader::feed(const char* data, size_t size) {
+    if (!error_.empty()) return false;
+
+    const char* p = data;
+    const char* end = data + size;
+    while (p < end) {
+        switch (state_) {
+            case State::DONE:
+                return true;
+
+            case State::COMMENT: {
+                const char* nl = static_cast<const char*>(std::memchr(p, '\n', end - p));
+                if (!nl) return true;
+                p = nl + 1;
+                ++line_;
+                state_ = State::LINE_START;
+                break;
+            }
+
+            case State::HEADER: {
+                const char* nl = static_cast<const char*>(std::memchr(p, '\n', end - p));
+                header_.append(p, nl ? nl : end);
+                if (!nl) return true;
+                p = nl + 1;
+                if (!parse_header()) return false;
+                ++line_;
+                state_ = State::LINE_START;
+                break;
+            }
+
+            case State::LINE_START:
+                if (*p == 'c') {
+                    state_ = State::COMMENT;
+                    ++p;
+                    break;
+                }
+                if (*p == 'p') {
+                    if (header_vars_ != 0 || clauses_ != 0) return fail("unexpected header");
+                    header_.clear();
+                    state_ = State::HEADER;
+                    ++p;
+                    break;
+                }
+                if (*p == '%') {
+                    state_ = State::DONE;
+                    return true;
+                }
+                state_ = State::BODY;
+                break;
+
+            case State::BODY:
+                // Hot loop: digits, signs and whitespace until the end of the line
+                for (; p < end; ++p) {
+                    const char ch = *p;
+                    if (ch >= '0' && ch <= '9') {
+                        number_ = number_ * 10 + static_cast<uint64_t>(ch - '0');
+                        if (number_ > kMaxVar) return fail("variable out of range");
+                        in_number_ = true;
+                    } else if (ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n') {
+                        if ((in_number_ || negative_) && !end_number()) return false;
+                        if (ch == '\n') {
+                            ++line_;
+                            state_ = State::LINE_START;
+                            ++p;
+                            break;
+                        }
+                    } else if (ch == '-' && !in_number_ && !negative_) {
+                        negative_ = true;
+                    } else {
+                        return fail("unexpected character");
+                    }
+                }
+                break;
+        }
+    }
+    return true;
+}
+
+bool DimacsReader::finish() {
+    if (!error_.empty()) return false;
+    if (state_ == State::HEADER && !parse_header()) return false;
+    if ((in_number_ || negative_) && !end_number()) return false;
+    if (!clause_.empty()) {
+        // Last clause without its terminating 0
+        if (on_clause_) on_clause_(clause_.data(), clause_.size());
+        ++clauses_;
+        clause_.clear();
+    }
+    state_ = State::DONE;
+    return true;
+}
+
+bool DimacsReader::read(const char* data, size_t size) {
+    return feed(data, size) && finish();
+}
+
+bool DimacsReader::read_file(const std::string& path) {
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) {
+        error_ = "cannot open " + path;
+        return false;
+    }
+    std::vector<char> buffer(kReadChunk);
+    bool ok = true;
+    size_t n;
+    while (ok && (n = std::fread(buffer.data(), 1, buffer.size(), file)) > 0) {
+        ok = feed(buffer.data(), n);
+    }
+    if (ok && std::ferror(file)) {
+        error_ = "read error on " + path;
+        ok = false;
+    }
+    std::fclose(file);
+    return ok && finish();
+}
+
+uint32_t DimacsReader::header_vars() const { return header_vars_; }
+size_t DimacsReader::header_clauses() const { return header_clauses_; }
+uint32_t DimacsReader::num_vars() const { return std::max(header_vars_, max_var_); }
+size_t DimacsReader::num_clauses() const { return clauses_; }
+const std::string& DimacsReader::error() const { return error_; }
+
+} // namespace logic
+} // namespace minni
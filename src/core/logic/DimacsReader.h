@@ -0,0 +1,103 @@
+#ifndef MINNI_CORE_LOGIC_DIMACS_READER_H_
+#define MINNI_CORE_LOGIC_DIMACS_READER_H_
+
+#include "CdclSolver.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace minni {
+namespace logic {
+
+/**
+ * Streaming DIMACS CNF reader.
+ * Input is consumed in chunks of any size (feed()), so a file is parsed with one
+ * fixed buffer and no per-line allocation; a number may span two chunks.
+ * DIMACS variable v (1-based) becomes Lit make_lit(v - 1), -v make_lit(v - 1, true).
+ *
+ * Accepted: "c" comment lines, one "p cnf <vars> <clauses>" header, clauses as
+ * 0-terminated integer lists spanning any number of lines, and the SATLIB "%" end
+ * marker. A final clause without its terminating 0 is accepted.
+ */
+class DimacsReader {
+public:
+    /**
+     * Called once per clause; the literal array is only valid during the call.
+     */
+    using ClauseHandler = std::function<void(const Lit* lits, size_t size)>;
+
+    explicit DimacsReader(ClauseHandler on_clause);
+
+    /**
+     * Parse the next chunk of input.
+     * @return false on a syntax error (see error()); later calls keep failing.
+     */
+    bool feed(const char* data, size_t size);
+
+    /**
+     * End of input: flushes a pending number / clause.
+     */
+    bool finish();
+
+    /**
+     * Whole-file convenience: feed() in 256 KiB chunks, then finish().
+     * @return false if the file cannot be read or is malformed.
+     */
+    bool read_file(const std::string& path);
+
+    /**
+     * In-memory convenience: feed() + finish().
+     */
+    bool read(const char* data, size_t size);
+
+    /**
+     * Counts from the "p cnf" header (0 if absent).
+     */
+    uint32_t header_vars() const;
+    size_t header_clauses() const;
+
+    /**
+     * Highest variable count seen: max(header vars, largest variable used).
+     */
+    uint32_t num_vars() const;
+    size_t num_clauses() const;
+
+    const std::string& error() const;
+
+private:
+    enum class State {
+        LINE_START,
+        BODY,
+        COMMENT,
+        HEADER,
+        DONE
+    };
+
+    ClauseHandler on_clause_;
+    State state_;
+    std::vector<Lit> clause_;
+    std::string header_;
+
+    // Number being parsed (may continue in the next chunk)
+    bool in_number_;
+    bool negative_;
+    uint64_t number_;
+
+    uint32_t header_vars_;
+    size_t header_clauses_;
+    uint32_t max_var_;
+    size_t clauses_;
+    size_t line_;
+    std::string error_;
+
+    bool end_number();
+    bool parse_header();
+    bool fail(const char* message);
+};
+
+} // namespace logic
+} // namespace minni
+
+#endif // MINNI_CORE_LOGIC_DIMACS_READER_H_
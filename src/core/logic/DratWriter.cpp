@@ -0,0 +1,104 @@
+#include "DratWriter.h"
+
+namespace minni {
+namespace logic {
+
+DratWriter::DratWriter()
+    : file_(nullptr),
+      format_(Format::BINARY),
+      buffer_(kBufferSize),
+      used_(0),
+      written_(0),
+      failed_(false) {
+}
+
+DratWriter::~DratWriter() {
+    close();
+}
+
+bool DratWriter::open(const std::string& path, Format format) {
+    close();
+    file_ = std::fopen(path.c_str(), format == Format::BINARY ? "wb" : "w");
+    format_ = format;
+    used_ = 0;
+    written_ = 0;
+    failed_ = false;
+    return file_ != nullptr;
+}
+
+bool DratWriter::is_open() const {
+    return file_ != nullptr;
+}
+
+uint64_t DratWriter::bytes_written() const {
+    return written_ + used_;
+}
+
+void DratWriter::add(const Lit* lits, size_t size) {
+    write_clause('a', lits, size);
+}
+
+void DratWriter::remove(const Lit* lits, size_t size) {
+    write_clause('d', lits, size);
+}
+
+void DratWriter::write_clause(char tag, const Lit* lits, size_t size) {
+    if (!file_) return;
+    // Worst case per literal: 5 varint bytes, or 11 characters of text
+    if (used_ + 16 * (size + 1) > buffer_.size()) {
+        flush();
+        if (16 * (size + 1) > buffer_.size()) buffer_.resize(16 * (size + 1));
+    }
+    char* out = buffer_.data() + used_;
+
+    if (format_ == Format::BINARY) {
+        *out++ = tag;
+        for (size_t i = 0; i < size; ++i) {
+            uint32_t code = 2 * (lit_var(lits[i]) + 1) + (lit_negated(lits[i]) ? 1u : 0u);
+            while (code > 0x7f) {
+                *out++ = static_cast<char>((code & 0x7f) | 0x80);
+                code >>= 7;
+            }
+            *out++ = static_cast<char>(code);
+        }
+        *out++ = 0;
+    } else {
+        if (tag == 'd') {
+            *out++ = 'd';
+            *out++ = ' ';
+        }
+        char digits[10];
+        for (size_t i = 0; i < size; ++i) {
+            if (lit_negated(lits[i])) *out++ = '-';
+            uint32_t n = lit_var(lits[i]) + 1;
+            int count = 0;
+            do {
+                digits[count++] = static_cast<char>('0' + n % 10);
+                n /= 10;
+            } while (n > 0);
+            while (count > 0) *out++ = digits[--count];
+            *out++ = ' ';
+        }
+        *out++ = '0';
+        *out++ = '\n';
+    }
+    used_ = static_cast<size_t>(out - buffer_.data());
+}
+
+void DratWriter::flush() {
+    if (!file_ || used_ == 0) return;
+    if (std::fwrite(buffer_.data(), 1, used_, file_) != used_) failed_ = true;
+    written_ += used_;
+    used_ = 0;
+}
+
+bool DratWriter::close() {
+    if (!file_) return !failed_;
+    flush();
+    if (std::fclose(file_) != 0) failed_ = true;
+    file_ = nullptr;
+    return !failed_;
+}
+
+} // namespace logic
+} // namespace minni
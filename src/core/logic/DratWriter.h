@@ -0,0 +1,73 @@
+#ifndef MINNI_CORE_LOGIC_DRAT_WRITER_H_
+#define MINNI_CORE_LOGIC_DRAT_WRITER_H_
+
+#include "CdclSolver.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace minni {
+namespace logic {
+
+/**
+ * DRAT proof output (checkable with drat-trim against the DIMACS formula).
+ *
+ * Each learned clause is written as an addition and each discarded one as a
+ * deletion; an UNSAT answer ends with the empty clause. Literals are written in
+ * DIMACS numbering (variable v is v + 1).
+ *
+ * Text: "1 -2 0" / "d 1 -2 0" lines. Binary: 'a' / 'd', then each literal as the
+ * variable-length encoding of 2 * (v + 1) + negated, then 0. Writes go to a 64 KB
+ * buffer that reaches the file in large blocks.
+ */
+class DratWriter {
+public:
+    enum class Format {
+        TEXT,
+        BINARY
+    };
+
+    DratWriter();
+    ~DratWriter();
+
+    DratWriter(const DratWriter&) = delete;
+    DratWriter& operator=(const DratWriter&) = delete;
+
+    /**
+     * Create (truncate) the proof file.
+     * @return false if it cannot be opened.
+     */
+    bool open(const std::string& path, Format format);
+
+    void add(const Lit* lits, size_t size);
+    void remove(const Lit* lits, size_t size);
+
+    /**
+     * Flush and close the file.
+     * @return false if any write failed.
+     */
+    bool close();
+
+    bool is_open() const;
+    uint64_t bytes_written() const;
+
+private:
+    static const size_t kBufferSize = 1 << 16;
+
+    std::FILE* file_;
+    Format format_;
+    std::vector<char> buffer_;
+    size_t used_;
+    uint64_t written_;
+    bool failed_;
+
+    void write_clause(char tag, const Lit* lits, size_t size);
+    void flush();
+};
+
+} // namespace logic
+} // namespace minni
+
+#endif // MINNI_CORE_LOGIC_DRAT_WRITER_H_
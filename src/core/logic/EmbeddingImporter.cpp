@@ -0,0 +1,312 @@
+#include "EmbeddingImporter.h"
+#include "FlatFormat.h"
+#include "../platform/MemoryMapper.h"
+#include "../optimization/Quantizer.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+namespace minni {
+namespace logic {
+
+namespace {
+
+using minni::optimization::Quantizer;
+using minni::platform::MemoryMapper;
+
+const char NPY_MAGIC[] = "\x93NUMPY";
+
+// Run fn(begin, end) over [0, count) split across threads.
+template <typename Fn>
+void parallel_rows(size_t count, size_t num_threads, Fn fn) {
+    if (num_threads == 0) num_threads = std::max<unsigned>(1, std::thread::hardware_concurrency());
+    num_threads = std::min(num_threads, std::max<size_t>(1, count / 64));
+
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < num_threads; ++t) {
+        pool.emplace_back([=]() { fn(count * t / num_threads, count * (t + 1) / num_threads); });
+    }
+    fn(0, count / num_threads);
+    for (auto& th : pool) th.join();
+}
+
+// Value of `key` in the header dict, e.g. "'descr': '<f4'" -> "'<f4'"
+std::string dict_value(const std::string& header, const std::string& key) {
+    size_t pos = header.find("'" + key + "'");
+    if (pos == std::string::npos) return "";
+    pos = header.find(':', pos);
+    if (pos == std::string::npos) return "";
+    pos = header.find_first_not_of(" ", pos + 1);
+    if (pos == std::string::npos) return "";
+
+    size_t end;
+    if (header[pos] == '(') {
+        end = header.find(')', pos);
+        if (end == std::string::npos) return "";
+        end++;
+    } else {
+        end = header.find_first_of(",}", pos);
+        if (end == std::string::npos) return "";
+    }
+    std::string value = header.substr(pos, end - pos);
+    value.erase(value.find_last_not_of(" ") + 1);
+    return value;
+}
+
+/**
+ * Sequential reader over a memory-mapped newline-separated ID file.
+ */
+class IdReader {
+public:
+    explicit IdReader(const MemoryMapper& mapper)
+        : data_(static_cast<const char*>(mapper.data())), size_(mapper.size()) {}
+
+    // Append the next `count` IDs; false if the file runs out.
+    bool next(size_t count, std::vector<std::string>& out) {
+        for (size_t i = 0; i < count; ++i) {
+            if (pos_ >= size_) return false;
+            const char* start = data_ + pos_;
+            const char* nl = static_cast<const char*>(std::memchr(start, '\n', size_ - pos_));
+            size_t len = nl ? static_cast<size_t>(nl - start) : size_ - pos_;
+            pos_ += len + 1;
+            if (len > 0 && start[len - 1] == '\r') len--;
+            out.emplace_back(start, len);
+        }
+        return true;
+    }
+
+private:
+    const char* data_;
+    size_t size_;
+    size_t pos_ = 0;
+};
+
+/**
+ * Produces float rows for one chunk: a pointer into the mapping for float32 files,
+ * or a parallel-converted staging buffer for float16 files.
+ */
+const float* chunk_rows(const uint8_t* base, const EmbeddingImporter::NpyInfo& info,
+                        size_t start, size_t rows, size_t num_threads, std::vector<float>& staging) {
+    if (!info.is_float16) {
+        return reinterpret_cast<const float*>(base + info.data_offset) + start * info.cols;
+    }
+
+    const uint16_t* src = reinterpret_cast<const uint16_t*>(base + info.data_offset) + start * info.cols;
+    staging.resize(rows * info.cols);
+    float* dst = staging.data();
+    const size_t cols = info.cols;
+    parallel_rows(rows, num_threads, [=](size_t begin, size_t end) {
+        for (size_t i = begin * cols; i < end * cols; ++i) {
+            uint16_t h;
+            std::memcpy(&h, src + i, sizeof(h)); // npy data is only 16-byte aligned
+            dst[i] = Quantizer::half_to_float(h);
+        }
+    });
+    return staging.data();
+}
+
+void release_rows(const MemoryMapper& mapper, const EmbeddingImporter::NpyInfo& info, size_t start, size_t rows) {
+    size_t elem = info.is_float16 ? 2 : 4;
+    mapper.advise(info.data_offset + start * info.cols * elem, rows * info.cols * elem,
+                  MemoryMapper::Advice::DONTNEED);
+}
+
+bool open_inputs(const std::string& npy_path, const std::string& ids_path,
+                 MemoryMapper& npy, MemoryMapper& ids, EmbeddingImporter::NpyInfo& info) {
+    if (!npy.map(npy_path) || !ids.map(ids_path)) return false;
+    if (!EmbeddingImporter::parse_npy_header(static_cast<const uint8_t*>(npy.data()), npy.size(), info)) {
+        return false;
+    }
+    npy.advise(info.data_offset, npy.size() - info.data_offset, MemoryMapper::Advice::SEQUENTIAL);
+    ids.advise(0, ids.size(), MemoryMapper::Advice::SEQUENTIAL);
+    return true;
+}
+
+} // namespace
+
+bool EmbeddingImporter::parse_npy_header(const uint8_t* data, size_t size, NpyInfo& info) {
+    if (size < 10 || std::memcmp(data, NPY_MAGIC, 6) != 0) return false;
+
+    uint8_t major = data[6];
+    size_t header_len = 0;
+    size_t prefix = 0;
+    if (major == 1) {
+        header_len = static_cast<size_t>(data[8]) | (static_cast<size_t>(data[9]) << 8);
+        prefix = 10;
+    } else if (major == 2 || major == 3) {
+        if (size < 12) return false;
+        uint32_t len;
+        std::memcpy(&len, data + 8, sizeof(len));
+        header_len = len;
+        prefix = 12;
+    } else {
+        return false;
+    }
+    if (prefix + header_len > size) return false;
+
+    std::string header(reinterpret_cast<const char*>(data + prefix), header_len);
+
+    std::string descr = dict_value(header, "descr");
+    if (descr == "'<f4'" || descr == "'=f4'") {
+        info.is_float16 = false;
+    } else if (descr == "'<f2'" || descr == "'=f2'") {
+        info.is_float16 = true;
+    } else {
+        return false; // Big-endian or non-float data
+    }
+
+    if (dict_value(header, "fortran_order") != "False") return false;
+
+    // shape: (rows, cols)
+    std::string shape = dict_value(header, "shape");
+    unsigned long long rows = 0, cols = 0;
+    if (std::sscanf(shape.c_str(), "(%llu, %llu)", &rows, &cols) != 2 || cols == 0) return false;
+
+    info.rows = static_cast<size_t>(rows);
+    info.cols = static_cast<size_t>(cols);
+    info.data_offset = prefix + header_len;
+
+    size_t elem = info.is_float16 ? 2 : 4;
+    return info.rows <= (size - info.data_offset) / elem / info.cols;
+}
+
+size_t EmbeddingImporter::import_to_store(const std::string& npy_path, const std::string& ids_path,
+                                          VectorStore& store, const Options& options) {
+    MemoryMapper npy;
+    MemoryMapper ids;
+    NpyInfo info;
+    if (!open_inputs(npy_path, ids_path, npy, ids, info)) return 0;
+    if (store.size() > 0 && store.dimension() != info.cols) return 0;
+
+    const uint8_t* base = static_cast<const uint8_t*>(npy.data());
+    const size_t chunk = std::max<size_t>(options.chunk_size, 1);
+    IdReader id_reader(ids);
+
+    std::vector<float> staging;
+    std::vector<std::string> chunk_ids;
+    size_t added = 0;
+
+    for (size_t start = 0; start < info.rows; start += chunk) {
+        size_t rows = std::min(chunk, info.rows - start);
+
+        chunk_ids.clear();
+        if (!id_reader.next(rows, chunk_ids)) break; // Fewer IDs than rows
+
+        const float* data = chunk_rows(base, info, start, rows, options.num_threads, staging);
+        added += store.add_batch(chunk_ids, data, info.cols, options.num_threads);
+
+        release_rows(npy, info, start, rows);
+    }
+    return added;
+}
+
+size_t EmbeddingImporter::import_to_store(const std::string& npy_path, const std::string& ids_path,
+                                          VectorStore& store) {
+    return import_to_store(npy_path, ids_path, store, Options());
+}
+
+bool EmbeddingImporter::import_to_flat(const std::string& npy_path, const std::string& ids_path,
+                                       const std::string& out_path, bool quantize) {
+    return import_to_flat(npy_path, ids_path, out_path, quantize, Options());
+}
+
+bool EmbeddingImporter::import_to_flat(const std::string& npy_path, const std::string& ids_path,
+                                       const std::string& out_path, bool quantize, const Options& options) {
+    MemoryMapper npy;
+    MemoryMapper ids;
+    NpyInfo info;
+    if (!open_inputs(npy_path, ids_path, npy, ids, info)) return false;
+
+    std::ofstream out(out_path, std::ios::binary);
+    if (!out) return false;
+
+    const uint64_t count = info.rows;
+    const size_t dim = info.cols;
+
+    // Same layout as VectorStore::save_flat(); rows keep their file order
+    flat::Header header = {};
+    std::memcpy(header.magic, flat::MAGIC, 4);
+    header.version = flat::VERSION_PLAIN;
+    header.dim = static_cast<uint32_t>(dim);
+    header.flags = quantize ? flat::FLAG_QUANTIZED : 0;
+    header.num_vectors = count;
+    header.vector_offset = flat::HEADER_SIZE;
+
+    uint64_t vec_size = count * dim * (quantize ? sizeof(int8_t) : sizeof(float));
+    if (quantize) {
+        header.params_offset = flat::align_up(header.vector_offset + vec_size, 4);
+        header.id_offset = header.params_offset + count * sizeof(Quantizer::QuantizationParams);
+    } else {
+        header.id_offset = header.vector_offset + vec_size;
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    const uint8_t* base = static_cast<const uint8_t*>(npy.data());
+    const size_t chunk = std::max<size_t>(options.chunk_size, 1);
+    IdReader id_reader(ids);
+
+    std::vector<float> staging;
+    std::vector<int8_t> codes;
+    std::vector<Quantizer::QuantizationParams> params;
+    std::vector<std::string> chunk_ids;
+    std::vector<uint64_t> id_table;
+
+    // ID strings start after the offset table; offsets are relative to the ID block
+    uint64_t str_relative_offset = count * 8;
+
+    for (size_t start = 0; start < count; start += chunk) {
+        size_t rows = std::min<size_t>(chunk, count - start);
+
+        chunk_ids.clear();
+        if (!id_reader.next(rows, chunk_ids)) return false; // Fewer IDs than rows
+
+        const float* data = chunk_rows(base, info, start, rows, options.num_threads, staging);
+
+        // 1. Vector data (+ params)
+        if (quantize) {
+            codes.resize(rows * dim);
+            params.resize(rows);
+            int8_t* code_ptr = codes.data();
+            Quantizer::QuantizationParams* param_ptr = params.data();
+            parallel_rows(rows, options.num_threads, [=](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    param_ptr[i] = Quantizer::calculate_params(data + i * dim, dim);
+                    Quantizer::quantize(data + i * dim, dim, param_ptr[i], code_ptr + i * dim);
+                }
+            });
+            out.seekp(header.vector_offset + start * dim);
+            out.write(reinterpret_cast<const char*>(codes.data()), codes.size());
+            out.seekp(header.params_offset + start * sizeof(Quantizer::QuantizationParams));
+            out.write(reinterpret_cast<const char*>(params.data()), params.size() * sizeof(params[0]));
+        } else {
+            out.seekp(header.vector_offset + start * dim * sizeof(float));
+            out.write(reinterpret_cast<const char*>(data), rows * dim * sizeof(float));
+        }
+
+        // 2. ID offsets for this chunk, then the strings themselves
+        id_table.clear();
+        uint64_t chunk_str_start = str_relative_offset;
+        for (const auto& id : chunk_ids) {
+            id_table.push_back(str_relative_offset);
+            str_relative_offset += id.size() + 1;
+        }
+        out.seekp(header.id_offset + start * 8);
+        out.write(reinterpret_cast<const char*>(id_table.data()), id_table.size() * 8);
+        out.seekp(header.id_offset + chunk_str_start);
+        for (const auto& id : chunk_ids) {
+            out.write(id.c_str(), id.size() + 1);
+        }
+
+        release_rows(npy, info, start, rows);
+        if (!out) return false;
+    }
+
+    out.close();
+    return out.good();
+}
+
+} // namespace logic
+} // namespace minni
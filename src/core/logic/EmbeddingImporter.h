@@ -0,0 +1,67 @@
+#ifndef MINNI_CORE_LOGIC_EMBEDDING_IMPORTER_H_
+#define MINNI_CORE_LOGIC_EMBEDDING_IMPORTER_H_
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include "VectorStore.h"
+
+namespace minni {
+namespace logic {
+
+/**
+ * Bulk importer for embeddings exported from Python with numpy.save().
+ * Memory-maps a 2D ".npy" array (float32 or float16, C order) and a UTF-8 ID file
+ * (one ID per line, same order as the rows) and streams them chunk by chunk,
+ * converting and quantizing each chunk in parallel. Only one chunk of staging
+ * data is held at a time; consumed input pages are released with madvise.
+ */
+class EmbeddingImporter {
+public:
+    struct Options {
+        size_t chunk_size = 8192; // Rows per chunk
+        size_t num_threads = 0;   // 0 = hardware concurrency
+    };
+
+    /**
+     * Parsed ".npy" header.
+     */
+    struct NpyInfo {
+        bool is_float16 = false;
+        size_t rows = 0;
+        size_t cols = 0;
+        size_t data_offset = 0; // Byte offset of the first element
+    };
+
+    /**
+     * Parse and validate an ".npy" header (format versions 1.0 - 3.0).
+     * Only little-endian float32/float16, C-ordered 2D arrays are accepted.
+     * @return true if the header is valid and the data fits in `size` bytes.
+     */
+    static bool parse_npy_header(const uint8_t* data, size_t size, NpyInfo& info);
+
+    /**
+     * Import into an in-memory VectorStore (quantized if the store is).
+     * @return Number of vectors added (0 on error).
+     */
+    static size_t import_to_store(const std::string& npy_path, const std::string& ids_path,
+                                  VectorStore& store, const Options& options);
+    static size_t import_to_store(const std::string& npy_path, const std::string& ids_path,
+                                  VectorStore& store);
+
+    /**
+     * Stream straight into an "MFVS" flat file (see VectorStore::save_flat()).
+     * @param quantize If true, rows are stored as int8 with per-vector params.
+     * @return true if successful.
+     */
+    static bool import_to_flat(const std::string& npy_path, const std::string& ids_path,
+                               const std::string& out_path, bool quantize,
+                               const Options& options);
+    static bool import_to_flat(const std::string& npy_path, const std::string& ids_path,
+                               const std::string& out_path, bool quantize);
+};
+
+} // namespace logic
+} // namespace minni
+
+#endif // MINNI_CORE_LOGIC_EMBEDDING_IMPORTER_H_
@@ -0,0 +1,77 @@
+#ifndef MINNI_CORE_LOGIC_FLAT_FORMAT_H_
+#define MINNI_CORE_LOGIC_FLAT_FORMAT_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace minni {
+namespace logic {
+namespace flat {
+
+/**
+ * On-disk layout of the "MFVS" (Minni Flat Vector Store) format.
+ * Shared by VectorStore::save_flat*() (writer) and FlatVectorStore (reader).
+ *
+ * Version 1 ("plain"):  Header | Vectors (float or int8) | [Quant Params] | ID Blob
+ * Version 2 ("tiered"): Header | Hot Codes | [Quant Params] | ID Blob | <page pad> | Cold Float Vectors
+ *
+ * In the tiered layout the compact codes are scanned for every query, while the
+ * page-aligned cold section is only touched for the few candidates being reranked.
+ */
+
+const char MAGIC[] = "MFVS";
+const uint32_t VERSION_PLAIN = 1;
+const uint32_t VERSION_TIERED = 2;
+
+const size_t HEADER_SIZE = 64;
+const size_t COLD_ALIGNMENT = 4096; // Page size on all supported Android ABIs
+
+// Header flag bits
+const uint32_t FLAG_QUANTIZED = 1u << 0; // Vector section holds int8 + per-vector params
+const uint32_t FLAG_TIERED = 1u << 1;    // Hot codes + cold float section
+
+/**
+ * Encoding of the hot section in a tiered file.
+ */
+enum class CodeType : uint32_t {
+    NONE = 0,
+    INT8 = 1,   // Per-vector asymmetric int8 (Quantizer params follow the codes)
+    BINARY = 2, // 1 bit per dimension (sign), padded to 64-bit words
+    PREFIX = 3  // Float32 Matryoshka prefix (prefix_dim dims); 1/||prefix|| per vector in the params section
+};
+
+/**
+ * Fixed 64-byte header, written verbatim (little-endian).
+ */
+struct Header {
+    char magic[4];
+    uint32_t version;
+    uint32_t dim;
+    uint32_t flags;
+    uint64_t num_vectors;
+    uint64_t vector_offset; // Plain: vector data. Tiered: hot codes.
+    uint64_t params_offset; // Quant params / prefix inverse norms (or 0)
+    uint64_t id_offset;     // ID offset table + strings
+    uint32_t code_type;     // CodeType (tiered only)
+    uint32_t prefix_dim;    // Prefix length for CodeType::PREFIX (else 0)
+    uint64_t cold_offset;   // Full-precision floats (tiered only)
+};
+
+static_assert(sizeof(Header) == HEADER_SIZE, "MFVS header must be 64 bytes");
+
+/**
+ * Bytes per vector for a binary code (sign bits packed into 64-bit words).
+ */
+inline size_t binary_code_bytes(size_t dim) {
+    return ((dim + 63) / 64) * sizeof(uint64_t);
+}
+
+inline uint64_t align_up(uint64_t value, uint64_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+} // namespace flat
+} // namespace logic
+} // namespace minni
+
+#endif // MINNI_CORE_LOGIC_FLAT_FORMAT_H_
@@ -2,13 +2,46 @@
 #include "../signal/DSPKernel.h"
 #include <algorithm>
 #include <iostream>
+#include <cmath>
 #include <cstring>
+#include <numeric>
+#include <random>
+#include <unordered_set>
 
 namespace minni {
 namespace logic {
 
-// Must match VectorStore.cpp
-const char FLAT_MAGIC_HEADER[] = "MFVS";
+namespace {
+
+using QuantizationParams = minni::optimization::Quantizer::QuantizationParams;
+
+// Smallest common page size; cold vectors closer than this are advised together.
+constexpr size_t ADVISE_GAP_BYTES = 4096;
+
+inline int popcount64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(x);
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return static_cast<int>((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+bool by_score_desc(const std::pair<size_t, float>& a, const std::pair<size_t, float>& b) {
+    return a.second > b.second;
+}
+
+// Keep the `keep` best entries (unordered).
+void select_top(std::vector<std::pair<size_t, float>>& candidates, size_t keep) {
+    if (keep < candidates.size()) {
+        std::nth_element(candidates.begin(), candidates.begin() + keep, candidates.end(), by_score_desc);
+        candidates.resize(keep);
+    }
+}
+
+} // namespace
 
 FlatVectorStore::FlatVectorStore() = default;
 FlatVectorStore::~FlatVectorStore() {
@@ -20,8 +53,14 @@ void FlatVectorStore::close() {
     vectors_ptr_ = nullptr;
     quant_params_ptr_ = nullptr;
     id_offsets_ptr_ = nullptr;
+    cold_ptr_ = nullptr;
+    cold_offset_ = 0;
     num_vectors_ = 0;
     dim_ = 0;
+    is_quantized_ = false;
+    is_tiered_ = false;
+    code_type_ = flat::CodeType::NONE;
+    prefix_dim_ = 0;
 }
 
 bool FlatVectorStore::load(const std::string& path) {
@@ -32,84 +71,135 @@ bool FlatVectorStore::load(const std::string& path) {
     const uint8_t* data = static_cast<const uint8_t*>(mapper_.data());
     size_t size = mapper_.size();
 
-    if (size < 64) { // Minimum header size
+    if (size < flat::HEADER_SIZE) { // Minimum header size
         close();
         return false;
     }
 
     // 1. Check Header
-    if (std::memcmp(data, FLAT_MAGIC_HEADER, 4) != 0) {
+    flat::Header header;
+    std::memcpy(&header, data, sizeof(header));
+
+    if (std::memcmp(header.magic, flat::MAGIC, 4) != 0) {
         close();
         return false;
     }
 
     // Read Metadata
-    uint32_t version = *reinterpret_cast<const uint32_t*>(data + 4);
-    if (version != 1) { // Version mismatch
+    if (header.version != flat::VERSION_PLAIN && header.version != flat::VERSION_TIERED) { // Version mismatch
         close();
         return false;
     }
 
-    dim_ = static_cast<size_t>(*reinterpret_cast<const uint32_t*>(data + 8));
-    uint32_t flags = *reinterpret_cast<const uint32_t*>(data + 12);
-    is_quantized_ = (flags & 1);
-
-    num_vectors_ = static_cast<size_t>(*reinterpret_cast<const uint64_t*>(data + 16));
-    uint64_t vec_offset = *reinterpret_cast<const uint64_t*>(data + 24);
-    uint64_t params_offset = *reinterpret_cast<const uint64_t*>(data + 32);
-    uint64_t id_offset = *reinterpret_cast<const uint64_t*>(data + 40);
+    dim_ = static_cast<size_t>(header.dim);
+    is_quantized_ = (header.flags & flat::FLAG_QUANTIZED);
+    is_tiered_ = (header.version == flat::VERSION_TIERED) && (header.flags & flat::FLAG_TIERED);
+    num_vectors_ = static_cast<size_t>(header.num_vectors);
 
     // Bounds checking
-    if (vec_offset >= size || id_offset >= size) {
+    if (header.vector_offset >= size || header.id_offset >= size) {
         close();
         return false;
     }
 
     // Set pointers
-    vectors_ptr_ = data + vec_offset;
-    id_offsets_ptr_ = reinterpret_cast<const uint64_t*>(data + id_offset);
+    vectors_ptr_ = data + header.vector_offset;
+    id_offsets_ptr_ = reinterpret_cast<const uint64_t*>(data + header.id_offset);
 
     if (is_quantized_) {
-        if (params_offset >= size) {
+        if (header.params_offset >= size) {
             close();
             return false;
         }
-        quant_params_ptr_ = data + params_offset;
+        quant_params_ptr_ = data + header.params_offset;
+    }
+
+    if (is_tiered_) {
+        code_type_ = static_cast<flat::CodeType>(header.code_type);
+        bool known_code = (code_type_ == flat::CodeType::INT8) || (code_type_ == flat::CodeType::BINARY) ||
+                          (code_type_ == flat::CodeType::PREFIX);
+        uint64_t cold_bytes = static_cast<uint64_t>(num_vectors_) * dim_ * sizeof(float);
+        if (!known_code || header.cold_offset > size || cold_bytes > size - header.cold_offset) {
+            close();
+            return false;
+        }
+        if (code_type_ == flat::CodeType::PREFIX) {
+            prefix_dim_ = header.prefix_dim;
+            if (prefix_dim_ == 0 || prefix_dim_ >= dim_ || header.params_offset >= size) {
+                close();
+                return false;
+            }
+            quant_params_ptr_ = data + header.params_offset;
+        }
+
+        // The hot codes must end before the cold section starts
+        uint64_t code_bytes = dim_;
+        if (code_type_ == flat::CodeType::BINARY) {
+            code_bytes = flat::binary_code_bytes(dim_);
+        } else if (code_type_ == flat::CodeType::PREFIX) {
+            code_bytes = static_cast<uint64_t>(prefix_dim_) * sizeof(float);
+        }
+        uint64_t hot_bytes = static_cast<uint64_t>(num_vectors_) * code_bytes;
+        if (header.vector_offset > header.cold_offset || hot_bytes > header.cold_offset - header.vector_offset) {
+            close();
+            return false;
+        }
+        cold_offset_ = header.cold_offset;
+        cold_ptr_ = reinterpret_cast<const float*>(data + header.cold_offset);
+
+        // Hot codes are scanned on every query; cold vectors are fetched sparsely,
+        // so suppress readahead there to keep only the reranked pages resident.
+        mapper_.advise(header.vector_offset, cold_offset_ - header.vector_offset,
+                       minni::platform::MemoryMapper::Advice::WILLNEED);
+        mapper_.advise(cold_offset_, cold_bytes, minni::platform::MemoryMapper::Advice::RANDOM);
     }
 
     return true;
 }
 
-std::vector<std::pair<std::string, float>> FlatVectorStore::search(const std::vector<float>& query, size_t limit) {
-    std::vector<std::pair<std::string, float>> results;
+void FlatVectorStore::scan(const std::vector<float>& query, std::vector<IndexScore>& candidates) const {
+    candidates.clear();
+    candidates.reserve(num_vectors_);
 
-    if (!mapper_.is_mapped() || num_vectors_ == 0 || query.size() != dim_) {
-        return results;
-    }
+    if (is_tiered_ && code_type_ == flat::CodeType::BINARY) {
+        // Hamming distance between sign codes approximates the angle between vectors.
+        const size_t words = flat::binary_code_bytes(dim_) / sizeof(uint64_t);
+        std::vector<uint64_t> query_code(words, 0);
+        for (size_t d = 0; d < dim_; ++d) {
+            if (query[d] > 0.0f) query_code[d / 64] |= (uint64_t(1) << (d % 64));
+        }
 
-    // Pre-allocate results with indices temporarily to avoid string lookups during search loop
-    // Store as (index, score) pairs
-    using IndexScore = std::pair<size_t, float>;
-    std::vector<IndexScore> candidates;
-    candidates.reserve(num_vectors_);
+        const uint64_t* codes = static_cast<const uint64_t*>(vectors_ptr_);
+        const float inv_dim = 1.0f / static_cast<float>(dim_);
+        for (size_t i = 0; i < num_vectors_; ++i) {
+            const uint64_t* code_i = codes + i * words;
+            int distance = 0;
+            for (size_t w = 0; w < words; ++w) {
+                distance += popcount64(code_i[w] ^ query_code[w]);
+            }
+            candidates.emplace_back(i, 1.0f - 2.0f * distance * inv_dim);
+        }
+    } else if (is_tiered_ && code_type_ == flat::CodeType::PREFIX) {
+        // Cosine over the first prefix_dim_ dimensions, using stored 1 / ||prefix||
+        const float* prefixes = static_cast<const float*>(vectors_ptr_);
+        const float* inv_norms = static_cast<const float*>(quant_params_ptr_);
+        float query_norm = std::sqrt(minni::signal::DSPKernel::dot_product(query.data(), query.data(), prefix_dim_));
+        float query_inv_norm = query_norm < 1e-9f ? 0.0f : 1.0f / query_norm;
 
-    if (is_quantized_) {
+        for (size_t i = 0; i < num_vectors_; ++i) {
+            float dot = minni::signal::DSPKernel::dot_product(query.data(), prefixes + i * prefix_dim_, prefix_dim_);
+            candidates.emplace_back(i, dot * query_inv_norm * inv_norms[i]);
+        }
+    } else if (is_quantized_) {
         const int8_t* vecs = static_cast<const int8_t*>(vectors_ptr_);
-        const auto* params = static_cast<const minni::optimization::Quantizer::QuantizationParams*>(quant_params_ptr_);
+        const auto* params = static_cast<const QuantizationParams*>(quant_params_ptr_);
+        const float query_norm = std::sqrt(minni::signal::DSPKernel::dot_product(query.data(), query.data(), dim_));
 
         for (size_t i = 0; i < num_vectors_; ++i) {
             // Locate vector i
             const int8_t* vec_i = vecs + (i * dim_);
-
-            // Dequantize on fly (optimization opportunity: SIMD dequantize-and-dot)
-            std::vector<float> dq_vec = minni::optimization::Quantizer::dequantize(
-                std::vector<int8_t>(vec_i, vec_i + dim_),
-                params[i]
-            );
-
-            float score = minni::signal::DSPKernel::cosine_similarity(
-                query.data(), dq_vec.data(), dim_
-            );
+            float score = minni::optimization::Quantizer::dequantized_cosine(
+                query.data(), query_norm, vec_i, params[i], dim_);
             candidates.emplace_back(i, score);
         }
     } else {
@@ -123,48 +213,183 @@ std::vector<std::pair<std::string, float>> FlatVectorStore::search(const std::ve
             candidates.emplace_back(i, score);
         }
     }
+}
+
+void FlatVectorStore::rerank(const std::vector<float>& query, std::vector<IndexScore>& candidates) {
+    const size_t vec_bytes = dim_ * sizeof(float);
+
+    // Ask for all candidate pages up front so the reads overlap. Candidates are
+    // visited in file order and vectors closer than a page apart share one call.
+    std::vector<size_t> order;
+    order.reserve(candidates.size());
+    for (const auto& c : candidates) order.push_back(c.first);
+    std::sort(order.begin(), order.end());
+
+    size_t i = 0;
+    while (i < order.size()) {
+        size_t run_begin = order[i] * vec_bytes;
+        size_t run_end = run_begin + vec_bytes;
+        for (++i; i < order.size() && order[i] * vec_bytes <= run_end + ADVISE_GAP_BYTES; ++i) {
+            run_end = order[i] * vec_bytes + vec_bytes;
+        }
+        mapper_.advise(cold_offset_ + run_begin, run_end - run_begin,
+                       minni::platform::MemoryMapper::Advice::WILLNEED);
+    }
+
+    for (auto& c : candidates) {
+        const float* vec_i = cold_ptr_ + c.first * dim_;
+        c.second = minni::signal::DSPKernel::cosine_similarity(query.data(), vec_i, dim_);
+    }
+}
 
+std::vector<std::pair<std::string, float>> FlatVectorStore::resolve(std::vector<IndexScore>& candidates,
+                                                                    size_t limit) const {
     // Top-K selection
     // Partial sort is faster than full sort for small K
     if (limit < candidates.size()) {
-        std::partial_sort(candidates.begin(), candidates.begin() + limit, candidates.end(),
-            [](const IndexScore& a, const IndexScore& b) {
-                return a.second > b.second; // Descending
-            });
+        std::partial_sort(candidates.begin(), candidates.begin() + limit, candidates.end(), by_score_desc);
         candidates.resize(limit);
     } else {
-        std::sort(candidates.begin(), candidates.end(),
-            [](const IndexScore& a, const IndexScore& b) {
-                return a.second > b.second;
-            });
+        std::sort(candidates.begin(), candidates.end(), by_score_desc);
     }
 
     // Resolve IDs
-    // The ID block starts with the offset table (which we have in id_offsets_ptr_)
-    // The strings follow immediately after the table.
-    // The offset table contains offsets relative to the START of the ID section (id_offset).
-    // Wait, in save_flat, I wrote:
-    // uint64_t current_str_relative_offset = count * 8;
-    // So offsets are relative to the start of the ID block.
-
+    // The ID block starts with the offset table (id_offsets_ptr_); the strings follow it.
+    // Offsets are relative to the start of the ID block.
     const uint8_t* id_base_ptr = reinterpret_cast<const uint8_t*>(id_offsets_ptr_);
 
+    std::vector<std::pair<std::string, float>> results;
+    results.reserve(candidates.size());
     for (const auto& candidate : candidates) {
-        size_t idx = candidate.first;
-        float score = candidate.second;
-
-        uint64_t offset = id_offsets_ptr_[idx];
+        uint64_t offset = id_offsets_ptr_[candidate.first];
         const char* str_ptr = reinterpret_cast<const char*>(id_base_ptr + offset);
+        results.emplace_back(std::string(str_ptr), candidate.second);
+    }
+    return results;
+}
+
+std::vector<std::pair<std::string, float>> FlatVectorStore::search(const std::vector<float>& query, size_t limit) {
+    return search(query, limit, oversample_);
+}
 
-        results.emplace_back(std::string(str_ptr), score);
+std::vector<std::pair<std::string, float>> FlatVectorStore::search(const std::vector<float>& query, size_t limit,
+                                                                   size_t oversample) {
+    if (!mapper_.is_mapped() || num_vectors_ == 0 || query.size() != dim_) {
+        return {};
     }
 
-    return results;
+    // Store as (index, score) pairs to avoid string lookups during the search loop
+    std::vector<IndexScore> candidates;
+    scan(query, candidates);
+
+    if (is_tiered_) {
+        select_top(candidates, limit * std::max<size_t>(oversample, 1));
+        rerank(query, candidates);
+    }
+
+    return resolve(candidates, limit);
+}
+
+std::vector<std::pair<std::string, float>> FlatVectorStore::search_exact(const std::vector<float>& query,
+                                                                         size_t limit) {
+    if (!mapper_.is_mapped() || num_vectors_ == 0 || query.size() != dim_) {
+        return {};
+    }
+    if (!is_tiered_) {
+        return search(query, limit);
+    }
+
+    std::vector<IndexScore> candidates;
+    candidates.reserve(num_vectors_);
+    for (size_t i = 0; i < num_vectors_; ++i) {
+        candidates.emplace_back(i, minni::signal::DSPKernel::cosine_similarity(
+            query.data(), cold_ptr_ + i * dim_, dim_));
+    }
+    return resolve(candidates, limit);
+}
+
+float FlatVectorStore::measure_recall(const std::vector<std::vector<float>>& queries, size_t limit,
+                                      size_t oversample) {
+    if (queries.empty() || limit == 0) return 0.0f;
+
+    double total = 0.0;
+    size_t evaluated = 0;
+    for (const auto& query : queries) {
+        auto exact = search_exact(query, limit);
+        if (exact.empty()) continue;
+
+        auto approx = search(query, limit, oversample);
+        std::unordered_set<std::string> found;
+        for (const auto& r : approx) found.insert(r.first);
+
+        size_t hits = 0;
+        for (const auto& r : exact) {
+            if (found.count(r.first)) hits++;
+        }
+        total += static_cast<double>(hits) / exact.size();
+        evaluated++;
+    }
+    return evaluated ? static_cast<float>(total / evaluated) : 0.0f;
+}
+
+void FlatVectorStore::set_oversample(size_t oversample) {
+    oversample_ = std::max<size_t>(oversample, 1);
+}
+
+size_t FlatVectorStore::oversample() const {
+    return oversample_;
+}
+
+std::vector<float> FlatVectorStore::sample(size_t count, uint32_t seed) const {
+    count = std::min(count, num_vectors_);
+    std::vector<float> out;
+    if (!mapper_.is_mapped() || count == 0) return out;
+
+    std::vector<size_t> positions(num_vectors_);
+    std::iota(positions.begin(), positions.end(), 0);
+    std::mt19937 rng(seed);
+    for (size_t i = 0; i < count; ++i) {
+        std::uniform_int_distribution<size_t> pick(i, num_vectors_ - 1);
+        std::swap(positions[i], positions[pick(rng)]);
+    }
+    positions.resize(count);
+    std::sort(positions.begin(), positions.end()); // Sequential page access
+
+    out.resize(count * dim_);
+    for (size_t s = 0; s < count; ++s) {
+        size_t i = positions[s];
+        float* dst = out.data() + s * dim_;
+        if (is_tiered_) {
+            std::copy(cold_ptr_ + i * dim_, cold_ptr_ + (i + 1) * dim_, dst);
+        } else if (is_quantized_) {
+            const int8_t* vec_i = static_cast<const int8_t*>(vectors_ptr_) + i * dim_;
+            const auto& params = static_cast<const QuantizationParams*>(quant_params_ptr_)[i];
+            for (size_t d = 0; d < dim_; ++d) {
+                dst[d] = minni::optimization::Quantizer::dequantize_scalar(vec_i[d], params);
+            }
+        } else {
+            const float* vec_i = static_cast<const float*>(vectors_ptr_) + i * dim_;
+            std::copy(vec_i, vec_i + dim_, dst);
+        }
+    }
+    return out;
+}
+
+bool FlatVectorStore::is_tiered() const {
+    return is_tiered_;
+}
+
+size_t FlatVectorStore::prefix_dim() const {
+    return prefix_dim_;
 }
 
 size_t FlatVectorStore::size() const {
     return num_vectors_;
 }
 
+size_t FlatVectorStore::dimension() const {
+    return dim_;
+}
+
 } // namespace logic
 } // namespace minni
@@ -6,6 +6,7 @@
 #include <utility>
 #include "../platform/MemoryMapper.h"
 #include "../optimization/Quantizer.h"
+#include "FlatFormat.h"
 
 namespace minni {
 namespace logic {
@@ -14,6 +15,12 @@ namespace logic {
  * A read-only, zero-copy Vector Store backed by a memory-mapped file.
  * Designed for extreme memory efficiency on Android (avoids LMK).
  * Reads the "MFVS" format created by VectorStore::save_flat().
+ *
+ * Tiered files (VectorStore::save_flat_tiered()) are searched in two stages:
+ * the compact codes are scanned to collect `limit * oversample` candidates,
+ * which are then reranked with exact float scores read from the cold section.
+ * With CodeType::PREFIX the hot section holds Matryoshka prefixes, giving a
+ * coarse-to-fine search whose first pass costs prefix_dim / dim of a full scan.
  */
 class FlatVectorStore {
 public:
@@ -29,27 +36,91 @@ public:
 
     /**
      * Search for nearest neighbors using zero-copy access.
+     * Tiered files use two-stage search with the configured oversample factor.
      * @param query The query vector.
      * @param limit Maximum number of results.
      * @return List of (ID, Score) pairs.
      */
     std::vector<std::pair<std::string, float>> search(const std::vector<float>& query, size_t limit);
 
+    /**
+     * Two-stage search with an explicit oversample factor (tiered files only).
+     * @param oversample Candidates kept from the code scan = limit * oversample.
+     * @return List of (ID, Score) pairs with exact float scores.
+     */
+    std::vector<std::pair<std::string, float>> search(const std::vector<float>& query, size_t limit,
+                                                      size_t oversample);
+
+    /**
+     * Exhaustive search over the full-precision vectors (cold section for tiered files).
+     * Used as ground truth for recall measurements.
+     */
+    std::vector<std::pair<std::string, float>> search_exact(const std::vector<float>& query, size_t limit);
+
+    /**
+     * Measure recall@limit of two-stage search against exhaustive search.
+     * @param queries Query vectors.
+     * @param limit Number of neighbors (k).
+     * @param oversample Oversample factor to evaluate.
+     * @return Mean fraction of the exact top-k found by two-stage search (1.0 for non-tiered files).
+     */
+    float measure_recall(const std::vector<std::vector<float>>& queries, size_t limit, size_t oversample);
+
+    /**
+     * Set the default oversample factor used by search() on tiered files (minimum 1).
+     */
+    void set_oversample(size_t oversample);
+    size_t oversample() const;
+
+    /**
+     * Draw a uniform random sample of full-precision vectors, e.g. for codebook training.
+     * Int8 files are dequantized; tiered files read the cold section.
+     * @param count Maximum number of vectors (all if count >= size()).
+     * @param seed Sampling seed (same seed -> same sample).
+     * @return Row-major floats (sampled x dimension()).
+     */
+    std::vector<float> sample(size_t count, uint32_t seed = 42) const;
+
+    /**
+     * True if the loaded file has hot codes and a cold float section.
+     */
+    bool is_tiered() const;
+
+    /**
+     * Prefix length scored in the first pass (0 unless CodeType::PREFIX).
+     */
+    size_t prefix_dim() const;
+
     size_t size() const;
+    size_t dimension() const;
     void close();
 
 private:
+    using IndexScore = std::pair<size_t, float>;
+
     minni::platform::MemoryMapper mapper_;
 
     // Metadata from header
     size_t num_vectors_ = 0;
     size_t dim_ = 0;
     bool is_quantized_ = false;
+    bool is_tiered_ = false;
+    flat::CodeType code_type_ = flat::CodeType::NONE;
+    size_t prefix_dim_ = 0;
+    size_t oversample_ = 4;
 
     // Pointers into mapped memory (valid as long as mapper_ is mapped)
-    const void* vectors_ptr_ = nullptr;        // Points to start of vector data
-    const void* quant_params_ptr_ = nullptr;   // Points to start of params (if quantized)
+    const void* vectors_ptr_ = nullptr;        // Points to start of vector data (hot codes if tiered)
+    const void* quant_params_ptr_ = nullptr;   // Points to start of params (quant params or prefix inverse norms)
     const uint64_t* id_offsets_ptr_ = nullptr; // Points to start of ID offset table
+    const float* cold_ptr_ = nullptr;          // Full-precision vectors (tiered only)
+    uint64_t cold_offset_ = 0;
+
+    // Score every vector in the hot section (codes or floats)
+    void scan(const std::vector<float>& query, std::vector<IndexScore>& out) const;
+    // Exact float rerank of candidate indices against the cold section
+    void rerank(const std::vector<float>& query, std::vector<IndexScore>& candidates);
+    std::vector<std::pair<std::string, float>> resolve(std::vector<IndexScore>& candidates, size_t limit) const;
 };
 
 } // namespace logic
@@ -0,0 +1,319 @@
+#include "MaxSatSolver.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <sstream>
+
+namespace minni {
+namespace logic {
+
+MaxSatSolver::MaxSatSolver()
+    : timeout_ms_(0),
+      stratify_(true),
+      lower_bound_(0),
+      cost_(0),
+      has_model_(false) {
+}
+MaxSatSolver::~MaxSatSolver() = default;
+
+bool MaxSatSolver::initialize() {
+    return sat_.initialize();
+}
+
+void MaxSatSolver::reset() {
+    sat_.reset();
+    softs_.clear();
+    terms_.clear();
+    totalizers_.clear();
+    term_of_.clear();
+    lower_bound_ = 0;
+    cost_ = 0;
+    has_model_ = false;
+    model_.clear();
+}
+
+std::unordered_map<std::string, std::string> MaxSatSolver::get_stats() {
+    return sat_.get_stats();
+}
+
+void MaxSatSolver::set_param(const std::string& key, const std::string& value) {
+    if (key == "timeout") {
+        char* end = nullptr;
+        const unsigned long long n = std::strtoull(value.c_str(), &end, 10);
+        if (value.empty() || *end != '\0' || value[0] == '-') return;
+        timeout_ms_ = n;
+    } else if (key == "stratify") {
+        if (value == "true" || value == "1") stratify_ = true;
+        else if (value == "false" || value == "0") stratify_ = false;
+    } else if (key != "mode") {
+        // DPLL reports every assumption as the core, which would make each core the
+        // whole objective, so the SAT calls always use CDCL
+        sat_.set_param(key, value);
+    }
+}
+
+void MaxSatSolver::interrupt() {
+    sat_.interrupt();
+}
+
+std::unordered_map<std::string, std::string> MaxSatSolver::get_model() {
+    return model_;
+}
+
+uint64_t MaxSatSolver::cost() const {
+    return cost_;
+}
+
+uint64_t MaxSatSolver::lower_bound() const {
+    return lower_bound_;
+}
+
+bool MaxSatSolver::add(const std::string& formula_str) {
+    return sat_.add(formula_str);
+}
+
+bool MaxSatSolver::add_cardinality(const std::vector<std::string>& atoms, Compare compare, size_t k) {
+    return sat_.add_cardinality(atoms, compare, k);
+}
+
+bool MaxSatSolver::add_pseudo_boolean(const std::vector<std::string>& atoms, const std::vector<int64_t>& weights,
+                                      Compare compare, int64_t bound) {
+    return sat_.add_pseudo_boolean(atoms, weights, compare, bound);
+}
+
+// A lone "x" or "!x": no operators and a single name
+static bool is_atom(const std::string& text) {
+    size_t begin = text.find_first_not_of(" \t\r\n!");
+    if (begin == std::string::npos || text.find_first_of("&|()", 0) != std::string::npos) return false;
+    size_t end = text.find_first_of(" \t\r\n", begin);
+    return end == std::string::npos || text.find_first_not_of(" \t\r\n", end) == std::string::npos;
+}
+
+bool MaxSatSolver::add_soft(const std::string& formula_str, uint64_t weight) {
+    if (weight == 0) return true;
+    if (is_atom(formula_str)) {
+        // Assume the atom itself; no relaxation variable needed
+        Lit l;
+        if (!sat_.literal(formula_str, l)) return false;
+        add_soft_literal(lit_neg(l), weight);
+        return true;
+    }
+    const Lit relax = make_lit(sat_.new_aux_var());
+    if (!sat_.add_relaxed(formula_str, relax)) return false;
+    add_soft_literal(relax, weight);
+    return true;
+}
+
+void MaxSatSolver::add_soft_literal(Lit violated, uint64_t weight) {
+    softs_.push_back({violated, weight});
+    add_term(violated, weight, -1, 0);
+}
+
+void MaxSatSolver::add_term(Lit violated, uint64_t weight, int sum, size_t index) {
+    auto result = term_of_.emplace(lit_neg(violated), terms_.size());
+    if (result.second) {
+        terms_.push_back({violated, weight, sum, index});
+    } else {
+        terms_[result.first->second].weight += weight;
+    }
+}
+
+void MaxSatSolver::relax_core(const std::vector<Lit>& core) {
+    uint64_t w_min = std::numeric_limits<uint64_t>::max();
+    for (Lit a : core) w_min = std::min(w_min, terms_[term_of_.at(a)].weight);
+    lower_bound_ += w_min;
+
+    std::vector<Lit> violated;
+    violated.reserve(core.size());
+    for (Lit a : core) {
+        const size_t t = term_of_.at(a);
+        terms_[t].weight -= w_min;
+        violated.push_back(terms_[t].violated);
+        // "More than index+1 of the sum violated" was paid for; the next count costs w_min
+        const int sum = terms_[t].sum;
+        const size_t next = terms_[t].index + 1;
+        if (sum >= 0 && next < totalizers_[sum].outputs().size()) {
+            add_term(totalizers_[sum].outputs()[next], w_min, sum, next);
+        }
+    }
+
+    if (violated.size() == 1) {
+        sat_.add_clause(violated.data(), 1);   // Unit core: must be violated in any model
+        return;
+    }
+    // At least one member is violated (the core); a second one costs w_min again
+    totalizers_.emplace_back(sat_.sink(), violated);
+    const int sum = static_cast<int>(totalizers_.size() - 1);
+    add_term(totalizers_.back().outputs()[1], w_min, sum, 1);
+}
+
+uint64_t MaxSatSolver::model_cost() const {
+    uint64_t total = 0;
+    for (const Soft& s : softs_) {
+        if (sat_.model_value(lit_var(s.violated)) != lit_negated(s.violated)) total += s.weight;
+    }
+    return total;
+}
+
+SolverStatus MaxSatSolver::optimize() {
+    const auto start = std::chrono::steady_clock::now();
+    has_model_ = false;
+    model_.clear();
+    cost_ = 0;
+
+    // Stratification: only terms at least this heavy are assumed
+    uint64_t threshold = 1;
+    if (stratify_) {
+        for (const Term& t : terms_) threshold = std::max(threshold, t.weight);
+    }
+
+    // First call without assumptions: hard constraints alone, and a first upper bound
+    std::vector<Lit> assumptions;
+    bool hard_checked = false;
+    while (true) {
+        uint64_t remaining = 0;
+        if (timeout_ms_ > 0) {
+            const uint64_t elapsed = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start).count());
+            if (elapsed >= timeout_ms_) return SolverStatus::TIMEOUT;
+            remaining = timeout_ms_ - elapsed;
+        }
+        sat_.set_param("timeout", std::to_string(remaining));
+
+        assumptions.clear();
+        if (hard_checked) {
+            for (const Term& t : terms_) {
+                if (t.weight > 0 && t.weight >= threshold) assumptions.push_back(lit_neg(t.violated));
+            }
+        }
+
+        const SolverStatus status = sat_.solve_literals(assumptions);
+        if (status == SolverStatus::SATISFIABLE) {
+            const uint64_t c = model_cost();
+            if (!has_model_ || c < cost_) {
+                has_model_ = true;
+                cost_ = c;
+                model_ = sat_.get_model();
+            }
+            if (!hard_checked) {
+                hard_checked = true;
+                if (cost_ > lower_bound_) continue;
+            }
+            // Next stratum: the heaviest terms left out so far
+            uint64_t next = 0;
+            for (const Term& t : terms_) {
+                if (t.weight > 0 && t.weight < threshold) next = std::max(next, t.weight);
+            }
+            if (next == 0 || cost_ <= lower_bound_) {
+                lower_bound_ = cost_;
+                return SolverStatus::SATISFIABLE;
+            }
+            threshold = next;
+        } else if (status == SolverStatus::UNSATISFIABLE) {
+            if (!hard_checked || sat_.core_literals().empty()) {
+                // The hard constraints alone conflict
+                has_model_ = false;
+                model_.clear();
+                return SolverStatus::UNSATISFIABLE;
+            }
+            relax_core(sat_.core_literals());
+        } else {
+            return status;
+        }
+    }
+}
+
+// WCNF text has a "p wcnf" header at the start of a line
+static bool is_wcnf(const std::string& text) {
+    size_t pos = 0;
+    while ((pos = text.find("p wcnf", pos)) != std::string::npos) {
+        if (pos == 0 || text[pos - 1] == '\n') return true;
+        ++pos;
+    }
+    return false;
+}
+
+SolverStatus MaxSatSolver::check(const std::string& formula_str) {
+    if (is_wcnf(formula_str) ? !parse_wcnf(formula_str) : !add(formula_str)) return SolverStatus::UNKNOWN;
+    return optimize();
+}
+
+bool MaxSatSolver::parse_wcnf(const std::string& text) {
+    // Read everything first so a malformed text adds nothing
+    struct WeightedClause {
+        bool hard;
+        uint64_t weight;
+        std::vector<long long> lits;
+    };
+    std::vector<WeightedClause> clauses;
+    uint64_t top = std::numeric_limits<uint64_t>::max();
+
+    const char* p = text.c_str();
+    const char* end = p + text.size();
+    bool in_clause = false;
+    while (p < end) {
+        while (p < end && std::strchr(" \t\r\n", *p) != nullptr) ++p;
+        if (p == end) break;
+        char* next = nullptr;
+        if (!in_clause && (*p == 'c' || *p == 'p')) {
+            const char* eol = std::find(p, end, '\n');
+            if (*p == 'p') {
+                // p wcnf <vars> <clauses> [<top>]
+                std::istringstream header(std::string(p, eol));
+                std::string p_word, format;
+                uint64_t vars = 0, count = 0, t = 0;
+                if (!(header >> p_word >> format >> vars >> count) || format != "wcnf") return false;
+                if (header >> t) top = t;
+            }
+            p = eol;
+        } else if (!in_clause) {
+            WeightedClause clause{false, 0, {}};
+            if (*p == 'h') {
+                clause.hard = true;
+                ++p;
+            } else {
+                clause.weight = std::strtoull(p, &next, 10);
+                if (next == p || *p == '-') return false;
+                clause.hard = clause.weight >= top;
+                p = next;
+            }
+            clauses.push_back(std::move(clause));
+            in_clause = true;
+        } else {
+            const long long lit = std::strtoll(p, &next, 10);
+            if (next == p) return false;
+            p = next;
+            if (lit == 0) in_clause = false;
+            else clauses.back().lits.push_back(lit);
+        }
+    }
+    if (in_clause) return false;
+
+    std::vector<Lit> lits;
+    for (WeightedClause& clause : clauses) {
+        lits.clear();
+        for (long long v : clause.lits) {
+            Lit l;
+            sat_.literal(std::to_string(v < 0 ? -v : v), l);
+            lits.push_back(v < 0 ? lit_neg(l) : l);
+        }
+        if (clause.hard) {
+            sat_.add_clause(lits.data(), lits.size());
+        } else if (clause.weight > 0) {
+            if (lits.size() == 1) {
+                add_soft_literal(lit_neg(lits[0]), clause.weight);
+            } else {
+                const Lit relax = make_lit(sat_.new_aux_var());
+                lits.push_back(relax);
+                sat_.add_clause(lits.data(), lits.size());
+                add_soft_literal(relax, clause.weight);
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace logic
+} // namespace minni
@@ -0,0 +1,134 @@
+#ifndef MINNI_CORE_LOGIC_MAX_SAT_SOLVER_H_
+#define MINNI_CORE_LOGIC_MAX_SAT_SOLVER_H_
+
+#include "SolverInterface.h"
+#include "SatSolver.h"
+#include "PbEncoder.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace minni {
+namespace logic {
+
+/**
+ * Weighted partial MaxSAT: hard constraints must hold, each soft constraint costs its
+ * weight when violated, and check() returns a model of minimum total cost.
+ *
+ * Core-guided search (OLL): solve with every soft constraint assumed satisfied; an
+ * UNSAT core says at least one of its members must be violated, so the lower bound
+ * rises by the smallest weight in it, that weight is taken off each member, and a
+ * Totalizer over the members adds the relaxed objective term "at least two of these
+ * violated" (then three, ... as later cores hit it). The first model found is optimal.
+ * Weights are stratified: heavy soft constraints are assumed first, lighter ones
+ * join when a stratum is satisfiable, and each such model bounds the cost from above.
+ *
+ * Constraints live in one incremental SatSolver, so learned clauses carry over
+ * between the many SAT calls. Names and syntax are the SatSolver ones.
+ *
+ * Parameters: "timeout" (ms) bounds the whole optimization; "stratify" "true"
+ * (default) | "false"; everything else ("threads", "restart", "max_conflicts", ...)
+ * applies to each SAT call, except "mode": the search needs CDCL's UNSAT cores.
+ *
+ * check() also accepts WCNF text ("p wcnf vars clauses top" header; clauses with
+ * weight >= top, or starting with 'h', are hard); variables are then named by number.
+ */
+class MaxSatSolver : public SolverInterface {
+public:
+    MaxSatSolver();
+    ~MaxSatSolver() override;
+
+    bool initialize() override;
+
+    /**
+     * Add formula_str as hard constraints (or load a WCNF text) and optimize over
+     * everything added so far. Unlike SatSolver::check() nothing is cleared first,
+     * so soft constraints added before are included; reset() starts over.
+     * @return SATISFIABLE with an optimal model, UNSATISFIABLE if the hard constraints
+     *         conflict, TIMEOUT / UNKNOWN if stopped first (get_model() then holds the
+     *         best model found, if any).
+     */
+    SolverStatus check(const std::string& formula_str) override;
+    std::unordered_map<std::string, std::string> get_model() override;
+    void reset() override;
+    void set_param(const std::string& key, const std::string& value) override;
+
+    /**
+     * SatSolver::get_stats() summed over the SAT calls since reset().
+     */
+    std::unordered_map<std::string, std::string> get_stats() override;
+
+    /**
+     * Hard constraints.
+     */
+    bool add(const std::string& formula_str) override;
+    bool add_cardinality(const std::vector<std::string>& atoms, Compare compare, size_t k);
+    bool add_pseudo_boolean(const std::vector<std::string>& atoms, const std::vector<int64_t>& weights,
+                            Compare compare, int64_t bound);
+
+    /**
+     * Soft constraint: a formula (a single atom like "!overtime" is cheapest) whose
+     * violation costs `weight`. Weight 0 is ignored.
+     */
+    bool add_soft(const std::string& formula_str, uint64_t weight);
+
+    /**
+     * Optimize without adding anything (see check()).
+     */
+    SolverStatus optimize();
+
+    /**
+     * Cost of the model get_model() returns (optimal after SATISFIABLE).
+     */
+    uint64_t cost() const;
+
+    /**
+     * Proven lower bound on the optimum (equals cost() after SATISFIABLE).
+     */
+    uint64_t lower_bound() const;
+
+    /**
+     * Stop a running optimize() from another thread (see SatSolver::interrupt()).
+     */
+    void interrupt();
+
+private:
+    // A soft constraint: `violated` is true in a model that violates it
+    struct Soft {
+        Lit violated;
+        uint64_t weight;
+    };
+
+    // One term of the reformulated objective, kept false by assuming !violated.
+    // Core relaxation terms are output `index` of totalizers_[sum] (sum < 0 otherwise).
+    struct Term {
+        Lit violated;
+        uint64_t weight;
+        int sum;
+        size_t index;
+    };
+
+    SatSolver sat_;
+    std::vector<Soft> softs_;
+    std::vector<Term> terms_;
+    std::vector<Totalizer> totalizers_;
+    std::unordered_map<Lit, size_t> term_of_;   // Assumption (!violated) -> terms_ index
+
+    uint64_t timeout_ms_;
+    bool stratify_;
+    uint64_t lower_bound_;
+    uint64_t cost_;
+    bool has_model_;
+    std::unordered_map<std::string, std::string> model_;
+
+    void add_soft_literal(Lit violated, uint64_t weight);
+    void add_term(Lit violated, uint64_t weight, int sum, size_t index);
+    void relax_core(const std::vector<Lit>& core);
+    uint64_t model_cost() const;
+    bool parse_wcnf(const std::string& text);
+};
+
+} // namespace logic
+} // namespace minni
+
+#endif // MINNI_CORE_LOGIC_MAX_SAT_SOLVER_H_
@@ -0,0 +1,243 @@
+#include "PbEncoder.h"
+#include <algorithm>
+#include <map>
+
+namespace minni {
+namespace logic {
+
+// ------------------------------------------------------------------
+// Totalizer
+// ------------------------------------------------------------------
+
+Totalizer::Totalizer(const CnfSink& sink, const std::vector<Lit>& inputs, size_t limit)
+    : num_inputs_(inputs.size()) {
+    if (!inputs.empty() && limit > 0) outputs_ = build(sink, inputs.data(), inputs.size(), limit);
+}
+
+const std::vector<Lit>& Totalizer::outputs() const {
+    return outputs_;
+}
+
+size_t Totalizer::num_inputs() const {
+    return num_inputs_;
+}
+
+Lit Totalizer::at_most(size_t k) const {
+    return lit_neg(outputs_[k]);
+}
+
+std::vector<Lit> Totalizer::build(const CnfSink& sink, const Lit* inputs, size_t size, size_t limit) {
+    if (size == 1) return {inputs[0]};
+    const size_t half = size / 2;
+    const std::vector<Lit> a = build(sink, inputs, half, limit);
+    const std::vector<Lit> b = build(sink, inputs + half, size - half, limit);
+
+    std::vector<Lit> out(std::min(a.size() + b.size(), limit));
+    for (Lit& o : out) o = make_lit(sink.new_var());
+
+    // (i of a) and (j of b) true -> (i + j of out). Sums beyond the limit need no
+    // clause: a smaller (i', j') with i' + j' == limit already forces the top output.
+    Lit clause[3];
+    for (size_t i = 0; i <= a.size(); ++i) {
+        for (size_t j = 0; j <= b.size(); ++j) {
+            const size_t s = i + j;
+            if (s == 0 || s > out.size()) continue;
+            size_t n = 0;
+            if (i > 0) clause[n++] = lit_neg(a[i - 1]);
+            if (j > 0) clause[n++] = lit_neg(b[j - 1]);
+            clause[n++] = out[s - 1];
+            sink.add_clause(clause, n);
+        }
+    }
+    return out;
+}
+
+// ------------------------------------------------------------------
+// PbEncoder
+// ------------------------------------------------------------------
+
+static bool unsatisfiable(const CnfSink& sink) {
+    sink.add_clause(nullptr, 0);
+    return false;
+}
+
+bool PbEncoder::cardinality(const CnfSink& sink, const std::vector<Lit>& lits,
+                            Compare compare, size_t k) {
+    if (compare == Compare::AT_MOST) return at_most(sink, lits, k);
+    if (compare == Compare::EXACTLY && !at_most(sink, lits, k)) return false;
+
+    // At least k of lits == at most n - k of their negations
+    if (k == 0) return true;
+    if (k > lits.size()) return unsatisfiable(sink);
+    if (k == 1) {
+        sink.add_clause(lits.data(), lits.size());
+        return true;
+    }
+    std::vector<Lit> negated(lits.size());
+    for (size_t i = 0; i < lits.size(); ++i) negated[i] = lit_neg(lits[i]);
+    return at_most(sink, negated, lits.size() - k);
+}
+
+bool PbEncoder::at_most(const CnfSink& sink, const std::vector<Lit>& lits, size_t k) {
+    if (k >= lits.size()) return true;
+    if (k == 0) {
+        for (Lit l : lits) {
+            const Lit unit = lit_neg(l);
+            sink.add_clause(&unit, 1);
+        }
+        return true;
+    }
+    if (k == 1 && lits.size() <= 6) {
+        // Pairwise: at most 15 binary clauses and no auxiliary variables
+        for (size_t i = 0; i < lits.size(); ++i) {
+            for (size_t j = i + 1; j < lits.size(); ++j) {
+                const Lit pair[2] = {lit_neg(lits[i]), lit_neg(lits[j])};
+                sink.add_clause(pair, 2);
+            }
+        }
+        return true;
+    }
+    Totalizer counter(sink, lits, k + 1);
+    const Lit bound = counter.at_most(k);
+    sink.add_clause(&bound, 1);
+    return true;
+}
+
+bool PbEncoder::pseudo_boolean(const CnfSink& sink, const std::vector<Lit>& lits,
+                               const std::vector<int64_t>& weights, Compare compare, int64_t bound) {
+    const size_t n = std::min(lits.size(), weights.size());
+    auto encode = [&](int64_t sign) {
+        // sign * sum(w * l) <= sign * bound, with every weight made positive:
+        // w * l == w + (-w) * !l, so a negative weight flips its literal
+        std::vector<std::pair<int64_t, Lit>> terms;
+        terms.reserve(n);
+        int64_t rhs = sign * bound;
+        for (size_t i = 0; i < n; ++i) {
+            const int64_t w = sign * weights[i];
+            if (w > 0) {
+                terms.emplace_back(w, lits[i]);
+            } else if (w < 0) {
+                terms.emplace_back(-w, lit_neg(lits[i]));
+                rhs -= w;
+            }
+        }
+        return weighted_at_most(sink, terms, rhs);
+    };
+    if (compare != Compare::AT_LEAST && !encode(1)) return false;
+    if (compare != Compare::AT_MOST && !encode(-1)) return false;
+    return true;
+}
+
+namespace {
+
+constexpr Lit kTrueNode = ~static_cast<Lit>(0);
+constexpr Lit kFalseNode = ~static_cast<Lit>(1);
+constexpr int64_t kInfinity = std::numeric_limits<int64_t>::max() / 4;
+
+// Builds the ROBDD of sum(w_i * l_i for i >= level) <= K. Every node is valid for a
+// whole interval [lo, hi] of K, and nodes are shared through that interval.
+class BddBuilder {
+public:
+    BddBuilder(const CnfSink& sink, const std::vector<std::pair<int64_t, Lit>>& terms)
+        : sink_(sink), terms_(terms), suffix_(terms.size() + 1, 0), nodes_(terms.size()) {
+        for (size_t i = terms.size(); i-- > 0;) suffix_[i] = suffix_[i + 1] + terms[i].first;
+    }
+
+    Lit build(size_t level, int64_t k, int64_t& lo, int64_t& hi) {
+        if (k < 0) {
+            lo = -kInfinity;
+            hi = -1;
+            return kFalseNode;
+        }
+        if (k >= suffix_[level]) {
+            lo = suffix_[level];
+            hi = kInfinity;
+            return kTrueNode;
+        }
+        auto& level_nodes = nodes_[level];
+        auto it = level_nodes.upper_bound(k);
+        if (it != level_nodes.begin() && (--it)->second.hi >= k) {
+            lo = it->first;
+            hi = it->second.hi;
+            return it->second.node;
+        }
+
+        const int64_t w = terms_[level].first;
+        const Lit l = terms_[level].second;
+        int64_t lo0, hi0, lo1, hi1;
+        const Lit if_false = build(level + 1, k, lo0, hi0);       // l false
+        const Lit if_true = build(level + 1, k - w, lo1, hi1);    // l true: w used up
+        lo = std::max(lo0, lo1 + w);
+        hi = std::min(hi0, hi1 + w);
+
+        Lit node = if_false;
+        if (if_false != if_true) {
+            // node -> if_false, and node & l -> if_true. if_false cannot be the false
+            // terminal (k >= 0), and if_true is true only when if_false is too.
+            node = make_lit(sink_.new_var());
+            if (if_false != kTrueNode) {
+                const Lit keep[2] = {lit_neg(node), if_false};
+                sink_.add_clause(keep, 2);
+            }
+            if (if_true == kFalseNode) {
+                const Lit exclude[2] = {lit_neg(node), lit_neg(l)};
+                sink_.add_clause(exclude, 2);
+            } else {
+                const Lit take[3] = {lit_neg(node), lit_neg(l), if_true};
+                sink_.add_clause(take, 3);
+            }
+        }
+        level_nodes.emplace(lo, Interval{hi, node});
+        return node;
+    }
+
+private:
+    struct Interval {
+        int64_t hi;
+        Lit node;
+    };
+
+    const CnfSink& sink_;
+    const std::vector<std::pair<int64_t, Lit>>& terms_;
+    std::vector<int64_t> suffix_;                        // Sum of weights from level on
+    std::vector<std::map<int64_t, Interval>> nodes_;     // Per level, keyed by interval start
+};
+
+} // namespace
+
+bool PbEncoder::weighted_at_most(const CnfSink& sink, std::vector<std::pair<int64_t, Lit>>& terms,
+                                 int64_t bound) {
+    if (bound < 0) return unsatisfiable(sink);
+
+    // A term heavier than the bound can never be true
+    size_t j = 0;
+    for (size_t i = 0; i < terms.size(); ++i) {
+        if (terms[i].first > bound) {
+            const Lit unit = lit_neg(terms[i].second);
+            sink.add_clause(&unit, 1);
+        } else {
+            terms[j++] = terms[i];
+        }
+    }
+    terms.resize(j);
+    if (terms.empty()) return true;
+
+    std::sort(terms.begin(), terms.end(),
+              [](const std::pair<int64_t, Lit>& a, const std::pair<int64_t, Lit>& b) { return a.first > b.first; });
+    if (terms.front().first == terms.back().first) {
+        // Equal weights: a cardinality constraint
+        std::vector<Lit> lits(terms.size());
+        for (size_t i = 0; i < terms.size(); ++i) lits[i] = terms[i].second;
+        return at_most(sink, lits, static_cast<size_t>(bound / terms.front().first));
+    }
+
+    BddBuilder bdd(sink, terms);
+    int64_t lo, hi;
+    const Lit root = bdd.build(0, bound, lo, hi);
+    if (root == kFalseNode) return unsatisfiable(sink);
+    if (root != kTrueNode) sink.add_clause(&root, 1);
+    return true;
+}
+
+} // namespace logic
+} // namespace minni
@@ -0,0 +1,92 @@
+#ifndef MINNI_CORE_LOGIC_PB_ENCODER_H_
+#define MINNI_CORE_LOGIC_PB_ENCODER_H_
+
+#include "CdclSolver.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace minni {
+namespace logic {
+
+/**
+ * Where an encoding goes: fresh auxiliary variables and clauses over them.
+ * Binds to CdclSolver, PortfolioSolver or SatSolver with two lambdas.
+ */
+struct CnfSink {
+    std::function<uint32_t()> new_var;
+    std::function<void(const Lit* lits, size_t size)> add_clause;
+};
+
+/**
+ * Relation of a cardinality / pseudo-Boolean constraint to its bound.
+ */
+enum class Compare {
+    AT_MOST,    // sum <= bound
+    AT_LEAST,   // sum >= bound
+    EXACTLY     // sum == bound
+};
+
+/**
+ * Totalizer (Bailleux & Boufkhad): a balanced tree of unary adders over the inputs.
+ * outputs()[j] is forced true whenever more than j inputs are true, so asserting or
+ * assuming at_most(k) bounds the count. Only that direction is encoded, which is all
+ * upper bounds need. Counts above `limit` are not told apart (k-simplification), which
+ * keeps the tree at O(n * limit) clauses instead of O(n^2).
+ *
+ * The outputs stay valid after construction: MaxSatSolver tightens or relaxes the
+ * bound per call through assumptions without re-encoding.
+ */
+class Totalizer {
+public:
+    Totalizer(const CnfSink& sink, const std::vector<Lit>& inputs,
+              size_t limit = std::numeric_limits<size_t>::max());
+
+    const std::vector<Lit>& outputs() const;
+    size_t num_inputs() const;
+
+    /**
+     * Literal that holds only if at most k inputs are true (k < outputs().size()).
+     */
+    Lit at_most(size_t k) const;
+
+private:
+    std::vector<Lit> outputs_;
+    size_t num_inputs_;
+
+    static std::vector<Lit> build(const CnfSink& sink, const Lit* inputs, size_t size, size_t limit);
+};
+
+/**
+ * Cardinality and pseudo-Boolean constraints as clauses.
+ *
+ * - Cardinality (sum of literals vs k): units / a single clause for the trivial bounds,
+ *   pairwise at-most-one for short lists, otherwise a k-simplified Totalizer.
+ * - Pseudo-Boolean (sum of w_i * l_i vs bound, any signed weights): a reduced ordered
+ *   BDD over the terms sorted by decreasing weight (Abio et al.). Nodes that accept
+ *   the same interval of remaining bounds are shared, so the size follows the number
+ *   of distinct sub-constraints rather than the magnitude of the bound. Each node
+ *   costs one variable and at most two clauses. Unit weights go to the Totalizer.
+ *
+ * Both return false (after emitting an empty clause) if the constraint cannot hold.
+ */
+class PbEncoder {
+public:
+    static bool cardinality(const CnfSink& sink, const std::vector<Lit>& lits,
+                            Compare compare, size_t k);
+
+    static bool pseudo_boolean(const CnfSink& sink, const std::vector<Lit>& lits,
+                               const std::vector<int64_t>& weights, Compare compare, int64_t bound);
+
+private:
+    static bool at_most(const CnfSink& sink, const std::vector<Lit>& lits, size_t k);
+    static bool weighted_at_most(const CnfSink& sink, std::vector<std::pair<int64_t, Lit>>& terms,
+                                 int64_t bound);
+};
+
+} // namespace logic
+} // namespace minni
+
+#endif // MINNI_CORE_LOGIC_PB_ENCODER_H_
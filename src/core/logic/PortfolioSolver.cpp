@@ -0,0 +1,166 @@
+#include "PortfolioSolver.h"
+#include <algorithm>
+#include <thread>
+
+namespace minni {
+namespace logic {
+
+namespace {
+
+const size_t kExchangeSlots = 1 << 14;
+
+} // namespace
+
+PortfolioSolver::PortfolioSolver(size_t num_workers, const CdclSolver::Options& options)
+    : winner_(0) {
+    if (num_workers == 0) num_workers = std::max<unsigned>(1, std::thread::hardware_concurrency());
+    if (num_workers > 1) exchange_.reset(new ClauseExchange(kExchangeSlots));
+    for (size_t i = 0; i < num_workers; ++i) {
+        workers_.emplace_back(new CdclSolver(diversify(options, i)));
+        if (exchange_) workers_[i]->set_exchange(exchange_.get(), static_cast<uint32_t>(i));
+    }
+}
+
+PortfolioSolver::~PortfolioSolver() = default;
+
+CdclSolver::Options PortfolioSolver::diversify(const CdclSolver::Options& base, size_t index) {
+    CdclSolver::Options options = base;
+    if (index == 0) return options;
+    if (index % 2 == 1) {
+        options.restart = base.restart == CdclSolver::Restart::LUBY ? CdclSolver::Restart::GLUCOSE
+                                                                    : CdclSolver::Restart::LUBY;
+    }
+    if ((index / 2) % 2 == 1) options.initial_phase = !base.initial_phase;
+    if (index >= 2) options.seed = base.seed + index;
+    if (index >= 4) {
+        options.random_phase = true;
+        options.random_branch = 0.02;
+    }
+    return options;
+}
+
+uint32_t PortfolioSolver::new_var() {
+    uint32_t var = 0;
+    for (auto& w : workers_) var = w->new_var();
+    return var;
+}
+
+uint32_t PortfolioSolver::num_vars() const {
+    return workers_[0]->num_vars();
+}
+
+bool PortfolioSolver::add_clause(const std::vector<Lit>& lits) {
+    return add_clause(lits.data(), lits.size());
+}
+
+bool PortfolioSolver::add_clause(const Lit* lits, size_t size) {
+    bool ok = true;
+    for (auto& w : workers_) ok = w->add_clause(lits, size) && ok;
+    return ok;
+}
+
+SolverStatus PortfolioSolver::solve() {
+    return solve(nullptr, 0);
+}
+
+SolverStatus PortfolioSolver::solve(const std::vector<Lit>& assumptions) {
+    return solve(assumptions.data(), assumptions.size());
+}
+
+SolverStatus PortfolioSolver::solve(const Lit* assumptions, size_t size) {
+    winner_ = 0;
+    if (workers_.size() == 1) return workers_[0]->solve(assumptions, size);
+
+    // Same variables everywhere before any clause is shared
+    for (size_t i = 0; i < size; ++i) {
+        while (lit_var(assumptions[i]) >= num_vars()) new_var();
+    }
+
+    const size_t n = workers_.size();
+    std::vector<SolverStatus> results(n, SolverStatus::UNKNOWN);
+    std::atomic<int> first(-1);
+
+    auto worker = [&](size_t t) {
+        results[t] = workers_[t]->solve(assumptions, size);
+        if (results[t] != SolverStatus::SATISFIABLE && results[t] != SolverStatus::UNSATISFIABLE) return;
+        int expected = -1;
+        if (first.compare_exchange_strong(expected, static_cast<int>(t))) {
+            for (size_t k = 0; k < n; ++k) {
+                if (k != t) workers_[k]->interrupt();
+            }
+        }
+    };
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < n; ++t) pool.emplace_back(worker, t);
+    worker(0);
+    for (auto& th : pool) th.join();
+
+    const int w = first.load();
+    if (w < 0) {
+        const bool timeout = std::find(results.begin(), results.end(), SolverStatus::TIMEOUT) != results.end();
+        return timeout ? SolverStatus::TIMEOUT : SolverStatus::UNKNOWN;
+    }
+    // The answer consumed the interrupts (ours, and a caller's that raced with it)
+    for (auto& s : workers_) s->clear_interrupt();
+    winner_ = static_cast<size_t>(w);
+    return results[winner_];
+}
+
+const std::vector<Lit>& PortfolioSolver::core() const {
+    return workers_[winner_]->core();
+}
+
+bool PortfolioSolver::model_value(uint32_t var) const {
+    return workers_[winner_]->model_value(var);
+}
+
+void PortfolioSolver::push() {
+    for (auto& w : workers_) w->push();
+}
+
+bool PortfolioSolver::pop() {
+    bool ok = true;
+    for (auto& w : workers_) ok = w->pop() && ok;
+    return ok;
+}
+
+size_t PortfolioSolver::scope_depth() const {
+    return workers_[0]->scope_depth();
+}
+
+void PortfolioSolver::set_limits(const CdclSolver::Limits& limits) {
+    for (auto& w : workers_) w->set_limits(limits);
+}
+
+void PortfolioSolver::interrupt() {
+    for (auto& w : workers_) w->interrupt();
+}
+
+void PortfolioSolver::clear_interrupt() {
+    for (auto& w : workers_) w->clear_interrupt();
+}
+
+void PortfolioSolver::set_interrupt_flag(const std::atomic<bool>* flag) {
+    for (auto& w : workers_) w->set_interrupt_flag(flag);
+}
+
+size_t PortfolioSolver::num_workers() const {
+    return workers_.size();
+}
+
+const CdclSolver& PortfolioSolver::worker(size_t index) const {
+    return *workers_[index];
+}
+
+CdclSolver::Stats PortfolioSolver::stats() const {
+    CdclSolver::Stats total;
+    for (const auto& w : workers_) total += w->stats();
+    return total;
+}
+
+size_t PortfolioSolver::winner() const {
+    return winner_;
+}
+
+} // namespace logic
+} // namespace minni
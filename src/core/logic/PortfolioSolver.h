@@ -0,0 +1,103 @@
+#ifndef MINNI_CORE_LOGIC_PORTFOLIO_SOLVER_H_
+#define MINNI_CORE_LOGIC_PORTFOLIO_SOLVER_H_
+
+#include "CdclSolver.h"
+#include "ClauseExchange.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace minni {
+namespace logic {
+
+/**
+ * Parallel portfolio over CdclSolver.
+ * Runs N copies of the same formula with diversified options (restart policy, initial
+ * phase, seeded variable order, random decisions) on N threads; the first definitive
+ * answer wins and interrupts the rest. Learned units and short low-LBD clauses are
+ * shared through a ClauseExchange, so each worker profits from the others' conflicts.
+ *
+ * Mirrors the CdclSolver interface (clauses, assumptions, scopes, limits), so callers
+ * can switch between one engine and a portfolio. With one worker no thread is started
+ * and nothing is shared: it behaves exactly like a CdclSolver.
+ */
+class PortfolioSolver {
+public:
+    /**
+     * @param num_workers Solver instances / threads (0 = hardware concurrency).
+     * @param options Options of worker 0; the others derive theirs via diversify().
+     */
+    explicit PortfolioSolver(size_t num_workers, const CdclSolver::Options& options = CdclSolver::Options());
+    ~PortfolioSolver();
+
+    PortfolioSolver(const PortfolioSolver&) = delete;
+    PortfolioSolver& operator=(const PortfolioSolver&) = delete;
+
+    uint32_t new_var();
+    uint32_t num_vars() const;
+    bool add_clause(const Lit* lits, size_t size);
+    bool add_clause(const std::vector<Lit>& lits);
+
+    /**
+     * Solve on all workers in parallel.
+     * @return The first SATISFIABLE / UNSATISFIABLE answer; otherwise TIMEOUT if the
+     *         time limit ran out, else UNKNOWN.
+     */
+    SolverStatus solve();
+    SolverStatus solve(const Lit* assumptions, size_t size);
+    SolverStatus solve(const std::vector<Lit>& assumptions);
+
+    /**
+     * Core / model of the worker that answered last.
+     */
+    const std::vector<Lit>& core() const;
+    bool model_value(uint32_t var) const;
+
+    void push();
+    bool pop();
+    size_t scope_depth() const;
+
+    /**
+     * Limits apply to every worker separately (e.g. conflicts per worker).
+     */
+    void set_limits(const CdclSolver::Limits& limits);
+
+    /**
+     * Stop all workers (thread-safe). As with CdclSolver the request stays pending
+     * until clear_interrupt(), unless a worker answers first.
+     */
+    void interrupt();
+    void clear_interrupt();
+    void set_interrupt_flag(const std::atomic<bool>* flag);
+
+    size_t num_workers() const;
+    const CdclSolver& worker(size_t index) const;
+
+    /**
+     * Statistics summed over all workers (times are therefore CPU time).
+     */
+    CdclSolver::Stats stats() const;
+
+    /**
+     * Index of the worker that answered the last solve() (0 if none did).
+     */
+    size_t winner() const;
+
+    /**
+     * Options of worker `index`: 0 keeps `base`, odd workers switch the restart
+     * policy, every second pair flips the initial phase, and workers from 2 on get
+     * their own seed (random order; from 4 on also random phases and 2% random
+     * decisions).
+     */
+    static CdclSolver::Options diversify(const CdclSolver::Options& base, size_t index);
+
+private:
+    std::vector<std::unique_ptr<CdclSolver>> workers_;
+    std::unique_ptr<ClauseExchange> exchange_;
+    size_t winner_;
+};
+
+} // namespace logic
+} // namespace minni
+
+#endif // MINNI_CORE_LOGIC_PORTFOLIO_SOLVER_H_
@@ -0,0 +1,438 @@
+#include "Preprocessor.h"
+#include <algorithm>
+
+namespace minni {
+namespace logic {
+
+Preprocessor::Preprocessor() : Preprocessor(Options()) {}
+
+Preprocessor::Preprocessor(const Options& options)
+    : options_(options),
+      ok_(true),
+      live_(0),
+      steps_(0) {
+}
+
+void Preprocessor::ensure_var(uint32_t var) {
+    if (var < value_.size()) return;
+    value_.resize(var + 1, 0);
+    frozen_.resize(var + 1, 0);
+    eliminated_.resize(var + 1, 0);
+    marks_.resize(2 * (var + 1), 0);
+    occs_.resize(2 * (var + 1));
+}
+
+uint32_t Preprocessor::num_vars() const {
+    return static_cast<uint32_t>(value_.size());
+}
+
+size_t Preprocessor::num_clauses() const {
+    return live_;
+}
+
+const Preprocessor::Stats& Preprocessor::stats() const {
+    return stats_;
+}
+
+int8_t Preprocessor::value(Lit l) const {
+    const int8_t v = value_[lit_var(l)];
+    return lit_negated(l) ? static_cast<int8_t>(-v) : v;
+}
+
+uint64_t Preprocessor::signature(const std::vector<Lit>& lits) {
+    uint64_t sig = 0;
+    for (Lit l : lits) sig |= 1ull << (lit_var(l) & 63);
+    return sig;
+}
+
+bool Preprocessor::exhausted() const {
+    return steps_ >= options_.effort;
+}
+
+void Preprocessor::freeze(uint32_t var) {
+    ensure_var(var);
+    frozen_[var] = 1;
+}
+
+bool Preprocessor::is_removed(uint32_t var) const {
+    return var < value_.size() && (value_[var] != 0 || eliminated_[var]);
+}
+
+void Preprocessor::add_clause(const std::vector<Lit>& lits) {
+    add_clause(lits.data(), lits.size());
+}
+
+void Preprocessor::add_clause(const Lit* lits, size_t size) {
+    std::vector<Lit> clause(lits, lits + size);
+    std::sort(clause.begin(), clause.end());
+    clause.erase(std::unique(clause.begin(), clause.end()), clause.end());
+    for (size_t i = 1; i < clause.size(); ++i) {
+        if (clause[i] == lit_neg(clause[i - 1])) return;   // Tautology
+    }
+    if (!clause.empty()) ensure_var(lit_var(clause.back()));
+    ++stats_.clauses_before;
+    push_clause(clause);
+}
+
+void Preprocessor::push_clause(std::vector<Lit>& lits) {
+    if (lits.empty()) {
+        ok_ = false;
+        return;
+    }
+    const uint32_t index = static_cast<uint32_t>(clauses_.size());
+    for (Lit l : lits) occs_[l].push_back(index);
+    const uint64_t sig = signature(lits);
+    clauses_.push_back(Clause{std::move(lits), sig, false});
+    ++live_;
+}
+
+void Preprocessor::remove_clause(uint32_t index) {
+    Clause& c = clauses_[index];
+    if (c.removed) return;
+    c.removed = true;
+    --live_;
+    std::vector<Lit>().swap(c.lits);
+}
+
+bool Preprocessor::assign(Lit l) {
+    const int8_t v = value(l);
+    if (v > 0) return true;
+    if (v < 0) return ok_ = false;
+    value_[lit_var(l)] = lit_negated(l) ? -1 : 1;
+    stack_.push_back({l});
+    units_.push_back(l);
+    ++stats_.fixed;
+    return true;
+}
+
+void Preprocessor::strengthen(uint32_t index, Lit l, bool update_occs) {
+    Clause& c = clauses_[index];
+    c.lits.erase(std::find(c.lits.begin(), c.lits.end(), l));
+    c.sig = signature(c.lits);
+    if (update_occs) {
+        std::vector<uint32_t>& os = occs_[l];
+        os.erase(std::find(os.begin(), os.end(), index));
+    }
+    if (c.lits.size() == 1) {
+        assign(c.lits[0]);
+        remove_clause(index);
+    } else if (c.lits.empty()) {
+        ok_ = false;
+    }
+}
+
+bool Preprocessor::propagate_units() {
+    while (ok_ && !units_.empty()) {
+        const Lit l = units_.back();
+        units_.pop_back();
+        for (uint32_t i : occs_[l]) remove_clause(i);
+        for (uint32_t i : occs_[lit_neg(l)]) {
+            if (!clauses_[i].removed) strengthen(i, lit_neg(l), false);
+        }
+        std::vector<uint32_t>().swap(occs_[l]);
+        std::vector<uint32_t>().swap(occs_[lit_neg(l)]);
+    }
+    return ok_;
+}
+
+const std::vector<uint32_t>& Preprocessor::live_occs(Lit l) {
+    std::vector<uint32_t>& os = occs_[l];
+    os.erase(std::remove_if(os.begin(), os.end(), [this](uint32_t i) { return clauses_[i].removed; }),
+             os.end());
+    return os;
+}
+
+// ---------------------------------------------------------------------------
+// Subsumption and self-subsuming resolution
+// ---------------------------------------------------------------------------
+
+bool Preprocessor::subsume_all() {
+    // Backward: each clause C, shortest first, removes the clauses it subsumes and
+    // strengthens D to D \ {!l} when C = C' + l and C' + !l is a subset of D
+    std::vector<uint32_t> order;
+    for (uint32_t i = 0; i < clauses_.size(); ++i) {
+        if (!clauses_[i].removed) order.push_back(i);
+    }
+    std::stable_sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) {
+        return clauses_[a].lits.size() < clauses_[b].lits.size();
+    });
+
+    bool progress = false;
+    std::vector<uint32_t> candidates;
+    for (uint32_t ci : order) {
+        if (!ok_ || exhausted()) break;
+        if (clauses_[ci].removed) continue;
+
+        // Fewest occurrences: every clause C can touch contains this variable
+        Lit best = clauses_[ci].lits[0];
+        size_t best_count = SIZE_MAX;
+        for (Lit l : clauses_[ci].lits) {
+            const size_t count = occs_[l].size() + occs_[lit_neg(l)].size();
+            if (count < best_count) {
+                best = l;
+                best_count = count;
+            }
+        }
+        candidates = occs_[best];
+        candidates.insert(candidates.end(), occs_[lit_neg(best)].begin(), occs_[lit_neg(best)].end());
+        steps_ += candidates.size();
+
+        for (Lit l : clauses_[ci].lits) marks_[l] = 1;
+        const size_t size = clauses_[ci].lits.size();
+        const uint64_t sig = clauses_[ci].sig;
+        for (uint32_t di : candidates) {
+            const Clause& d = clauses_[di];
+            if (di == ci || d.removed || d.lits.size() < size || (sig & ~d.sig) != 0) continue;
+            steps_ += d.lits.size();
+            size_t matched = 0, flipped = 0;
+            Lit flip = 0;
+            for (Lit l : d.lits) {
+                if (marks_[l]) {
+                    ++matched;
+                } else if (marks_[lit_neg(l)]) {
+                    ++flipped;
+                    flip = l;
+                }
+            }
+            if (matched + flipped != size || flipped > 1) continue;
+            if (flipped == 0) {
+                remove_clause(di);
+                ++stats_.subsumed;
+            } else {
+                strengthen(di, flip, true);
+                ++stats_.strengthened;
+            }
+            progress = true;
+            if (!ok_) break;
+        }
+        // Only other clauses change above, so C still holds exactly the marked literals
+        for (Lit l : clauses_[ci].lits) marks_[l] = 0;
+        if (!propagate_units()) break;
+    }
+    return progress;
+}
+
+// ---------------------------------------------------------------------------
+// Pure literals and bounded variable elimination
+// ---------------------------------------------------------------------------
+
+bool Preprocessor::eliminate_pure() {
+    bool progress = false;
+    for (uint32_t v = 0; v < num_vars() && ok_; ++v) {
+        if (frozen_[v] || eliminated_[v] || value_[v] != 0) continue;
+        const Lit pos = make_lit(v), neg = make_lit(v, true);
+        const bool has_pos = !live_occs(pos).empty();
+        const bool has_neg = !live_occs(neg).empty();
+        if (has_pos == has_neg) continue;   // Both polarities, or no occurrence at all
+        const Lit pure = has_pos ? pos : neg;
+        for (uint32_t i : occs_[pure]) remove_clause(i);
+        std::vector<uint32_t>().swap(occs_[pure]);
+        stack_.push_back({pure});
+        eliminated_[v] = 1;
+        ++stats_.pure;
+        progress = true;
+    }
+    return progress;
+}
+
+bool Preprocessor::eliminate(uint32_t var) {
+    const Lit pos = make_lit(var), neg = make_lit(var, true);
+    const std::vector<uint32_t> ps = live_occs(pos);
+    const std::vector<uint32_t> ns = live_occs(neg);
+    if (ps.empty() || ns.empty()) return false;   // Pure: eliminate_pure()'s job
+    if (ps.size() > options_.elim_occ_limit || ns.size() > options_.elim_occ_limit) return false;
+
+    // All non-tautological resolvents, abandoned as soon as the bound is exceeded
+    const size_t bound = ps.size() + ns.size() + static_cast<size_t>(std::max(0, options_.elim_grow));
+    std::vector<std::vector<Lit>> resolvents;
+    std::vector<Lit> r;
+    for (uint32_t pi : ps) {
+        const std::vector<Lit>& p = clauses_[pi].lits;
+        for (Lit l : p) marks_[l] = 1;
+        bool over = false;
+        for (uint32_t ni : ns) {
+            const std::vector<Lit>& n = clauses_[ni].lits;
+            steps_ += n.size();
+            r.clear();
+            bool tautology = false;
+            for (Lit l : n) {
+                if (l == neg) continue;
+                if (marks_[lit_neg(l)]) {
+                    tautology = true;
+                    break;
+                }
+                if (!marks_[l]) r.push_back(l);
+            }
+            if (tautology) continue;
+            for (Lit l : p) {
+                if (l != pos) r.push_back(l);
+            }
+            if (resolvents.size() + 1 > bound || r.size() > options_.elim_clause_limit) {
+                over = true;
+                break;
+            }
+            std::sort(r.begin(), r.end());
+            resolvents.push_back(r);
+        }
+        for (Lit l : p) marks_[l] = 0;
+        if (over) return false;
+    }
+
+    // Commit: save both sides for reconstruction (the variable's literal first)
+    for (uint32_t i : ps) {
+        std::vector<Lit> saved = clauses_[i].lits;
+        std::iter_swap(saved.begin(), std::find(saved.begin(), saved.end(), pos));
+        stack_.push_back(std::move(saved));
+        remove_clause(i);
+    }
+    for (uint32_t i : ns) {
+        std::vector<Lit> saved = clauses_[i].lits;
+        std::iter_swap(saved.begin(), std::find(saved.begin(), saved.end(), neg));
+        stack_.push_back(std::move(saved));
+        remove_clause(i);
+    }
+    std::vector<uint32_t>().swap(occs_[pos]);
+    std::vector<uint32_t>().swap(occs_[neg]);
+    eliminated_[var] = 1;
+    ++stats_.eliminated;
+
+    for (std::vector<Lit>& c : resolvents) {
+        if (c.size() == 1) {
+            assign(c[0]);
+        } else {
+            push_clause(c);
+        }
+    }
+    propagate_units();
+    return true;
+}
+
+bool Preprocessor::eliminate_all() {
+    // Cheapest variables first (fewest resolution pairs)
+    std::vector<uint32_t> order;
+    std::vector<size_t> cost(num_vars(), 0);
+    for (uint32_t v = 0; v < num_vars(); ++v) {
+        if (frozen_[v] || eliminated_[v] || value_[v] != 0) continue;
+        cost[v] = live_occs(make_lit(v)).size() * live_occs(make_lit(v, true)).size();
+        if (cost[v] > 0) order.push_back(v);
+    }
+    std::stable_sort(order.begin(), order.end(), [&cost](uint32_t a, uint32_t b) { return cost[a] < cost[b]; });
+
+    bool progress = false;
+    for (uint32_t v : order) {
+        if (!ok_ || exhausted()) break;
+        if (eliminated_[v] || value_[v] != 0) continue;
+        if (eliminate(v)) progress = true;
+    }
+    return progress;
+}
+
+// ---------------------------------------------------------------------------
+// Failed literal probing
+// ---------------------------------------------------------------------------
+
+bool Preprocessor::probe(Lit l) {
+    // Propagate l over the current clauses; value_ is restored before returning
+    std::vector<Lit> trail(1, l);
+    value_[lit_var(l)] = lit_negated(l) ? -1 : 1;
+    bool conflict = false;
+    for (size_t head = 0; head < trail.size() && !conflict; ++head) {
+        for (uint32_t i : occs_[lit_neg(trail[head])]) {
+            const Clause& c = clauses_[i];
+            if (c.removed) continue;
+            steps_ += c.lits.size();
+            Lit unit = 0;
+            size_t open = 0;
+            bool satisfied = false;
+            for (Lit q : c.lits) {
+                const int8_t v = value(q);
+                if (v > 0) {
+                    satisfied = true;
+                    break;
+                }
+                if (v == 0) {
+                    ++open;
+                    unit = q;
+                }
+            }
+            if (satisfied || open > 1) continue;
+            if (open == 0) {
+                conflict = true;
+                break;
+            }
+            value_[lit_var(unit)] = lit_negated(unit) ? -1 : 1;
+            trail.push_back(unit);
+        }
+    }
+    for (Lit q : trail) value_[lit_var(q)] = 0;
+    return conflict;
+}
+
+bool Preprocessor::probe_all() {
+    // Probe roots of the binary implication graph only: l with some (!l | x) but no
+    // (!y | l). A failed literal below a root makes the root fail as well.
+    std::vector<uint8_t> in_binary(2 * num_vars(), 0);
+    for (const Clause& c : clauses_) {
+        if (c.removed || c.lits.size() != 2) continue;
+        in_binary[c.lits[0]] = in_binary[c.lits[1]] = 1;
+    }
+    const uint64_t stop = std::min(options_.effort, steps_ + options_.probe_effort);
+    bool progress = false;
+    for (uint32_t v = 0; v < num_vars() && ok_ && steps_ < stop; ++v) {
+        if (eliminated_[v] || value_[v] != 0) continue;
+        for (Lit l : {make_lit(v), make_lit(v, true)}) {
+            if (value_[v] != 0 || !in_binary[lit_neg(l)] || in_binary[l]) continue;
+            if (probe(l)) {
+                ++stats_.failed;
+                progress = true;
+                if (!assign(lit_neg(l)) || !propagate_units()) return true;
+            }
+        }
+    }
+    return progress;
+}
+
+// ---------------------------------------------------------------------------
+
+bool Preprocessor::run() {
+    if (!ok_) return false;
+    for (uint32_t i = 0; i < clauses_.size(); ++i) {
+        if (!clauses_[i].removed && clauses_[i].lits.size() == 1) {
+            assign(clauses_[i].lits[0]);
+            remove_clause(i);
+        }
+    }
+    propagate_units();
+
+    bool progress = true;
+    for (int round = 0; round < options_.rounds && progress && ok_ && !exhausted(); ++round) {
+        progress = false;
+        if (options_.subsumption && ok_) progress = subsume_all() || progress;
+        if (options_.pure_literals && ok_) progress = eliminate_pure() || progress;
+        if (options_.elimination && ok_) progress = eliminate_all() || progress;
+        if (options_.probing && ok_) progress = probe_all() || progress;
+    }
+    stats_.clauses_after = live_;
+    return ok_;
+}
+
+void Preprocessor::for_each_clause(const ClauseHandler& on_clause) const {
+    for (const Clause& c : clauses_) {
+        if (!c.removed) on_clause(c.lits.data(), c.lits.size());
+    }
+}
+
+void Preprocessor::extend_model(std::vector<int8_t>& model) const {
+    if (model.size() < num_vars()) model.resize(num_vars(), 0);
+    // Unassigned counts as false, as in SatSolver::get_model()
+    auto is_true = [&model](Lit l) { return (model[lit_var(l)] > 0) != lit_negated(l); };
+    for (size_t i = stack_.size(); i > 0; --i) {
+        const std::vector<Lit>& c = stack_[i - 1];
+        if (std::none_of(c.begin(), c.end(), is_true)) {
+            model[lit_var(c[0])] = lit_negated(c[0]) ? -1 : 1;
+        }
+    }
+}
+
+} // namespace logic
+} // namespace minni
@@ -0,0 +1,149 @@
+#ifndef MINNI_CORE_LOGIC_PREPROCESSOR_H_
+#define MINNI_CORE_LOGIC_PREPROCESSOR_H_
+
+#include "CdclSolver.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace minni {
+namespace logic {
+
+/**
+ * CNF simplification before search (SatELite-style).
+ *
+ * - Unit propagation at the top level.
+ * - Pure literal elimination.
+ * - Subsumption and self-subsuming resolution (clause strengthening), with 64-bit
+ *   variable signatures to reject most candidate pairs without touching literals.
+ * - Bounded variable elimination: a variable is resolved away when that does not
+ *   increase the clause count (plus Options::elim_grow) or create long clauses.
+ * - Failed literal probing: if assuming l propagates to a conflict, !l is a unit.
+ *   Only roots of the binary implication graph are probed.
+ *
+ * The result is equisatisfiable, not equivalent: variables that were fixed, pure or
+ * eliminated no longer occur. extend_model() turns a model of the simplified clauses
+ * into a model of the original ones (reconstruction stack, replayed backwards).
+ *
+ * Usage: add_clause() the whole formula, freeze() variables that later clauses or
+ * assumptions will mention, run(), solve the clauses from for_each_clause(), then
+ * extend_model().
+ */
+class Preprocessor {
+public:
+    struct Options {
+        bool pure_literals = true;
+        bool subsumption = true;          // Includes self-subsuming resolution
+        bool elimination = true;          // Bounded variable elimination
+        bool probing = true;              // Failed literal probing
+        size_t elim_occ_limit = 16;       // Skip variables with more occurrences per polarity
+        size_t elim_clause_limit = 20;    // Longest resolvent elimination may create
+        int elim_grow = 0;                // Clause count increase allowed per elimination
+        uint64_t effort = 50000000;       // Budget in literal visits across all passes
+        uint64_t probe_effort = 2000000;  // Share of it one probing pass may use
+        int rounds = 3;                   // Passes over all techniques while they make progress
+    };
+
+    struct Stats {
+        size_t clauses_before = 0;
+        size_t clauses_after = 0;
+        uint32_t fixed = 0;               // Top-level units (including failed literals)
+        uint32_t failed = 0;              // Failed literals found by probing
+        uint32_t pure = 0;
+        uint32_t eliminated = 0;          // By bounded variable elimination
+        size_t subsumed = 0;
+        size_t strengthened = 0;
+    };
+
+    using ClauseHandler = std::function<void(const Lit* lits, size_t size)>;
+
+    Preprocessor();
+    explicit Preprocessor(const Options& options);
+
+    void add_clause(const Lit* lits, size_t size);
+    void add_clause(const std::vector<Lit>& lits);
+
+    /**
+     * Keep var: it is never eliminated or treated as pure (it may still be fixed).
+     */
+    void freeze(uint32_t var);
+
+    /**
+     * Simplify the clauses added so far.
+     * @return false if the formula was found unsatisfiable.
+     */
+    bool run();
+
+    /**
+     * Remaining clauses (after run()).
+     */
+    void for_each_clause(const ClauseHandler& on_clause) const;
+    size_t num_clauses() const;
+    uint32_t num_vars() const;
+
+    /**
+     * True if var no longer occurs in the simplified clauses because it was fixed,
+     * pure or eliminated.
+     */
+    bool is_removed(uint32_t var) const;
+
+    /**
+     * Complete a model of the simplified clauses (+1 true, -1 false, 0 unassigned,
+     * indexed by variable) into a model of the original formula.
+     */
+    void extend_model(std::vector<int8_t>& model) const;
+
+    const Stats& stats() const;
+
+private:
+    struct Clause {
+        std::vector<Lit> lits;
+        uint64_t sig;                      // Bit (var % 64) for every variable
+        bool removed;
+    };
+
+    Options options_;
+    bool ok_;
+
+    std::vector<Clause> clauses_;
+    std::vector<std::vector<uint32_t>> occs_;  // occs_[l]: clauses containing l (lazily pruned)
+    size_t live_;
+
+    std::vector<int8_t> value_;            // Top-level assignment by variable
+    std::vector<uint8_t> frozen_;
+    std::vector<uint8_t> eliminated_;      // Pure or resolved away
+    std::vector<uint8_t> marks_;           // By literal, scratch
+    std::vector<Lit> units_;               // Assigned, not yet propagated
+
+    // Reconstruction: each entry is a clause whose first literal is made true if the
+    // rest of it is false under the model being extended
+    std::vector<std::vector<Lit>> stack_;
+
+    uint64_t steps_;
+    Stats stats_;
+
+    void ensure_var(uint32_t var);
+    int8_t value(Lit l) const;
+    static uint64_t signature(const std::vector<Lit>& lits);
+    bool exhausted() const;
+
+    void push_clause(std::vector<Lit>& lits);
+    void remove_clause(uint32_t index);
+    bool assign(Lit l);
+    void strengthen(uint32_t index, Lit l, bool update_occs);
+    bool propagate_units();
+    const std::vector<uint32_t>& live_occs(Lit l);
+
+    bool subsume_all();
+    bool eliminate_pure();
+    bool eliminate_all();
+    bool eliminate(uint32_t var);
+    bool probe_all();
+    bool probe(Lit l);
+};
+
+} // namespace logic
+} // namespace minni
+
+#endif // MINNI_CORE_LOGIC_PREPROCESSOR_H_
@@ -1,12 +1,45 @@
 #include "SatSolver.h"
-#include <sstream>
-#include <iostream>
+#include "DimacsReader.h"
+#include "Preprocessor.h"
 #include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 
 namespace minni {
 namespace logic {
 
-SatSolver::SatSolver() = default;
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double elapsed_ms(Clock::time_point since) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - since).count();
+}
+
+std::string format_double(double value) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.3f", value);
+    return buffer;
+}
+
+} // namespace
+
+SatSolver::SatSolver()
+    : mode_(Mode::CDCL),
+      threads_(1),
+      preprocess_(true),
+      proof_format_(DratWriter::Format::BINARY),
+      interrupted_(false),
+      timed_out_(false),
+      num_vars_(0),
+      starts_(1, 0),
+      engine_clauses_(0),
+      engine_scopes_(0),
+      parse_ms_(0.0),
+      preprocess_ms_(0.0),
+      proof_bytes_(0) {
+}
 SatSolver::~SatSolver() = default;
 
 bool SatSolver::initialize() {
@@ -14,74 +47,514 @@ bool SatSolver::initialize() {
 }
 
 void SatSolver::reset() {
-    assignments_.clear();
-    cnf_formula_.clear();
+    ids_.clear();
+    names_.clear();
+    hidden_.clear();
+    num_vars_ = 0;
+    lits_.clear();
+    starts_.assign(1, 0);
+    scope_marks_.clear();
+    model_.clear();
+    core_.clear();
+    engine_.reset();
+    engine_vars_.clear();
+    engine_clauses_ = 0;
+    engine_scopes_ = 0;
+    stats_ = CdclSolver::Stats();
+    parse_ms_ = 0.0;
+    preprocess_ms_ = 0.0;
+    proof_bytes_ = 0;
 }
 
 void SatSolver::set_param(const std::string& key, const std::string& value) {
-    // No params supported yet
+    if (key == "mode") {
+        if (value == "cdcl") mode_ = Mode::CDCL;
+        else if (value == "dpll") mode_ = Mode::DPLL;
+    } else if (key == "restart") {
+        if (value == "luby") cdcl_options_.restart = CdclSolver::Restart::LUBY;
+        else if (value == "glucose") cdcl_options_.restart = CdclSolver::Restart::GLUCOSE;
+    } else if (key == "timeout" || key == "max_conflicts" || key == "max_propagations") {
+        char* end = nullptr;
+        const unsigned long long n = std::strtoull(value.c_str(), &end, 10);
+        if (value.empty() || *end != '\0' || value[0] == '-') return;
+        if (key == "timeout") limits_.timeout_ms = n;
+        else if (key == "max_conflicts") limits_.conflicts = n;
+        else limits_.propagations = n;
+        if (engine_) engine_->set_limits(limits_);
+    } else if (key == "preprocess") {
+        if (value == "true" || value == "1") preprocess_ = true;
+        else if (value == "false" || value == "0") preprocess_ = false;
+    } else if (key == "threads") {
+        char* end = nullptr;
+        const unsigned long n = std::strtoul(value.c_str(), &end, 10);
+        if (value.empty() || *end != '\0' || value[0] == '-' || n == threads_) return;
+        threads_ = n;
+        engine_.reset();   // Rebuilt from the stored clauses on the next query
+    } else if (key == "proof") {
+        proof_path_ = value;
+    } else if (key == "proof_format") {
+        if (value == "binary") proof_format_ = DratWriter::Format::BINARY;
+        else if (value == "text") proof_format_ = DratWriter::Format::TEXT;
+    } else if (key == "stats") {
+        bool timing;
+        if (value == "true" || value == "1") timing = true;
+        else if (value == "false" || value == "0") timing = false;
+        else return;
+        if (timing == cdcl_options_.timing) return;
+        cdcl_options_.timing = timing;
+        engine_.reset();
+    }
+}
+
+std::unordered_map<std::string, std::string> SatSolver::get_stats() {
+    const CdclSolver::Stats& s = stats_;
+    const double seconds = s.solve_ms / 1000.0;
+    auto rate = [seconds](uint64_t count) { return format_double(seconds > 0 ? count / seconds : 0.0); };
+
+    std::unordered_map<std::string, std::string> stats;
+    stats["decisions"] = std::to_string(s.decisions);
+    stats["propagations"] = std::to_string(s.propagations);
+    stats["conflicts"] = std::to_string(s.conflicts);
+    stats["restarts"] = std::to_string(s.restarts);
+    stats["learned_clauses"] = std::to_string(s.learned);
+    stats["learned_size_avg"] =
+        format_double(s.learned > 0 ? static_cast<double>(s.learned_literals) / s.learned : 0.0);
+    stats["learned_size_max"] = std::to_string(s.learned_max);
+    stats["minimized_literals"] = std::to_string(s.minimized_literals);
+    stats["deleted_clauses"] = std::to_string(s.deleted);
+    stats["reductions"] = std::to_string(s.reductions);
+    stats["garbage_collections"] = std::to_string(s.garbage_collections);
+    stats["imported_clauses"] = std::to_string(s.imported);
+    stats["decisions_per_sec"] = rate(s.decisions);
+    stats["propagations_per_sec"] = rate(s.propagations);
+    stats["conflicts_per_sec"] = rate(s.conflicts);
+    stats["parse_ms"] = format_double(parse_ms_);
+    stats["preprocess_ms"] = format_double(preprocess_ms_);
+    stats["solve_ms"] = format_double(s.solve_ms);
+    stats["propagate_ms"] = format_double(s.propagate_ms);
+    stats["analyze_ms"] = format_double(s.analyze_ms);
+    stats["reduce_ms"] = format_double(s.reduce_ms);
+    stats["proof_bytes"] = std::to_string(proof_bytes_);
+    return stats;
+}
+
+void SatSolver::interrupt() {
+    interrupted_.store(true, std::memory_order_relaxed);
 }
 
 std::unordered_map<std::string, std::string> SatSolver::get_model() {
     std::unordered_map<std::string, std::string> model;
-    for (const auto& kv : assignments_) {
-        model[kv.first] = kv.second ? "true" : "false";
+    for (uint32_t v = 0; v < model_.size(); ++v) {
+        if (v < hidden_.size() && hidden_[v]) continue;
+        const std::string name = v < names_.size() && !names_[v].empty() ? names_[v] : std::to_string(v + 1);
+        model[name] = model_[v] > 0 ? "true" : "false";
     }
     return model;
 }
 
-// Very basic parser for demonstration.
-// Expects CNF clauses separated by '&', literals separated by '|'
-// Example: "A|B & !A|C" -> (A or B) AND (NOT A or C)
+int64_t SatSolver::variable_id(const std::string& name) const {
+    auto it = ids_.find(name);
+    return it == ids_.end() ? -1 : static_cast<int64_t>(it->second);
+}
+
+uint32_t SatSolver::intern(const char* name, size_t size) {
+    auto result = ids_.emplace(std::string(name, size), num_vars_);
+    if (result.second) {
+        names_.resize(num_vars_);   // Unnamed slots for auxiliary / DIMACS variables
+        names_.push_back(result.first->first);
+        ++num_vars_;
+    }
+    return result.first->second;
+}
+
+void SatSolver::add_clause(const Lit* lits, size_t size) {
+    lits_.insert(lits_.end(), lits, lits + size);
+    starts_.push_back(lits_.size());
+    for (size_t i = 0; i < size; ++i) {
+        num_vars_ = std::max(num_vars_, lit_var(lits[i]) + 1);
+    }
+}
+
+// Symbolic CNF: clauses separated by '&', literals by '|', '!' negates.
+// Parentheses and whitespace are ignored; a name is any other run of characters.
+// Example: "(A | B) & (!A | C)" -> (A or B) AND (NOT A or C)
 void SatSolver::parse_formula(const std::string& formula_str) {
-    cnf_formula_.clear();
-    std::stringstream ss(formula_str);
-    std::string segment;
-
-    // Split by '&' into clauses
-    while (std::getline(ss, segment, '&')) {
-        Clause clause;
-        std::stringstream clause_ss(segment);
-        std::string literal_str;
-
-        // Split by '|' into literals
-        while (std::getline(clause_ss, literal_str, '|')) {
-            // Trim whitespace
-            literal_str.erase(0, literal_str.find_first_not_of(" \t\r\n"));
-            literal_str.erase(literal_str.find_last_not_of(" \t\r\n") + 1);
-
-            if (literal_str.empty()) continue;
-
-            bool is_pos = true;
-            if (literal_str[0] == '!') {
-                is_pos = false;
-                literal_str = literal_str.substr(1);
-            }
-            clause.push_back({literal_str, is_pos});
-        }
-        if (!clause.empty()) {
-            cnf_formula_.push_back(clause);
+    std::vector<Lit> clause;
+    bool negated = false;
+    const char* p = formula_str.data();
+    const char* end = p + formula_str.size();
+
+    while (p <= end) {
+        const char ch = p < end ? *p : '&';   // Implicit '&' closes the last clause
+        if (ch == '&') {
+            if (!clause.empty()) add_clause(clause.data(), clause.size());
+            clause.clear();
+            negated = false;
+            ++p;
+        } else if (ch == '|' || ch == '(' || ch == ')' || ch == ' ' ||
+                   ch == '\t' || ch == '\r' || ch == '\n') {
+            ++p;
+        } else if (ch == '!') {
+            negated = !negated;
+            ++p;
+        } else {
+            const char* name = p;
+            while (p < end && std::strchr("&|()! \t\r\n", *p) == nullptr) ++p;
+            clause.push_back(make_lit(intern(name, p - name), negated));
+            negated = false;
         }
     }
 }
 
+bool SatSolver::parse_dimacs(const char* data, size_t size) {
+    DimacsReader reader([this](const Lit* lits, size_t n) { add_clause(lits, n); });
+    if (!reader.read(data, size)) return false;
+    num_vars_ = std::max(num_vars_, reader.num_vars());
+    return true;
+}
+
+// DIMACS text has a "p cnf" header at the start of a line
+static bool is_dimacs(const std::string& text) {
+    size_t pos = 0;
+    while ((pos = text.find("p cnf", pos)) != std::string::npos) {
+        if (pos == 0 || text[pos - 1] == '\n') return true;
+        ++pos;
+    }
+    return false;
+}
+
 SolverStatus SatSolver::check(const std::string& formula_str) {
     reset();
-    parse_formula(formula_str);
+    const Clock::time_point start = Clock::now();
+    if (!add(formula_str)) return SolverStatus::UNKNOWN;
+    parse_ms_ = elapsed_ms(start);
+    if (!proof_path_.empty()) return run_with_proof();
+    return preprocess_ ? run_simplified() : run({});
+}
+
+SolverStatus SatSolver::check_dimacs_file(const std::string& path) {
+    reset();
+    const Clock::time_point start = Clock::now();
+    DimacsReader reader([this](const Lit* lits, size_t n) { add_clause(lits, n); });
+    if (!reader.read_file(path)) return SolverStatus::UNKNOWN;
+    num_vars_ = std::max(num_vars_, reader.num_vars());
+    parse_ms_ = elapsed_ms(start);
+    if (!proof_path_.empty()) return run_with_proof();
+    return preprocess_ ? run_simplified() : run({});
+}
+
+bool SatSolver::add(const std::string& formula_str) {
+    if (!is_dimacs(formula_str)) {
+        parse_formula(formula_str);
+        return true;
+    }
+    // All or nothing: drop the clauses of a DIMACS text that fails to parse
+    const size_t clauses = starts_.size();
+    const size_t lits = lits_.size();
+    if (parse_dimacs(formula_str.data(), formula_str.size())) return true;
+    starts_.resize(clauses);
+    lits_.resize(lits);
+    return false;
+}
+
+SolverStatus SatSolver::solve(const std::vector<std::string>& assumptions) {
+    std::vector<Lit> lits;
+    lits.reserve(assumptions.size());
+    for (const std::string& atom : assumptions) {
+        Lit l;
+        if (!literal(atom, l)) return SolverStatus::UNKNOWN;
+        lits.push_back(l);
+    }
+
+    const SolverStatus status = run(lits);
+    core_.clear();
+    if (status == SolverStatus::UNSATISFIABLE) {
+        for (size_t i = 0; i < lits.size(); ++i) {
+            if (std::find(core_lits_.begin(), core_lits_.end(), lits[i]) != core_lits_.end()) {
+                core_.push_back(assumptions[i]);
+            }
+        }
+    }
+    return status;
+}
+
+bool SatSolver::literal(const std::string& atom, Lit& out) {
+    // "x" or "!x" (surrounding blanks ignored)
+    size_t begin = atom.find_first_not_of(" \t");
+    bool negated = false;
+    while (begin != std::string::npos && atom[begin] == '!') {
+        negated = !negated;
+        begin = atom.find_first_not_of(" \t", begin + 1);
+    }
+    if (begin == std::string::npos) return false;
+    const size_t end = atom.find_last_not_of(" \t") + 1;
+    out = make_lit(intern(atom.data() + begin, end - begin), negated);
+    return true;
+}
+
+uint32_t SatSolver::new_aux_var() {
+    hidden_.resize(num_vars_ + 1, 0);
+    hidden_[num_vars_] = 1;
+    return num_vars_++;
+}
+
+CnfSink SatSolver::sink() {
+    CnfSink sink;
+    sink.new_var = [this]() { return new_aux_var(); };
+    sink.add_clause = [this](const Lit* lits, size_t size) { add_clause(lits, size); };
+    return sink;
+}
+
+bool SatSolver::add_cardinality(const std::vector<std::string>& atoms, Compare compare, size_t k) {
+    std::vector<Lit> lits(atoms.size());
+    for (size_t i = 0; i < atoms.size(); ++i) {
+        if (!literal(atoms[i], lits[i])) return false;
+    }
+    PbEncoder::cardinality(sink(), lits, compare, k);   // An infeasible bound is an empty clause
+    return true;
+}
+
+bool SatSolver::add_pseudo_boolean(const std::vector<std::string>& atoms, const std::vector<int64_t>& weights,
+                                   Compare compare, int64_t bound) {
+    if (atoms.size() != weights.size()) return false;
+    std::vector<Lit> lits(atoms.size());
+    for (size_t i = 0; i < atoms.size(); ++i) {
+        if (!literal(atoms[i], lits[i])) return false;
+    }
+    PbEncoder::pseudo_boolean(sink(), lits, weights, compare, bound);
+    return true;
+}
 
-    if (dpll(cnf_formula_, assignments_)) {
-        return SolverStatus::SATISFIABLE;
+bool SatSolver::add_relaxed(const std::string& formula_str, Lit relax) {
+    const size_t first = starts_.size() - 1;
+    if (!add(formula_str)) return false;
+    // Rebuild the new clauses with relax appended to each
+    std::vector<Lit> added(lits_.begin() + starts_[first], lits_.end());
+    std::vector<size_t> ends(starts_.begin() + first + 1, starts_.end());
+    lits_.resize(starts_[first]);
+    starts_.resize(first + 1);
+    size_t begin = 0;
+    const size_t offset = lits_.size();
+    for (size_t end : ends) {
+        end -= offset;
+        std::vector<Lit> clause(added.begin() + begin, added.begin() + end);
+        clause.push_back(relax);
+        add_clause(clause.data(), clause.size());
+        begin = end;
+    }
+    return true;
+}
+
+SolverStatus SatSolver::solve_literals(const std::vector<Lit>& assumptions) {
+    core_.clear();
+    return run(assumptions);
+}
+
+const std::vector<Lit>& SatSolver::core_literals() const {
+    return core_lits_;
+}
+
+bool SatSolver::model_value(uint32_t var) const {
+    return var < model_.size() && model_[var] > 0;
+}
+
+std::vector<std::string> SatSolver::get_unsat_core() {
+    return core_;
+}
+
+void SatSolver::push() {
+    scope_marks_.push_back(starts_.size() - 1);
+}
+
+bool SatSolver::pop() {
+    if (scope_marks_.empty()) return false;
+    const size_t clauses = scope_marks_.back();
+    // The engine has this scope only if it was synced after the push()
+    if (engine_ && engine_scopes_ == scope_marks_.size()) {
+        engine_->pop();
+        --engine_scopes_;
+    }
+    scope_marks_.pop_back();
+    lits_.resize(starts_[clauses]);
+    starts_.resize(clauses + 1);
+    engine_clauses_ = std::min(engine_clauses_, clauses);
+    return true;
+}
+
+SolverStatus SatSolver::run(const std::vector<Lit>& assumptions) {
+    model_.assign(num_vars_, 0);
+    core_lits_.clear();
+    SolverStatus status;
+    if (mode_ == Mode::DPLL) {
+        // Assumptions become unit clauses; the core is all of them
+        Formula formula;
+        formula.reserve(starts_.size() - 1 + assumptions.size());
+        for (size_t i = 0; i + 1 < starts_.size(); ++i) {
+            formula.emplace_back(lits_.begin() + starts_[i], lits_.begin() + starts_[i + 1]);
+        }
+        for (Lit a : assumptions) formula.push_back({a});
+        status = run_dpll(std::move(formula));
+        if (status == SolverStatus::UNSATISFIABLE) core_lits_ = assumptions;
     } else {
-        return SolverStatus::UNSATISFIABLE;
+        status = cdcl(assumptions);
     }
+    interrupted_.store(false, std::memory_order_relaxed);
+    if (status != SolverStatus::SATISFIABLE) model_.clear();
+    return status;
 }
 
-SatSolver::Literal SatSolver::negate(const Literal& l) {
-    return {l.name, !l.is_positive};
+SolverStatus SatSolver::run_simplified() {
+    // One-shot query: simplify a copy and solve it with a throwaway engine. The stored
+    // clauses stay original, so later add() / solve() calls see the real formula.
+    Preprocessor pre;
+    for (size_t i = 0; i + 1 < starts_.size(); ++i) {
+        pre.add_clause(lits_.data() + starts_[i], starts_[i + 1] - starts_[i]);
+    }
+    model_.assign(num_vars_, 0);
+    core_lits_.clear();
+
+    const Clock::time_point start = Clock::now();
+    const bool consistent = pre.run();
+    preprocess_ms_ += elapsed_ms(start);
+    SolverStatus status = SolverStatus::UNSATISFIABLE;
+    if (consistent) {
+        if (mode_ == Mode::DPLL) {
+            Formula formula;
+            formula.reserve(pre.num_clauses());
+            pre.for_each_clause([&formula](const Lit* lits, size_t n) { formula.emplace_back(lits, lits + n); });
+            status = run_dpll(std::move(formula));
+        } else {
+            PortfolioSolver engine(threads_, cdcl_options_);
+            engine.set_limits(limits_);
+            engine.set_interrupt_flag(&interrupted_);
+            while (engine.num_vars() < num_vars_) engine.new_var();
+            pre.for_each_clause([&engine](const Lit* lits, size_t n) { engine.add_clause(lits, n); });
+            status = engine.solve();
+            if (status == SolverStatus::SATISFIABLE) {
+                for (uint32_t v = 0; v < num_vars_; ++v) model_[v] = engine.model_value(v) ? 1 : -1;
+            }
+            stats_ += engine.stats();
+        }
+    }
+    interrupted_.store(false, std::memory_order_relaxed);
+    if (status == SolverStatus::SATISFIABLE) {
+        pre.extend_model(model_);
+    } else {
+        model_.clear();
+    }
+    return status;
+}
+
+SolverStatus SatSolver::run_with_proof() {
+    // Variables keep their ids and clauses are added as stored, so the proof speaks
+    // about the input formula itself; the one engine is the only proof writer.
+    model_.assign(num_vars_, 0);
+    core_lits_.clear();
+    DratWriter proof;
+    if (!proof.open(proof_path_, proof_format_)) {
+        interrupted_.store(false, std::memory_order_relaxed);
+        model_.clear();
+        return SolverStatus::UNKNOWN;
+    }
+
+    CdclSolver engine(cdcl_options_);
+    engine.set_proof(&proof);
+    engine.set_limits(limits_);
+    engine.set_interrupt_flag(&interrupted_);
+    while (engine.num_vars() < num_vars_) engine.new_var();
+    for (size_t i = 0; i + 1 < starts_.size(); ++i) {
+        engine.add_clause(lits_.data() + starts_[i], starts_[i + 1] - starts_[i]);
+    }
+    SolverStatus status = engine.solve();
+    if (status == SolverStatus::SATISFIABLE) {
+        for (uint32_t v = 0; v < num_vars_; ++v) model_[v] = engine.model_value(v) ? 1 : -1;
+    }
+    stats_ += engine.stats();
+
+    // An answer whose proof did not reach the disk cannot be checked
+    if (!proof.close()) status = SolverStatus::UNKNOWN;
+    proof_bytes_ = proof.bytes_written();
+    interrupted_.store(false, std::memory_order_relaxed);
+    if (status != SolverStatus::SATISFIABLE) model_.clear();
+    return status;
+}
+
+SolverStatus SatSolver::run_dpll(Formula formula) {
+    deadline_ = std::chrono::steady_clock::now() + std::chrono::milliseconds(limits_.timeout_ms);
+    timed_out_ = false;
+    const Clock::time_point start = Clock::now();
+    const bool sat = dpll(std::move(formula), model_);
+    stats_.solve_ms += elapsed_ms(start);
+    if (sat) return SolverStatus::SATISFIABLE;
+    if (timed_out_) return SolverStatus::TIMEOUT;
+    if (interrupted_.load(std::memory_order_relaxed)) return SolverStatus::UNKNOWN;
+    return SolverStatus::UNSATISFIABLE;
+}
+
+Lit SatSolver::to_engine(Lit l) {
+    const uint32_t v = lit_var(l);
+    while (engine_vars_.size() <= v) engine_vars_.push_back(engine_->new_var());
+    return make_lit(engine_vars_[v], lit_negated(l));
+}
+
+void SatSolver::sync_engine() {
+    // The engine persists across add()/solve() calls and keeps what it learned. Our
+    // variable ids are mapped because the engine also allocates scope selectors.
+    if (!engine_) {
+        engine_.reset(new PortfolioSolver(threads_, cdcl_options_));
+        engine_->set_limits(limits_);
+        engine_->set_interrupt_flag(&interrupted_);
+        engine_vars_.clear();
+        engine_clauses_ = 0;
+        engine_scopes_ = 0;
+    }
+    std::vector<Lit> clause;
+    const size_t clauses = starts_.size() - 1;
+    for (; engine_clauses_ < clauses; ++engine_clauses_) {
+        while (engine_scopes_ < scope_marks_.size() && scope_marks_[engine_scopes_] <= engine_clauses_) {
+            engine_->push();
+            ++engine_scopes_;
+        }
+        clause.clear();
+        for (size_t k = starts_[engine_clauses_]; k < starts_[engine_clauses_ + 1]; ++k) {
+            clause.push_back(to_engine(lits_[k]));
+        }
+        engine_->add_clause(clause);
+    }
+    while (engine_scopes_ < scope_marks_.size()) {
+        engine_->push();
+        ++engine_scopes_;
+    }
+    for (uint32_t v = static_cast<uint32_t>(engine_vars_.size()); v < num_vars_; ++v) {
+        engine_vars_.push_back(engine_->new_var());
+    }
+}
+
+SolverStatus SatSolver::cdcl(const std::vector<Lit>& assumptions) {
+    sync_engine();
+    std::vector<Lit> mapped;
+    mapped.reserve(assumptions.size());
+    for (Lit a : assumptions) mapped.push_back(to_engine(a));
+
+    const CdclSolver::Stats before = engine_->stats();
+    const SolverStatus status = engine_->solve(mapped);
+    stats_ += engine_->stats() - before;
+    if (status == SolverStatus::UNSATISFIABLE) {
+        for (Lit c : engine_->core()) {
+            for (size_t i = 0; i < mapped.size(); ++i) {
+                if (mapped[i] == c) core_lits_.push_back(assumptions[i]);
+            }
+        }
+    } else if (status == SolverStatus::SATISFIABLE) {
+        for (uint32_t v = 0; v < num_vars_; ++v) {
+            model_[v] = engine_->model_value(engine_vars_[v]) ? 1 : -1;
+        }
+    }
+    return status;
 }
 
 // Unit Propagation simplification
-SatSolver::Formula SatSolver::propagate(const Formula& formula, const Literal& unit_literal) {
+SatSolver::Formula SatSolver::propagate(const Formula& formula, Lit unit_literal) {
     Formula new_formula;
     for (const auto& clause : formula) {
         bool clause_satisfied = false;
@@ -92,7 +565,7 @@ SatSolver::Formula SatSolver::propagate(const Formula& formula, const Literal& u
                 // Clause is true, remove it entirely
                 clause_satisfied = true;
                 break;
-            } else if (lit == negate(unit_literal)) {
+            } else if (lit == lit_neg(unit_literal)) {
                 // Literal is false, remove it from clause
                 continue;
             } else {
@@ -107,8 +580,17 @@ SatSolver::Formula SatSolver::propagate(const Formula& formula, const Literal& u
     return new_formula;
 }
 
+// Timeout / interrupt for DPLL: a stopped search unwinds as "no solution"
+bool SatSolver::dpll_stopped() {
+    if (interrupted_.load(std::memory_order_relaxed)) return true;
+    if (limits_.timeout_ms > 0 && std::chrono::steady_clock::now() >= deadline_) timed_out_ = true;
+    return timed_out_;
+}
+
 // DPLL Algorithm
-bool SatSolver::dpll(Formula formula, std::map<std::string, bool>& assignment) {
+bool SatSolver::dpll(Formula formula, std::vector<int8_t>& assignment) {
+    if (dpll_stopped()) return false;
+
     // 1. Base cases
     if (formula.empty()) return true; // All clauses satisfied
 
@@ -120,25 +602,37 @@ bool SatSolver::dpll(Formula formula, std::map<std::string, bool>& assignment) {
     // Find a clause with only 1 literal
     for (const auto& clause : formula) {
         if (clause.size() == 1) {
-            Literal unit = clause[0];
-            assignment[unit.name] = unit.is_positive;
+            Lit unit = clause[0];
+            assignment[lit_var(unit)] = lit_negated(unit) ? -1 : 1;
             return dpll(propagate(formula, unit), assignment);
         }
     }
 
-    // 3. Pure Literal Elimination (Skipped for brevity, helps optimization)
+    // 3. Pure Literal Elimination: a literal whose negation occurs nowhere can be set true
+    std::vector<uint8_t> polarity(assignment.size(), 0);   // 1: positive seen, 2: negative seen
+    for (const auto& clause : formula) {
+        for (Lit lit : clause) polarity[lit_var(lit)] |= lit_negated(lit) ? 2 : 1;
+    }
+    for (const auto& clause : formula) {
+        for (Lit lit : clause) {
+            if (polarity[lit_var(lit)] != 3) {
+                assignment[lit_var(lit)] = lit_negated(lit) ? -1 : 1;
+                return dpll(propagate(formula, lit), assignment);
+            }
+        }
+    }
 
     // 4. Splitting (Guessing)
     // Pick the first unassigned variable from the first clause
-    Literal pick = formula[0][0];
+    Lit pick = formula[0][0];
 
     // Try True
-    assignment[pick.name] = pick.is_positive;
+    assignment[lit_var(pick)] = lit_negated(pick) ? -1 : 1;
     if (dpll(propagate(formula, pick), assignment)) return true;
 
     // Try False (Backtrack)
-    assignment[pick.name] = !pick.is_positive;
-    return dpll(propagate(formula, negate(pick)), assignment);
+    assignment[lit_var(pick)] = lit_negated(pick) ? 1 : -1;
+    return dpll(propagate(formula, lit_neg(pick)), assignment);
 }
 
 } // namespace logic
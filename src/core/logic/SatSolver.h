@@ -2,20 +2,56 @@
 #define MINNI_CORE_LOGIC_SAT_SOLVER_H_
 
 #include "SolverInterface.h"
+#include "CdclSolver.h"
+#include "PortfolioSolver.h"
+#include "PbEncoder.h"
+#include "DratWriter.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
 #include <vector>
-#include <map>
-#include <set>
 
 namespace minni {
 namespace logic {
 
 /**
- * A simple SAT solver based on the DPLL algorithm.
- * Supports CNF (Conjunctive Normal Form) formulas.
+ * SAT solver for CNF (Conjunctive Normal Form) formulas.
+ * Searches with the CDCL engine (CdclSolver) by default; the original recursive
+ * DPLL implementation stays available as set_param("mode", "dpll").
  *
- * Input format expects simplified "DIMACS-like" tokens or custom symbolic strings.
- * For this implementation, we parse a simple string format:
- * "(A | B) & (!A | C)"
+ * Parameters:
+ *   "mode"             "cdcl" (default) | "dpll"
+ *   "restart"          "glucose" (default) | "luby"   (CDCL only)
+ *   "timeout"          wall-clock limit per query in ms; exceeded -> TIMEOUT
+ *   "max_conflicts"    conflict budget per query; exhausted -> UNKNOWN (CDCL only)
+ *   "max_propagations" propagation budget per query; exhausted -> UNKNOWN (CDCL only)
+ *   "preprocess"       "true" (default) | "false": simplify one-shot check() queries with
+ *                      Preprocessor first (models are reconstructed transparently)
+ *   "threads"          CDCL workers: "1" (default), "0" = one per core; more than one
+ *                      runs a clause-sharing portfolio (PortfolioSolver)
+ *   "proof"            DRAT proof file for check() / check_dimacs_file(); "" (default)
+ *                      writes none. Each query overwrites the file
+ *   "proof_format"     "binary" (default) | "text"
+ *   "stats"            "true" | "false" (default): also time propagation, conflict
+ *                      analysis and clause database reduction (see get_stats())
+ * Limits default to "0" (none).
+ *
+ * Proofs: with "proof" set, check() and check_dimacs_file() run one CDCL engine on
+ * the formula as given (no preprocessing, no portfolio, whatever "mode" says), so the
+ * proof can be checked with drat-trim against the DIMACS file. For symbolic input the
+ * DIMACS number of a name is variable_id(name) + 1. A proof file that cannot be
+ * written turns the answer into UNKNOWN.
+ *
+ * Input formats accepted by check():
+ *   - Symbolic: clauses separated by '&', literals by '|', '!' negates, parentheses
+ *     optional: "(A | B) & (!A | C)". Names are interned to dense variable ids once;
+ *     the search only sees integer literals and get_model() maps them back.
+ *   - DIMACS CNF text (anything with a "p cnf" header line); variables are reported
+ *     by their DIMACS number ("1", "2", ...). Large files: check_dimacs_file().
+ *
+ * Cardinality ("at most k of these") and pseudo-Boolean constraints go through
+ * add_cardinality() / add_pseudo_boolean() instead of being spelled out as clauses.
  */
 class SatSolver : public SolverInterface {
 public:
@@ -28,39 +64,166 @@ public:
     void reset() override;
     void set_param(const std::string& key, const std::string& value) override;
 
+    /**
+     * Incremental interface (see SolverInterface). In CDCL mode one engine persists
+     * between calls, so learned clauses are reused; assumptions are names or "!name".
+     * DPLL mode re-solves from scratch and reports all assumptions as the core.
+     */
+    bool add(const std::string& formula_str) override;
+    SolverStatus solve(const std::vector<std::string>& assumptions) override;
+    std::vector<std::string> get_unsat_core() override;
+    void push() override;
+    bool pop() override;
+
+    /**
+     * Statistics since the last reset() (check() resets): decisions, propagations,
+     * conflicts, restarts, learned_clauses, learned_size_avg, learned_size_max,
+     * minimized_literals, deleted_clauses, reductions, garbage_collections,
+     * imported_clauses, the rates decisions_per_sec / propagations_per_sec /
+     * conflicts_per_sec, and parse_ms, preprocess_ms, solve_ms, propagate_ms,
+     * analyze_ms, reduce_ms (the last three need "stats" = "true"). proof_bytes is the
+     * size of the last proof. Portfolio counters and phase times are summed over workers.
+     */
+    std::unordered_map<std::string, std::string> get_stats() override;
+
+    /**
+     * Stream a DIMACS CNF file from disk and solve it.
+     * @return UNKNOWN if the file cannot be read or parsed.
+     */
+    SolverStatus check_dimacs_file(const std::string& path);
+
+    /**
+     * Variable id of a symbolic name, or -1 if it does not occur in the formula.
+     */
+    int64_t variable_id(const std::string& name) const;
+
+    /**
+     * Stop the running query from another thread; it returns UNKNOWN. Safe to call at
+     * any time: a request made while no query runs cancels the next one, so a cancel
+     * racing with the start of a query is never lost. Cleared when a query returns.
+     */
+    void interrupt();
+
+    /**
+     * Constraints on how many of the atoms ("x" or "!x") hold, or on the weighted sum
+     * of those that hold. Added to the current assertions like add() (so push()/pop()
+     * scope them) after PbEncoder turns them into clauses; its auxiliary variables
+     * never show up in get_model().
+     * @return false if an atom is malformed or atoms and weights differ in size.
+     */
+    bool add_cardinality(const std::vector<std::string>& atoms, Compare compare, size_t k);
+    bool add_pseudo_boolean(const std::vector<std::string>& atoms, const std::vector<int64_t>& weights,
+                            Compare compare, int64_t bound);
+
+    // ------------------------------------------------------------------
+    // Integer literals over this solver's variable ids, for encoders and optimizers
+    // built on top of it (MaxSatSolver). Same assertions, scopes and parameters as
+    // the string interface.
+    // ------------------------------------------------------------------
+
+    /**
+     * Literal of an atom "x" or "!x", interning the name.
+     * @return false if the atom has no name.
+     */
+    bool literal(const std::string& atom, Lit& out);
+
+    /**
+     * Fresh variable that get_model() does not report.
+     */
+    uint32_t new_aux_var();
+
+    void add_clause(const Lit* lits, size_t size);
+
+    /**
+     * add() with `relax` appended to every clause of the formula: assuming !relax
+     * enforces the formula, setting relax switches it off.
+     */
+    bool add_relaxed(const std::string& formula_str, Lit relax);
+
+    /**
+     * Encoder output into the current assertions (auxiliary variables are hidden).
+     */
+    CnfSink sink();
+
+    SolverStatus solve_literals(const std::vector<Lit>& assumptions);
+
+    /**
+     * After solve_literals() returned UNSATISFIABLE: the failed assumptions.
+     */
+    const std::vector<Lit>& core_literals() const;
+
+    /**
+     * After a SATISFIABLE answer: value of a variable in the model.
+     */
+    bool model_value(uint32_t var) const;
+
 private:
-    // Internal representation of a literal (e.g., A or !A)
-    struct Literal {
-        std::string name;
-        bool is_positive; // true = A, false = !A
-
-        bool operator<(const Literal& other) const {
-            if (name != other.name) return name < other.name;
-            return is_positive < other.is_positive;
-        }
-        bool operator==(const Literal& other) const {
-             return name == other.name && is_positive == other.is_positive;
-        }
+    // A formula is a conjunction of clauses, each a disjunction of integer literals
+    using Clause = std::vector<Lit>;
+    using Formula = std::vector<Clause>;
+
+    enum class Mode {
+        CDCL,
+        DPLL
     };
 
-    // A clause is a disjunction of literals (A | B | !C)
-    using Clause = std::vector<Literal>;
-    // A formula is a conjunction of clauses (C1 & C2 & C3)
-    using Formula = std::vector<Clause>;
+    Mode mode_;
+    CdclSolver::Options cdcl_options_;
+    CdclSolver::Limits limits_;
+    size_t threads_;
+    bool preprocess_;
+    std::string proof_path_;
+    DratWriter::Format proof_format_;
+
+    std::atomic<bool> interrupted_;     // Shared with the engine
+    std::chrono::steady_clock::time_point deadline_;
+    bool timed_out_;                    // DPLL ran past deadline_
+
+    // Symbol table: names_[v] is the name of variable v (empty for DIMACS input and
+    // auxiliary variables); hidden_[v] marks auxiliary variables
+    std::unordered_map<std::string, uint32_t> ids_;
+    std::vector<std::string> names_;
+    std::vector<uint8_t> hidden_;
+    uint32_t num_vars_;
+
+    // Parsed formula, flat: clause i is lits_[starts_[i] .. starts_[i + 1])
+    std::vector<Lit> lits_;
+    std::vector<size_t> starts_;
+
+    std::vector<size_t> scope_marks_;   // Clause count at each open push()
+
+    // Persistent CDCL engine (one worker or a portfolio), synced lazily with the clauses above
+    std::unique_ptr<PortfolioSolver> engine_;
+    std::vector<uint32_t> engine_vars_; // Our variable id -> engine variable id
+    size_t engine_clauses_;             // Clauses already added to the engine
+    size_t engine_scopes_;              // Scopes already pushed to the engine
 
-    // Current assignment of variables: true/false/unassigned
-    std::map<std::string, bool> assignments_;
+    // Last result: model is +1 true, -1 false, 0 unassigned (reported as false)
+    std::vector<int8_t> model_;
+    std::vector<Lit> core_lits_;
+    std::vector<std::string> core_;
 
-    // Parsed formula
-    Formula cnf_formula_;
+    // Statistics since reset(): engine counters accumulate per query
+    CdclSolver::Stats stats_;
+    double parse_ms_;
+    double preprocess_ms_;
+    uint64_t proof_bytes_;
 
-    // Helper methods
-    bool dpll(Formula formula, std::map<std::string, bool>& assignment);
-    Formula propagate(const Formula& formula, const Literal& unit_literal);
-    Literal negate(const Literal& l);
+    SolverStatus run(const std::vector<Lit>& assumptions);
+    SolverStatus run_simplified();
+    SolverStatus run_with_proof();
+    SolverStatus run_dpll(Formula formula);
+    void sync_engine();
+    Lit to_engine(Lit l);
+    SolverStatus cdcl(const std::vector<Lit>& assumptions);
+    bool dpll(Formula formula, std::vector<int8_t>& assignment);
+    bool dpll_stopped();
+    Formula propagate(const Formula& formula, Lit unit_literal);
 
     // Parsing
+    uint32_t intern(const char* name, size_t size);
     void parse_formula(const std::string& formula_str);
+    bool parse_dimacs(const char* data, size_t size);
 };
 
 } // namespace logic
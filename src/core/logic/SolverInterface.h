@@ -54,6 +54,49 @@ public:
      * Set a configuration parameter (e.g., "timeout", "random_seed").
      */
     virtual void set_param(const std::string& key, const std::string& value) = 0;
+
+    // ------------------------------------------------------------------
+    // Incremental use. Unlike check(), these keep the assertions (and whatever the
+    // engine learned) between calls. Solvers without incremental support keep the
+    // defaults below.
+    // ------------------------------------------------------------------
+
+    /**
+     * Add a formula to the current assertions.
+     * @return false if unsupported or the formula cannot be parsed.
+     */
+    virtual bool add(const std::string& formula_str) { (void)formula_str; return false; }
+
+    /**
+     * Check the current assertions with the given assumptions held true for this call
+     * only. Assumptions are atoms in the solver's own syntax (e.g. "x" or "!x").
+     */
+    virtual SolverStatus solve(const std::vector<std::string>& assumptions) {
+        (void)assumptions;
+        return SolverStatus::UNKNOWN;
+    }
+
+    /**
+     * After solve() returned UNSATISFIABLE: assumptions that cannot hold together
+     * (empty if the assertions are unsatisfiable on their own).
+     */
+    virtual std::vector<std::string> get_unsat_core() { return {}; }
+
+    /**
+     * Open an assertion scope; pop() removes everything added since the matching push().
+     */
+    virtual void push() {}
+
+    /**
+     * @return false if there is no open scope (or scopes are unsupported).
+     */
+    virtual bool pop() { return false; }
+
+    /**
+     * Counters and timings of the work done since the last reset(), as name -> value
+     * (empty if the solver keeps none).
+     */
+    virtual std::unordered_map<std::string, std::string> get_stats() { return {}; }
 };
 
 } // namespace logic
@@ -6,6 +6,10 @@
 #include <fstream>
 #include <sstream>
 #include <cstring>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <thread>
 
 namespace minni {
 namespace logic {
@@ -30,6 +34,7 @@ bool VectorStore::add_vector(const std::string& id, const std::vector<float>& ve
     size_t current_dim = vector.size();
     if (vector_dim_ == 0) {
         vector_dim_ = current_dim;
+        if (prefix_dim_ >= vector_dim_) prefix_dim_ = 0; // Prefix must be shorter than the vector
     } else if (current_dim != vector_dim_) {
         return false;
     }
@@ -45,9 +50,175 @@ bool VectorStore::add_vector(const std::string& id, const std::vector<float>& ve
         store_[id] = vector;
     }
 
+    if (prefix_dim_ > 0) {
+        index_prefix(id, vector.data());
+    }
+
+    return true;
+}
+
+size_t VectorStore::add_batch(const std::vector<std::string>& ids, const float* data, size_t dim,
+                              size_t num_threads) {
+    const size_t count = ids.size();
+    if (count == 0 || dim == 0 || !data) return 0;
+    if (vector_dim_ != 0 && dim != vector_dim_) return 0;
+
+    if (!use_quantization_) {
+        size_t added = 0;
+        std::vector<float> vec(dim);
+        for (size_t i = 0; i < count; ++i) {
+            vec.assign(data + i * dim, data + (i + 1) * dim);
+            if (add_vector(ids[i], vec)) added++;
+        }
+        return added;
+    }
+
+    // Quantize all rows in parallel, then insert serially (the maps are not thread-safe)
+    using minni::optimization::Quantizer;
+    std::vector<std::vector<int8_t>> codes(count, std::vector<int8_t>(dim));
+    std::vector<Quantizer::QuantizationParams> params(count);
+
+    if (num_threads == 0) num_threads = std::max<unsigned>(1, std::thread::hardware_concurrency());
+    num_threads = std::min(num_threads, std::max<size_t>(1, count / 64));
+
+    auto worker = [&](size_t t) {
+        size_t begin = count * t / num_threads;
+        size_t end = count * (t + 1) / num_threads;
+        for (size_t i = begin; i < end; ++i) {
+            const float* row = data + i * dim;
+            params[i] = Quantizer::calculate_params(row, dim);
+            Quantizer::quantize(row, dim, params[i], codes[i].data());
+        }
+    };
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < num_threads; ++t) pool.emplace_back(worker, t);
+    worker(0);
+    for (auto& th : pool) th.join();
+
+    size_t added = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const std::string& id = ids[i];
+        if (quantized_store_.count(id) > 0) continue;
+        if (vector_dim_ == 0) {
+            vector_dim_ = dim;
+            if (prefix_dim_ >= vector_dim_) prefix_dim_ = 0;
+        }
+
+        quantized_store_[id] = std::move(codes[i]);
+        quant_params_[id] = params[i];
+        if (prefix_dim_ > 0) {
+            index_prefix(id, data + i * dim);
+        }
+        added++;
+    }
+    return added;
+}
+
+namespace {
+
+float inverse_norm(const float* data, size_t size) {
+    float norm = std::sqrt(minni::signal::DSPKernel::dot_product(data, data, size));
+    return norm < 1e-9f ? 0.0f : 1.0f / norm;
+}
+
+} // namespace
+
+void VectorStore::index_prefix(const std::string& id, const float* vector) {
+    prefix_ids_.push_back(id);
+    prefix_block_.insert(prefix_block_.end(), vector, vector + prefix_dim_);
+    prefix_inv_norms_.push_back(inverse_norm(vector, prefix_dim_));
+}
+
+void VectorStore::rebuild_prefix_index() {
+    prefix_ids_.clear();
+    prefix_block_.clear();
+    prefix_inv_norms_.clear();
+    if (prefix_dim_ == 0) return;
+
+    prefix_ids_.reserve(size());
+    prefix_block_.reserve(size() * prefix_dim_);
+    prefix_inv_norms_.reserve(size());
+    if (use_quantization_) {
+        for (const auto& kv : quantized_store_) {
+            auto vec = minni::optimization::Quantizer::dequantize(kv.second, quant_params_.at(kv.first));
+            index_prefix(kv.first, vec.data());
+        }
+    } else {
+        for (const auto& kv : store_) {
+            index_prefix(kv.first, kv.second.data());
+        }
+    }
+}
+
+bool VectorStore::set_prefix_dim(size_t prefix_dim) {
+    if (vector_dim_ != 0 && prefix_dim >= vector_dim_) return false;
+    prefix_dim_ = prefix_dim;
+    rebuild_prefix_index();
     return true;
 }
 
+size_t VectorStore::prefix_dim() const {
+    return prefix_dim_;
+}
+
+std::vector<std::pair<std::string, float>> VectorStore::search_prefix(const std::vector<float>& query, size_t limit,
+                                                                      size_t oversample) {
+    if (prefix_dim_ == 0 || prefix_dim_ >= vector_dim_) {
+        return search(query, limit);
+    }
+
+    std::vector<std::pair<std::string, float>> results;
+    if (query.size() != vector_dim_ || prefix_ids_.empty() || limit == 0) {
+        return results;
+    }
+
+    // 1. Coarse pass over the contiguous prefix block
+    float query_inv_norm = inverse_norm(query.data(), prefix_dim_);
+    const size_t count = prefix_ids_.size();
+    std::vector<std::pair<size_t, float>> candidates;
+    candidates.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        float dot = minni::signal::DSPKernel::dot_product(
+            query.data(), prefix_block_.data() + i * prefix_dim_, prefix_dim_
+        );
+        candidates.emplace_back(i, dot * query_inv_norm * prefix_inv_norms_[i]);
+    }
+
+    size_t keep = std::min(count, limit * std::max<size_t>(oversample, 1));
+    std::nth_element(candidates.begin(), candidates.begin() + (keep - 1), candidates.end(),
+                     [](const std::pair<size_t, float>& a, const std::pair<size_t, float>& b) {
+                         return a.second > b.second;
+                     });
+    candidates.resize(keep);
+
+    // 2. Re-score survivors at full dimension
+    float query_norm = std::sqrt(minni::signal::DSPKernel::dot_product(query.data(), query.data(), vector_dim_));
+    results.reserve(keep);
+    for (const auto& c : candidates) {
+        const std::string& id = prefix_ids_[c.first];
+        float score = 0.0f;
+        if (use_quantization_) {
+            score = minni::optimization::Quantizer::dequantized_cosine(
+                query.data(), query_norm, quantized_store_.at(id).data(), quant_params_.at(id), vector_dim_
+            );
+        } else {
+            score = minni::signal::DSPKernel::cosine_similarity(
+                query.data(), store_.at(id).data(), vector_dim_
+            );
+        }
+        results.emplace_back(id, score);
+    }
+
+    std::sort(results.begin(), results.end(),
+              [](const std::pair<std::string, float>& a, const std::pair<std::string, float>& b) {
+                  return a.second > b.second;
+              });
+    if (results.size() > limit) {
+        results.resize(limit);
+    }
+    return results;
+}
+
 std::vector<std::pair<std::string, float>> VectorStore::search(const std::vector<float>& query, size_t limit) {
     std::vector<std::pair<std::string, float>> results;
 
@@ -102,10 +273,56 @@ size_t VectorStore::size() const {
     return use_quantization_ ? quantized_store_.size() : store_.size();
 }
 
+size_t VectorStore::dimension() const {
+    return vector_dim_;
+}
+
+std::vector<float> VectorStore::sample(size_t count, uint32_t seed) const {
+    const size_t total = size();
+    count = std::min(count, total);
+    std::vector<float> out;
+    if (count == 0) return out;
+
+    // Partial Fisher-Yates over positions, then one ordered pass over the map
+    std::vector<size_t> positions(total);
+    std::iota(positions.begin(), positions.end(), 0);
+    std::mt19937 rng(seed);
+    for (size_t i = 0; i < count; ++i) {
+        std::uniform_int_distribution<size_t> pick(i, total - 1);
+        std::swap(positions[i], positions[pick(rng)]);
+    }
+    positions.resize(count);
+    std::sort(positions.begin(), positions.end());
+
+    out.reserve(count * vector_dim_);
+    size_t pos = 0;
+    size_t next = 0;
+    if (use_quantization_) {
+        for (const auto& kv : quantized_store_) {
+            if (next == count) break;
+            if (pos++ != positions[next]) continue;
+            auto vec = minni::optimization::Quantizer::dequantize(kv.second, quant_params_.at(kv.first));
+            out.insert(out.end(), vec.begin(), vec.end());
+            next++;
+        }
+    } else {
+        for (const auto& kv : store_) {
+            if (next == count) break;
+            if (pos++ != positions[next]) continue;
+            out.insert(out.end(), kv.second.begin(), kv.second.end());
+            next++;
+        }
+    }
+    return out;
+}
+
 void VectorStore::clear() {
     store_.clear();
     quantized_store_.clear();
     quant_params_.clear();
+    prefix_ids_.clear();
+    prefix_block_.clear();
+    prefix_inv_norms_.clear();
     vector_dim_ = 0;
 }
 
@@ -285,10 +502,40 @@ bool VectorStore::loadFromStream(std::istream& in) {
         }
     }
 
+    // The prefix dimension is a search setting, not part of the file format
+    if (prefix_dim_ >= vector_dim_) prefix_dim_ = 0;
+    rebuild_prefix_index();
+
     return in.good();
 }
 
-const char FLAT_MAGIC_HEADER[] = "MFVS"; // Minni Flat Vector Store v1
+namespace {
+
+// Size of the ID blob: offset table (8 bytes per ID) + null-terminated strings.
+uint64_t flat_id_blob_size(const std::vector<const std::string*>& ids) {
+    uint64_t total = ids.size() * 8;
+    for (const auto* id : ids) total += id->size() + 1;
+    return total;
+}
+
+// Offsets in the table are relative to the start of the ID block.
+void write_flat_id_blob(std::ostream& out, const std::vector<const std::string*>& ids) {
+    std::vector<uint64_t> str_offsets;
+    str_offsets.reserve(ids.size());
+
+    uint64_t current_str_relative_offset = ids.size() * 8; // offsets start after the table
+    for (const auto* id : ids) {
+        str_offsets.push_back(current_str_relative_offset);
+        current_str_relative_offset += id->size() + 1; // +1 for null terminator
+    }
+
+    out.write(reinterpret_cast<const char*>(str_offsets.data()), str_offsets.size() * 8);
+    for (const auto* id : ids) {
+        out.write(id->c_str(), id->size() + 1);
+    }
+}
+
+} // namespace
 
 bool VectorStore::save_flat(const std::string& path) const {
     std::ofstream out(path, std::ios::binary);
@@ -303,16 +550,16 @@ bool VectorStore::save_flat(const std::string& path) const {
     // 24-31: Vector Data Offset
     // 32-39: Quant Params Offset (or 0)
     // 40-47: ID Blob Offset
-    // 48-63: Reserved
+    // 48-63: Reserved (used by tiered files, see FlatFormat.h)
 
-    uint32_t version = 1;
+    uint32_t version = flat::VERSION_PLAIN;
     uint32_t dim = static_cast<uint32_t>(vector_dim_);
-    uint32_t flags = use_quantization_ ? 1 : 0;
+    uint32_t flags = use_quantization_ ? flat::FLAG_QUANTIZED : 0;
     uint64_t count = size();
 
     // Calculate offsets
     // Header is 64 bytes
-    uint64_t vec_offset = 64;
+    uint64_t vec_offset = flat::HEADER_SIZE;
     uint64_t vec_size = 0;
 
     if (use_quantization_) {
@@ -333,7 +580,7 @@ bool VectorStore::save_flat(const std::string& path) const {
     uint64_t id_offset = use_quantization_ ? (params_offset + params_size) : (vec_offset + vec_size);
 
     // Write Header
-    out.write(FLAT_MAGIC_HEADER, 4);
+    out.write(flat::MAGIC, 4);
     out.write(reinterpret_cast<const char*>(&version), 4);
     out.write(reinterpret_cast<const char*>(&dim), 4);
     out.write(reinterpret_cast<const char*>(&flags), 4);
@@ -374,40 +621,110 @@ bool VectorStore::save_flat(const std::string& path) const {
 
     // 3. ID Blob
     out.seekp(id_offset);
+    std::vector<const std::string*> ids;
+    ids.reserve(count);
+    if (use_quantization_) {
+        for (const auto& kv : quantized_store_) ids.push_back(&kv.first);
+    } else {
+        for (const auto& kv : store_) ids.push_back(&kv.first);
+    }
+    write_flat_id_blob(out, ids);
 
-    // Calculate total size of ID strings to determine offsets
-    std::vector<uint64_t> str_offsets;
-    str_offsets.reserve(count);
+    out.close();
+    return out.good();
+}
 
-    uint64_t current_str_relative_offset = count * 8; // offsets start after the table
+bool VectorStore::save_flat_tiered(const std::string& path, flat::CodeType code_type) const {
+    // The cold section must hold the original floats, which a quantized store no longer has.
+    if (use_quantization_ || code_type == flat::CodeType::NONE) return false;
+    if (code_type == flat::CodeType::PREFIX && (prefix_dim_ == 0 || prefix_dim_ >= vector_dim_)) return false;
 
-    // Pass 1: Calculate offsets
-    if (use_quantization_) {
-        for (const auto& kv : quantized_store_) {
-            str_offsets.push_back(current_str_relative_offset);
-            current_str_relative_offset += kv.first.size() + 1; // +1 for null terminator
-        }
-    } else {
-        for (const auto& kv : store_) {
-            str_offsets.push_back(current_str_relative_offset);
-            current_str_relative_offset += kv.first.size() + 1;
-        }
+    std::ofstream out(path, std::ios::binary);
+    if (!out) return false;
+
+    const uint64_t count = store_.size();
+    const size_t dim = vector_dim_;
+
+    std::vector<const std::string*> ids;
+    ids.reserve(count);
+    for (const auto& kv : store_) ids.push_back(&kv.first);
+
+    // Section sizes
+    uint64_t code_bytes = 0;
+    switch (code_type) {
+        case flat::CodeType::INT8:   code_bytes = dim * sizeof(int8_t); break;
+        case flat::CodeType::BINARY: code_bytes = flat::binary_code_bytes(dim); break;
+        case flat::CodeType::PREFIX: code_bytes = prefix_dim_ * sizeof(float); break;
+        default: return false;
     }
 
-    // Write Offset Table
-    out.write(reinterpret_cast<const char*>(str_offsets.data()), str_offsets.size() * 8);
+    flat::Header header = {};
+    std::memcpy(header.magic, flat::MAGIC, 4);
+    header.version = flat::VERSION_TIERED;
+    header.dim = static_cast<uint32_t>(dim);
+    header.flags = flat::FLAG_TIERED;
+    header.num_vectors = count;
+    header.code_type = static_cast<uint32_t>(code_type);
+    header.vector_offset = flat::HEADER_SIZE;
+
+    uint64_t cursor = flat::align_up(header.vector_offset + count * code_bytes, 8);
+    if (code_type == flat::CodeType::INT8) {
+        header.flags |= flat::FLAG_QUANTIZED;
+        header.params_offset = cursor;
+        cursor += count * sizeof(minni::optimization::Quantizer::QuantizationParams);
+    } else if (code_type == flat::CodeType::PREFIX) {
+        header.prefix_dim = static_cast<uint32_t>(prefix_dim_);
+        header.params_offset = cursor; // Inverse prefix norms (float per vector)
+        cursor += count * sizeof(float);
+    }
+    header.id_offset = flat::align_up(cursor, 8);
+    header.cold_offset = flat::align_up(header.id_offset + flat_id_blob_size(ids), flat::COLD_ALIGNMENT);
 
-    // Write Strings
-    if (use_quantization_) {
-        for (const auto& kv : quantized_store_) {
-            out.write(kv.first.c_str(), kv.first.size() + 1);
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    // 1. Hot codes (+ params)
+    out.seekp(header.vector_offset);
+    if (code_type == flat::CodeType::INT8) {
+        std::vector<minni::optimization::Quantizer::QuantizationParams> params;
+        params.reserve(count);
+        for (const auto& kv : store_) {
+            auto p = minni::optimization::Quantizer::calculate_params(kv.second);
+            auto q = minni::optimization::Quantizer::quantize(kv.second, p);
+            out.write(reinterpret_cast<const char*>(q.data()), dim * sizeof(int8_t));
+            params.push_back(p);
+        }
+        out.seekp(header.params_offset);
+        out.write(reinterpret_cast<const char*>(params.data()), params.size() * sizeof(params[0]));
+    } else if (code_type == flat::CodeType::PREFIX) {
+        std::vector<float> inv_norms;
+        inv_norms.reserve(count);
+        for (const auto& kv : store_) {
+            out.write(reinterpret_cast<const char*>(kv.second.data()), prefix_dim_ * sizeof(float));
+            inv_norms.push_back(inverse_norm(kv.second.data(), prefix_dim_));
         }
+        out.seekp(header.params_offset);
+        out.write(reinterpret_cast<const char*>(inv_norms.data()), inv_norms.size() * sizeof(float));
     } else {
+        std::vector<uint64_t> words(code_bytes / sizeof(uint64_t));
         for (const auto& kv : store_) {
-            out.write(kv.first.c_str(), kv.first.size() + 1);
+            std::fill(words.begin(), words.end(), 0);
+            for (size_t d = 0; d < dim; ++d) {
+                if (kv.second[d] > 0.0f) words[d / 64] |= (uint64_t(1) << (d % 64));
+            }
+            out.write(reinterpret_cast<const char*>(words.data()), code_bytes);
         }
     }
 
+    // 2. ID Blob
+    out.seekp(header.id_offset);
+    write_flat_id_blob(out, ids);
+
+    // 3. Cold full-precision vectors (same implicit index order as the codes)
+    out.seekp(header.cold_offset);
+    for (const auto& kv : store_) {
+        out.write(reinterpret_cast<const char*>(kv.second.data()), dim * sizeof(float));
+    }
+
     out.close();
     return out.good();
 }
@@ -6,6 +6,7 @@
 #include <map>
 #include <utility>
 #include "../optimization/Quantizer.h"
+#include "FlatFormat.h"
 
 namespace minni {
 namespace logic {
@@ -32,6 +33,17 @@ public:
      */
     bool add_vector(const std::string& id, const std::vector<float>& vector);
 
+    /**
+     * Add a batch of vectors stored contiguously (row-major).
+     * Quantization runs in parallel; insertion is serial.
+     * @param ids One ID per row.
+     * @param data ids.size() x dim floats.
+     * @param dim Dimensionality of every row.
+     * @param num_threads Worker threads for quantization (0 = hardware concurrency).
+     * @return Number of vectors added (duplicates and dimension mismatches are skipped).
+     */
+    size_t add_batch(const std::vector<std::string>& ids, const float* data, size_t dim, size_t num_threads = 0);
+
     /**
      * Search for the nearest neighbors to the query vector.
      * @param query The query vector.
@@ -40,11 +52,44 @@ public:
      */
     std::vector<std::pair<std::string, float>> search(const std::vector<float>& query, size_t limit);
 
+    /**
+     * Enable coarse-to-fine search for Matryoshka embeddings.
+     * The first `prefix_dim` dimensions of every vector are kept in a contiguous
+     * block together with their prefix norms (computed at insert time).
+     * Existing vectors are re-indexed. Pass 0 to disable.
+     * @return false if prefix_dim is not smaller than the current dimension.
+     */
+    bool set_prefix_dim(size_t prefix_dim);
+    size_t prefix_dim() const;
+
+    /**
+     * Coarse-to-fine search: score the prefix of every vector, keep the best
+     * `limit * oversample` candidates and re-score them at full dimension.
+     * Falls back to search() when no prefix dimension is configured.
+     * @return List of (ID, Score) pairs with full-dimension scores.
+     */
+    std::vector<std::pair<std::string, float>> search_prefix(const std::vector<float>& query, size_t limit,
+                                                             size_t oversample = 4);
+
     /**
      * Get the number of vectors in the store.
      */
     size_t size() const;
 
+    /**
+     * Get the vector dimensionality (0 while empty).
+     */
+    size_t dimension() const;
+
+    /**
+     * Draw a uniform random sample of stored vectors, e.g. for codebook training.
+     * Quantized vectors are dequantized.
+     * @param count Maximum number of vectors (all if count >= size()).
+     * @param seed Sampling seed (same seed -> same sample).
+     * @return Row-major floats (sampled x dimension()).
+     */
+    std::vector<float> sample(size_t count, uint32_t seed = 42) const;
+
     /**
      * Clear all vectors.
      */
@@ -74,6 +119,18 @@ public:
      */
     bool save_flat(const std::string& path) const;
 
+    /**
+     * Save a two-tier "Flat" file for two-stage search (see FlatVectorStore).
+     * Layout: Header | Hot Codes | [Quant Params] | ID Data | Cold Float Vectors
+     * The compact codes (int8, binary or float prefixes) are scanned for every query;
+     * the page-aligned float section is only read for the candidates being reranked.
+     * Requires a float (non-quantized) store; CodeType::PREFIX requires set_prefix_dim().
+     * @param path File path.
+     * @param code_type Encoding of the hot section.
+     * @return true if successful.
+     */
+    bool save_flat_tiered(const std::string& path, flat::CodeType code_type) const;
+
 private:
     bool use_quantization_;
     size_t vector_dim_ = 0;
@@ -85,6 +142,15 @@ private:
     std::map<std::string, std::vector<int8_t>> quantized_store_;
     std::map<std::string, minni::optimization::Quantizer::QuantizationParams> quant_params_;
 
+    // Matryoshka prefix index (insertion order; row i belongs to prefix_ids_[i])
+    size_t prefix_dim_ = 0;
+    std::vector<std::string> prefix_ids_;
+    std::vector<float> prefix_block_;      // n x prefix_dim_, contiguous
+    std::vector<float> prefix_inv_norms_;  // 1 / ||prefix|| (0 for zero prefixes)
+
+    void index_prefix(const std::string& id, const float* vector);
+    void rebuild_prefix_index();
+
     // Helper for loading from a stream
     bool loadFromStream(std::istream& in);
 };
@@ -0,0 +1,266 @@
+#include "KMeansTrainer.h"
+#include "../signal/DSPKernel.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <thread>
+
+namespace minni {
+namespace optimization {
+
+using minni::signal::DSPKernel;
+
+KMeansTrainer::KMeansTrainer() = default;
+
+KMeansTrainer::KMeansTrainer(const Config& config)
+    : config_(config) {}
+
+KMeansTrainer::~KMeansTrainer() = default;
+
+size_t KMeansTrainer::thread_count(size_t work_items) const {
+    size_t threads = config_.num_threads;
+    if (threads == 0) {
+        threads = std::max<unsigned>(1, std::thread::hardware_concurrency());
+    }
+    // Not worth a thread for less than a few hundred points
+    size_t useful = std::max<size_t>(1, work_items / 256);
+    return std::min(threads, useful);
+}
+
+void KMeansTrainer::update_norms() {
+    size_t k = num_clusters();
+    centroid_norms_.resize(k);
+    for (size_t c = 0; c < k; ++c) {
+        const float* ctr = centroids_.data() + c * dim_;
+        centroid_norms_[c] = DSPKernel::dot_product(ctr, ctr, dim_);
+    }
+}
+
+uint32_t KMeansTrainer::nearest(const float* vec, float vec_norm, float* out_dist) const {
+    // ||x - c||^2 = ||x||^2 - 2 x.c + ||c||^2
+    size_t k = num_clusters();
+    uint32_t best = 0;
+    float best_dist = std::numeric_limits<float>::max();
+    for (size_t c = 0; c < k; ++c) {
+        float d = centroid_norms_[c] - 2.0f * DSPKernel::dot_product(vec, centroids_.data() + c * dim_, dim_);
+        if (d < best_dist) {
+            best_dist = d;
+            best = static_cast<uint32_t>(c);
+        }
+    }
+    if (out_dist) *out_dist = std::max(0.0f, best_dist + vec_norm);
+    return best;
+}
+
+uint32_t KMeansTrainer::assign(const float* vec) const {
+    if (centroids_.empty()) return 0;
+    return nearest(vec, 0.0f, nullptr);
+}
+
+double KMeansTrainer::assign_all(const float* data, size_t n, uint32_t* out) const {
+    if (centroids_.empty() || n == 0) return 0.0;
+
+    size_t threads = thread_count(n);
+    std::vector<double> partial(threads, 0.0);
+
+    auto worker = [&](size_t t) {
+        size_t begin = n * t / threads;
+        size_t end = n * (t + 1) / threads;
+        double sum = 0.0;
+        for (size_t i = begin; i < end; ++i) {
+            const float* vec = data + i * dim_;
+            float dist = 0.0f;
+            out[i] = nearest(vec, DSPKernel::dot_product(vec, vec, dim_), &dist);
+            sum += dist;
+        }
+        partial[t] = sum;
+    };
+
+    if (threads == 1) {
+        worker(0);
+    } else {
+        std::vector<std::thread> pool;
+        pool.reserve(threads - 1);
+        for (size_t t = 1; t < threads; ++t) pool.emplace_back(worker, t);
+        worker(0);
+        for (auto& th : pool) th.join();
+    }
+
+    // Reduce in a fixed order so the result does not depend on scheduling
+    return std::accumulate(partial.begin(), partial.end(), 0.0);
+}
+
+void KMeansTrainer::init_plus_plus(const float* data, size_t n) {
+    const size_t k = config_.num_clusters;
+    std::mt19937 rng(config_.seed);
+
+    // Seed on a bounded subsample; k-means++ is O(m * k * dim)
+    size_t m = config_.init_sample_size ? config_.init_sample_size : 32 * k;
+    m = std::min(std::max(m, k), n);
+
+    std::vector<size_t> sample(n);
+    std::iota(sample.begin(), sample.end(), 0);
+    for (size_t i = 0; i < m; ++i) {
+        std::uniform_int_distribution<size_t> pick(i, n - 1);
+        std::swap(sample[i], sample[pick(rng)]);
+    }
+    sample.resize(m);
+
+    centroids_.assign(k * dim_, 0.0f);
+    std::vector<float> min_dist(m, std::numeric_limits<float>::max());
+
+    auto copy_center = [&](size_t c, size_t point) {
+        std::copy(data + point * dim_, data + (point + 1) * dim_, centroids_.begin() + c * dim_);
+    };
+
+    std::uniform_int_distribution<size_t> first(0, m - 1);
+    copy_center(0, sample[first(rng)]);
+
+    std::vector<float> diff(dim_);
+    for (size_t c = 1; c < k; ++c) {
+        const float* last = centroids_.data() + (c - 1) * dim_;
+        double total = 0.0;
+        for (size_t i = 0; i < m; ++i) {
+            const float* vec = data + sample[i] * dim_;
+            for (size_t d = 0; d < dim_; ++d) diff[d] = vec[d] - last[d];
+            float dist = DSPKernel::dot_product(diff.data(), diff.data(), dim_);
+            if (dist < min_dist[i]) min_dist[i] = dist;
+            total += min_dist[i];
+        }
+
+        // D^2 sampling (uniform fallback when all points coincide with centers)
+        size_t chosen = sample[first(rng)];
+        if (total > 0.0) {
+            double target = std::uniform_real_distribution<double>(0.0, total)(rng);
+            double acc = 0.0;
+            for (size_t i = 0; i < m; ++i) {
+                acc += min_dist[i];
+                if (acc >= target) {
+                    chosen = sample[i];
+                    break;
+                }
+            }
+        }
+        copy_center(c, chosen);
+    }
+}
+
+bool KMeansTrainer::train(const float* data, size_t n, size_t dim) {
+    const size_t k = config_.num_clusters;
+    if (!data || dim == 0 || k == 0 || n < k) return false;
+
+    dim_ = dim;
+    init_plus_plus(data, n);
+    update_norms();
+
+    std::mt19937 rng(config_.seed + 1);
+    std::uniform_int_distribution<size_t> pick(0, n - 1);
+
+    const bool mini_batch = config_.batch_size > 0 && config_.batch_size < n;
+    std::vector<float> previous;
+    std::vector<uint32_t> labels;
+    std::vector<size_t> counts(k, 0);
+
+    // Mini-batch state
+    std::vector<float> batch;
+    std::vector<size_t> batch_index;
+    if (mini_batch) {
+        batch.resize(config_.batch_size * dim_);
+        batch_index.resize(config_.batch_size);
+        labels.resize(config_.batch_size);
+    } else {
+        labels.resize(n);
+    }
+
+    for (size_t iter = 0; iter < config_.max_iterations; ++iter) {
+        previous = centroids_;
+
+        if (mini_batch) {
+            // Sculley's mini-batch k-means: per-center learning rate 1 / count
+            for (size_t b = 0; b < config_.batch_size; ++b) {
+                batch_index[b] = pick(rng);
+                std::copy(data + batch_index[b] * dim_, data + (batch_index[b] + 1) * dim_,
+                          batch.begin() + b * dim_);
+            }
+            assign_all(batch.data(), config_.batch_size, labels.data());
+
+            for (size_t b = 0; b < config_.batch_size; ++b) {
+                uint32_t c = labels[b];
+                float eta = 1.0f / static_cast<float>(++counts[c]);
+                float* ctr = centroids_.data() + c * dim_;
+                const float* vec = batch.data() + b * dim_;
+                for (size_t d = 0; d < dim_; ++d) {
+                    ctr[d] += eta * (vec[d] - ctr[d]);
+                }
+            }
+        } else {
+            // Lloyd iteration
+            assign_all(data, n, labels.data());
+
+            std::vector<double> sums(k * dim_, 0.0);
+            std::fill(counts.begin(), counts.end(), 0);
+            for (size_t i = 0; i < n; ++i) {
+                uint32_t c = labels[i];
+                counts[c]++;
+                const float* vec = data + i * dim_;
+                double* acc = sums.data() + c * dim_;
+                for (size_t d = 0; d < dim_; ++d) acc[d] += vec[d];
+            }
+            for (size_t c = 0; c < k; ++c) {
+                float* ctr = centroids_.data() + c * dim_;
+                if (counts[c] == 0) {
+                    // Re-seed empty clusters with a random point
+                    size_t p = pick(rng);
+                    std::copy(data + p * dim_, data + (p + 1) * dim_, ctr);
+                    continue;
+                }
+                for (size_t d = 0; d < dim_; ++d) {
+                    ctr[d] = static_cast<float>(sums[c * dim_ + d] / counts[c]);
+                }
+            }
+        }
+
+        update_norms();
+
+        // Convergence: relative squared shift of all centroids
+        double shift = 0.0;
+        double scale = 0.0;
+        for (size_t i = 0; i < centroids_.size(); ++i) {
+            double d = centroids_[i] - previous[i];
+            shift += d * d;
+            scale += static_cast<double>(previous[i]) * previous[i];
+        }
+        if (scale > 0.0 && shift / scale < config_.tolerance) break;
+    }
+
+    return true;
+}
+
+const std::vector<float>& KMeansTrainer::centroids() const {
+    return centroids_;
+}
+
+void KMeansTrainer::set_centroids(const std::vector<float>& centroids, size_t dim) {
+    if (dim == 0 || centroids.size() % dim != 0) return;
+    dim_ = dim;
+    centroids_ = centroids;
+    config_.num_clusters = centroids.size() / dim;
+    update_norms();
+}
+
+size_t KMeansTrainer::num_clusters() const {
+    return dim_ ? centroids_.size() / dim_ : 0;
+}
+
+size_t KMeansTrainer::dimension() const {
+    return dim_;
+}
+
+const KMeansTrainer::Config& KMeansTrainer::config() const {
+    return config_;
+}
+
+} // namespace optimization
+} // namespace minni
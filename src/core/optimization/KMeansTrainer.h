@@ -0,0 +1,87 @@
+#ifndef MINNI_CORE_OPTIMIZATION_KMEANS_TRAINER_H_
+#define MINNI_CORE_OPTIMIZATION_KMEANS_TRAINER_H_
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace minni {
+namespace optimization {
+
+/**
+ * On-device k-means trainer for codebook learning (PQ, IVF coarse quantizers).
+ * - k-means++ seeding on a bounded subsample.
+ * - Full-batch (Lloyd) or mini-batch (Sculley) centroid updates.
+ * - Multithreaded nearest-centroid assignment using DSPKernel dot products.
+ * Results are deterministic for a given seed, independent of the thread count.
+ *
+ * Data is passed as a row-major float array (n x dim), e.g. from
+ * VectorStore::sample() or FlatVectorStore::sample().
+ */
+class KMeansTrainer {
+public:
+    struct Config {
+        size_t num_clusters = 256;
+        size_t max_iterations = 50;
+        size_t batch_size = 2048;      // 0 = full-batch Lloyd iterations
+        size_t init_sample_size = 0;   // Points used for k-means++ (0 = 32 * num_clusters)
+        size_t num_threads = 0;        // 0 = hardware concurrency
+        uint32_t seed = 42;
+        float tolerance = 1e-5f;       // Stop when relative centroid shift falls below this
+    };
+
+    KMeansTrainer();
+    explicit KMeansTrainer(const Config& config);
+    ~KMeansTrainer();
+
+    /**
+     * Train centroids.
+     * @param data Row-major data (n x dim).
+     * @param n Number of points (must be >= num_clusters).
+     * @param dim Dimensionality.
+     * @return true if successful.
+     */
+    bool train(const float* data, size_t n, size_t dim);
+
+    /**
+     * Index of the nearest centroid to a vector.
+     */
+    uint32_t assign(const float* vec) const;
+
+    /**
+     * Multithreaded assignment of n points.
+     * @param out Receives n centroid indices.
+     * @return Sum of squared distances to the assigned centroids (inertia).
+     */
+    double assign_all(const float* data, size_t n, uint32_t* out) const;
+
+    /**
+     * Row-major centroids (num_clusters x dim).
+     */
+    const std::vector<float>& centroids() const;
+
+    /**
+     * Replace the centroids (e.g. loaded from a serialized codebook).
+     */
+    void set_centroids(const std::vector<float>& centroids, size_t dim);
+
+    size_t num_clusters() const;
+    size_t dimension() const;
+    const Config& config() const;
+
+private:
+    Config config_;
+    size_t dim_ = 0;
+    std::vector<float> centroids_;
+    std::vector<float> centroid_norms_; // ||c||^2, cached for dot-product distances
+
+    void init_plus_plus(const float* data, size_t n);
+    void update_norms();
+    uint32_t nearest(const float* vec, float vec_norm, float* out_dist) const;
+    size_t thread_count(size_t work_items) const;
+};
+
+} // namespace optimization
+} // namespace minni
+
+#endif // MINNI_CORE_OPTIMIZATION_KMEANS_TRAINER_H_
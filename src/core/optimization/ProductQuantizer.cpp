@@ -0,0 +1,190 @@
+#include "ProductQuantizer.h"
+#include "../signal/DSPKernel.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+namespace minni {
+namespace optimization {
+
+namespace {
+const char PQ_MAGIC_HEADER[] = "MPQ1"; // Minni Product Quantizer v1
+} // namespace
+
+ProductQuantizer::ProductQuantizer(size_t dim, size_t num_subspaces, size_t num_centroids)
+    : dim_(dim),
+      num_subspaces_(num_subspaces),
+      num_centroids_(std::min<size_t>(num_centroids, 256)),
+      sub_dim_(num_subspaces ? dim / num_subspaces : 0) {}
+
+ProductQuantizer::~ProductQuantizer() = default;
+
+bool ProductQuantizer::train(const float* data, size_t n, KMeansTrainer::Config config) {
+    if (!data || num_subspaces_ == 0 || sub_dim_ == 0 || dim_ % num_subspaces_ != 0) return false;
+    if (num_centroids_ == 0 || n < num_centroids_) return false;
+
+    config.num_clusters = num_centroids_;
+    const uint32_t base_seed = config.seed;
+
+    quantizers_.clear();
+    quantizers_.reserve(num_subspaces_);
+
+    // Gather each subspace into a contiguous (n x sub_dim) block for training
+    std::vector<float> sub_data(n * sub_dim_);
+    for (size_t m = 0; m < num_subspaces_; ++m) {
+        for (size_t i = 0; i < n; ++i) {
+            const float* src = data + i * dim_ + m * sub_dim_;
+            std::copy(src, src + sub_dim_, sub_data.begin() + i * sub_dim_);
+        }
+
+        config.seed = base_seed + static_cast<uint32_t>(m);
+        KMeansTrainer trainer(config);
+        if (!trainer.train(sub_data.data(), n, sub_dim_)) {
+            quantizers_.clear();
+            return false;
+        }
+        quantizers_.push_back(std::move(trainer));
+    }
+    return true;
+}
+
+void ProductQuantizer::encode(const float* vec, uint8_t* codes) const {
+    for (size_t m = 0; m < quantizers_.size(); ++m) {
+        codes[m] = static_cast<uint8_t>(quantizers_[m].assign(vec + m * sub_dim_));
+    }
+}
+
+void ProductQuantizer::encode_batch(const float* data, size_t n, uint8_t* codes) const {
+    if (!is_trained() || n == 0) return;
+
+    size_t threads = std::max<unsigned>(1, std::thread::hardware_concurrency());
+    threads = std::min(threads, std::max<size_t>(1, n / 256));
+
+    auto worker = [&](size_t t) {
+        size_t begin = n * t / threads;
+        size_t end = n * (t + 1) / threads;
+        for (size_t i = begin; i < end; ++i) {
+            encode(data + i * dim_, codes + i * num_subspaces_);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (size_t t = 1; t < threads; ++t) pool.emplace_back(worker, t);
+    worker(0);
+    for (auto& th : pool) th.join();
+}
+
+void ProductQuantizer::decode(const uint8_t* codes, float* out) const {
+    for (size_t m = 0; m < quantizers_.size(); ++m) {
+        const float* ctr = quantizers_[m].centroids().data() + codes[m] * sub_dim_;
+        std::copy(ctr, ctr + sub_dim_, out + m * sub_dim_);
+    }
+}
+
+void ProductQuantizer::compute_distance_table(const float* query, float* table) const {
+    for (size_t m = 0; m < quantizers_.size(); ++m) {
+        const float* q = query + m * sub_dim_;
+        const float* ctrs = quantizers_[m].centroids().data();
+        float q_norm = minni::signal::DSPKernel::dot_product(q, q, sub_dim_);
+        for (size_t k = 0; k < num_centroids_; ++k) {
+            const float* c = ctrs + k * sub_dim_;
+            float dist = q_norm
+                - 2.0f * minni::signal::DSPKernel::dot_product(q, c, sub_dim_)
+                + minni::signal::DSPKernel::dot_product(c, c, sub_dim_);
+            table[m * num_centroids_ + k] = std::max(0.0f, dist);
+        }
+    }
+}
+
+float ProductQuantizer::distance_from_table(const float* table, const uint8_t* codes) const {
+    float dist = 0.0f;
+    for (size_t m = 0; m < num_subspaces_; ++m) {
+        dist += table[m * num_centroids_ + codes[m]];
+    }
+    return dist;
+}
+
+bool ProductQuantizer::save(const std::string& path) const {
+    if (!is_trained()) return false;
+
+    std::ofstream out(path, std::ios::binary);
+    if (!out) return false;
+
+    uint32_t dim = static_cast<uint32_t>(dim_);
+    uint32_t m = static_cast<uint32_t>(num_subspaces_);
+    uint32_t k = static_cast<uint32_t>(num_centroids_);
+
+    out.write(PQ_MAGIC_HEADER, 4);
+    out.write(reinterpret_cast<const char*>(&dim), sizeof(dim));
+    out.write(reinterpret_cast<const char*>(&m), sizeof(m));
+    out.write(reinterpret_cast<const char*>(&k), sizeof(k));
+
+    for (const auto& q : quantizers_) {
+        const auto& ctrs = q.centroids();
+        out.write(reinterpret_cast<const char*>(ctrs.data()), ctrs.size() * sizeof(float));
+    }
+
+    out.close();
+    return out.good();
+}
+
+bool ProductQuantizer::load(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+
+    char header[4];
+    in.read(header, 4);
+    if (!in || std::memcmp(header, PQ_MAGIC_HEADER, 4) != 0) return false;
+
+    uint32_t dim = 0, m = 0, k = 0;
+    in.read(reinterpret_cast<char*>(&dim), sizeof(dim));
+    in.read(reinterpret_cast<char*>(&m), sizeof(m));
+    in.read(reinterpret_cast<char*>(&k), sizeof(k));
+    if (!in || m == 0 || k == 0 || k > 256 || dim % m != 0) return false;
+
+    dim_ = dim;
+    num_subspaces_ = m;
+    num_centroids_ = k;
+    sub_dim_ = dim / m;
+
+    quantizers_.clear();
+    quantizers_.resize(num_subspaces_);
+    std::vector<float> ctrs(num_centroids_ * sub_dim_);
+    for (auto& q : quantizers_) {
+        in.read(reinterpret_cast<char*>(ctrs.data()), ctrs.size() * sizeof(float));
+        if (!in) {
+            quantizers_.clear();
+            return false;
+        }
+        q.set_centroids(ctrs, sub_dim_);
+    }
+    return true;
+}
+
+bool ProductQuantizer::is_trained() const {
+    return !quantizers_.empty() && quantizers_.size() == num_subspaces_;
+}
+
+size_t ProductQuantizer::dimension() const {
+    return dim_;
+}
+
+size_t ProductQuantizer::num_subspaces() const {
+    return num_subspaces_;
+}
+
+size_t ProductQuantizer::num_centroids() const {
+    return num_centroids_;
+}
+
+size_t ProductQuantizer::code_size() const {
+    return num_subspaces_;
+}
+
+const std::vector<float>& ProductQuantizer::codebook(size_t m) const {
+    return quantizers_.at(m).centroids();
+}
+
+} // namespace optimization
+} // namespace minni
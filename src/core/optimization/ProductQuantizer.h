@@ -0,0 +1,88 @@
+#ifndef MINNI_CORE_OPTIMIZATION_PRODUCT_QUANTIZER_H_
+#define MINNI_CORE_OPTIMIZATION_PRODUCT_QUANTIZER_H_
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "KMeansTrainer.h"
+
+namespace minni {
+namespace optimization {
+
+/**
+ * Product Quantizer: splits a vector into M sub-vectors and encodes each one
+ * as the index of its nearest centroid in a per-subspace codebook (K <= 256),
+ * giving M bytes per vector.
+ *
+ * Codebooks are serialized in a compact binary format:
+ *   "MPQ1" | dim (u32) | M (u32) | K (u32) | centroids (float32, M x K x dim/M)
+ */
+class ProductQuantizer {
+public:
+    /**
+     * @param dim Vector dimensionality (must be divisible by num_subspaces).
+     * @param num_subspaces Number of sub-vectors (M) = bytes per code.
+     * @param num_centroids Centroids per subspace (K, at most 256).
+     */
+    ProductQuantizer(size_t dim = 0, size_t num_subspaces = 16, size_t num_centroids = 256);
+    ~ProductQuantizer();
+
+    /**
+     * Train all sub-codebooks with k-means.
+     * @param data Row-major training data (n x dim).
+     * @param config K-means settings; num_clusters is overridden with K.
+     * Each subspace uses seed + m so codebooks are deterministic.
+     */
+    bool train(const float* data, size_t n, KMeansTrainer::Config config = KMeansTrainer::Config());
+
+    /**
+     * Encode one vector into M bytes.
+     */
+    void encode(const float* vec, uint8_t* codes) const;
+
+    /**
+     * Encode n vectors (n x M codes), split into contiguous vector ranges, one per thread.
+     */
+    void encode_batch(const float* data, size_t n, uint8_t* codes) const;
+
+    /**
+     * Reconstruct an approximate vector from its codes.
+     */
+    void decode(const uint8_t* codes, float* out) const;
+
+    /**
+     * Build the asymmetric distance table for a query: M x K squared L2 distances.
+     */
+    void compute_distance_table(const float* query, float* table) const;
+
+    /**
+     * Approximate squared L2 distance between the query (via its table) and a code.
+     */
+    float distance_from_table(const float* table, const uint8_t* codes) const;
+
+    bool save(const std::string& path) const;
+    bool load(const std::string& path);
+
+    bool is_trained() const;
+    size_t dimension() const;
+    size_t num_subspaces() const;
+    size_t num_centroids() const;
+    size_t code_size() const; // bytes per encoded vector (= M)
+
+    /**
+     * Centroids of subspace m (K x dim/M, row-major).
+     */
+    const std::vector<float>& codebook(size_t m) const;
+
+private:
+    size_t dim_;
+    size_t num_subspaces_;
+    size_t num_centroids_;
+    size_t sub_dim_;
+    std::vector<KMeansTrainer> quantizers_; // One per subspace
+};
+
+} // namespace optimization
+} // namespace minni
+
+#endif // MINNI_CORE_OPTIMIZATION_PRODUCT_QUANTIZER_H_
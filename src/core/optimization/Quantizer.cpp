@@ -2,19 +2,25 @@
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <cstring>
 
 namespace minni {
 namespace optimization {
 
 Quantizer::QuantizationParams Quantizer::calculate_params(const std::vector<float>& data) {
-    if (data.empty()) {
+    return calculate_params(data.data(), data.size());
+}
+
+Quantizer::QuantizationParams Quantizer::calculate_params(const float* data, size_t size) {
+    if (size == 0) {
         return {1.0f, 0};
     }
 
     float min_val = data[0];
     float max_val = data[0];
 
-    for (float v : data) {
+    for (size_t i = 0; i < size; ++i) {
+        float v = data[i];
         if (v < min_val) min_val = v;
         if (v > max_val) max_val = v;
     }
@@ -38,6 +44,61 @@ Quantizer::QuantizationParams Quantizer::calculate_params(const std::vector<floa
     return {scale, zero_point};
 }
 
+Quantizer::QuantizationParams Quantizer::calculate_symmetric_params(const float* data, size_t size) {
+    float max_abs = 0.0f;
+    for (size_t i = 0; i < size; ++i) {
+        max_abs = std::max(max_abs, std::abs(data[i]));
+    }
+    if (max_abs < 1e-6f) {
+        return {1.0f, 0};
+    }
+    return {max_abs / 127.0f, 0};
+}
+
+Quantizer::QuantizationParams Quantizer::calculate_int4_params(const float* data, size_t size) {
+    if (size == 0) {
+        return {1.0f, 0};
+    }
+
+    float min_val = data[0];
+    float max_val = data[0];
+    for (size_t i = 1; i < size; ++i) {
+        min_val = std::min(min_val, data[i]);
+        max_val = std::max(max_val, data[i]);
+    }
+    if (std::abs(max_val - min_val) < 1e-6) {
+        return {1.0f, 0};
+    }
+
+    // Int4 range: [-8, 7] -> 15 steps
+    float scale = (max_val - min_val) / 15.0f;
+    int32_t zero_point = static_cast<int32_t>(std::round(-8 - min_val / scale));
+    zero_point = std::max(-8, std::min(7, zero_point));
+    return {scale, zero_point};
+}
+
+void Quantizer::quantize_int4(const float* data, size_t size, const QuantizationParams& params, uint8_t* out) {
+    auto to_nibble = [&](float v) -> uint8_t {
+        int32_t q = static_cast<int32_t>(std::round(v / params.scale)) + params.zero_point;
+        q = std::max(-8, std::min(7, q));
+        return static_cast<uint8_t>(q & 0x0F);
+    };
+    for (size_t i = 0; i + 1 < size; i += 2) {
+        out[i / 2] = static_cast<uint8_t>(to_nibble(data[i]) | (to_nibble(data[i + 1]) << 4));
+    }
+    if (size % 2) {
+        out[size / 2] = to_nibble(data[size - 1]);
+    }
+}
+
+void Quantizer::dequantize_int4(const uint8_t* data, size_t size, const QuantizationParams& params, float* out) {
+    for (size_t i = 0; i < size; ++i) {
+        uint8_t nibble = (i % 2) ? (data[i / 2] >> 4) : (data[i / 2] & 0x0F);
+        int32_t q = (nibble & 0x08) ? static_cast<int32_t>(nibble) - 16 : nibble; // Sign-extend
+        out[i] = (q - params.zero_point) * params.scale;
+    }
+}
+
 std::vector<int8_t> Quantizer::quantize(const std::vector<float>& data, const QuantizationParams& params) {
     std::vector<int8_t> quantized;
     quantized.reserve(data.size());
@@ -48,6 +109,12 @@ std::vector<int8_t> Quantizer::quantize(const std::vector<float>& data, const Qu
     return quantized;
 }
 
+void Quantizer::quantize(const float* data, size_t size, const QuantizationParams& params, int8_t* out) {
+    for (size_t i = 0; i < size; ++i) {
+        out[i] = quantize_scalar(data[i], params);
+    }
+}
+
 std::vector<float> Quantizer::dequantize(const std::vector<int8_t>& data, const QuantizationParams& params) {
     std::vector<float> dequantized;
     dequantized.reserve(data.size());
@@ -58,6 +125,81 @@ std::vector<float> Quantizer::dequantize(const std::vector<int8_t>& data, const
     return dequantized;
 }
 
+float Quantizer::dequantized_cosine(const float* query, float query_norm,
+                                    const int8_t* data, const QuantizationParams& params, size_t size) {
+    float dot = 0.0f;
+    float norm_sq = 0.0f;
+    for (size_t i = 0; i < size; ++i) {
+        float v = (static_cast<int32_t>(data[i]) - params.zero_point) * params.scale;
+        dot += query[i] * v;
+        norm_sq += v * v;
+    }
+    if (query_norm < 1e-9f || norm_sq < 1e-18f) return 0.0f;
+    return dot / (query_norm * std::sqrt(norm_sq));
+}
+
+float Quantizer::half_to_float(uint16_t value) {
+    uint32_t sign = static_cast<uint32_t>(value & 0x8000) << 16;
+    uint32_t exponent = (value >> 10) & 0x1F;
+    uint32_t mantissa = value & 0x3FF;
+    uint32_t bits;
+
+    if (exponent == 0) {
+        if (mantissa == 0) {
+            bits = sign; // +-0
+        } else {
+            // Subnormal: normalize the mantissa
+            exponent = 127 - 15 + 1;
+            while ((mantissa & 0x400) == 0) {
+                mantissa <<= 1;
+                exponent--;
+            }
+            mantissa &= 0x3FF;
+            bits = sign | (exponent << 23) | (mantissa << 13);
+        }
+    } else if (exponent == 0x1F) {
+        bits = sign | 0x7F800000 | (mantissa << 13); // Inf / NaN
+    } else {
+        bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+    }
+
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+uint16_t Quantizer::float_to_half(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+    uint32_t abs_bits = bits & 0x7FFFFFFF;
+
+    if (abs_bits >= 0x7F800000) {
+        // Inf or NaN (keep NaN quiet)
+        return sign | 0x7C00 | (abs_bits > 0x7F800000 ? 0x200 : 0);
+    }
+    if (abs_bits >= 0x477FF000) {
+        return sign | 0x7C00; // Overflow -> Inf
+    }
+    if (abs_bits < 0x38800000) {
+        // Subnormal half (or zero): shift with round-to-nearest-even
+        if (abs_bits < 0x33000000) return sign;
+        uint32_t exponent = abs_bits >> 23;
+        uint32_t mantissa = (abs_bits & 0x7FFFFF) | 0x800000;
+        uint32_t shift = 126 - exponent;
+        uint32_t half_mantissa = mantissa >> shift;
+        uint32_t remainder = mantissa & ((1u << shift) - 1);
+        uint32_t halfway = 1u << (shift - 1);
+        if (remainder > halfway || (remainder == halfway && (half_mantissa & 1))) half_mantissa++;
+        return sign | static_cast<uint16_t>(half_mantissa);
+    }
+
+    // Normal: rebias exponent and round mantissa to 10 bits (nearest even)
+    uint32_t rounded = abs_bits + 0xFFF + ((abs_bits >> 13) & 1);
+    return sign | static_cast<uint16_t>((rounded - 0x38000000) >> 13);
+}
+
 int8_t Quantizer::quantize_scalar(float value, const QuantizationParams& params) {
     // q = round(val / scale + zero_point)
     int32_t q = static_cast<int32_t>(std::round(value / params.scale) + params.zero_point);
@@ -4,6 +4,7 @@
 #include <vector>
 #include <cstdint>
 #include <utility>
+#include <cstddef>
 
 namespace minni {
 namespace optimization {
@@ -24,18 +25,61 @@ public:
      * Maps [min, max] to [-128, 127] (int8).
      */
     static QuantizationParams calculate_params(const std::vector<float>& data);
+    static QuantizationParams calculate_params(const float* data, size_t size);
+
+    /**
+     * Symmetric int8 parameters: maps [-max|x|, max|x|] to [-127, 127] with zero_point = 0.
+     * The result is usable with quantize()/dequantize() like asymmetric params.
+     */
+    static QuantizationParams calculate_symmetric_params(const float* data, size_t size);
+
+    /**
+     * Int4 parameters: maps [min, max] to [-8, 7].
+     */
+    static QuantizationParams calculate_int4_params(const float* data, size_t size);
+
+    /**
+     * Quantize to packed int4 (two values per byte, element 2i in the low nibble).
+     * @param out Receives (size + 1) / 2 bytes.
+     */
+    static void quantize_int4(const float* data, size_t size, const QuantizationParams& params, uint8_t* out);
+
+    /**
+     * Unpack and dequantize int4 values.
+     */
+    static void dequantize_int4(const uint8_t* data, size_t size, const QuantizationParams& params, float* out);
 
     /**
      * Quantize a vector of floats to int8.
      */
     static std::vector<int8_t> quantize(const std::vector<float>& data, const QuantizationParams& params);
 
+    /**
+     * Quantize into a caller-provided buffer (no allocation).
+     */
+    static void quantize(const float* data, size_t size, const QuantizationParams& params, int8_t* out);
+
     /**
      * Dequantize a vector of int8 back to float.
      * value = (q - zero_point) * scale
      */
     static std::vector<float> dequantize(const std::vector<int8_t>& data, const QuantizationParams& params);
 
+    /**
+     * Cosine similarity between a float query and an int8 vector, dequantizing inline
+     * (no temporary buffers).
+     * @param query_norm L2 norm of the query (precomputed once per search).
+     */
+    static float dequantized_cosine(const float* query, float query_norm,
+                                    const int8_t* data, const QuantizationParams& params, size_t size);
+
+    /**
+     * IEEE 754 half precision (binary16) <-> float32 conversion.
+     * Handles subnormals, infinities and NaN; float_to_half rounds to nearest even.
+     */
+    static float half_to_float(uint16_t value);
+    static uint16_t float_to_half(float value);
+
     /**
      * Quantize a single value.
      */
@@ -164,5 +164,37 @@ bool MemoryMapper::is_mapped() const {
     return mapped_ptr_ != nullptr;
 }
 
+bool MemoryMapper::advise(size_t offset, size_t length, Advice advice) const {
+    if (!mapped_ptr_ || offset >= mapped_size_ || length == 0) {
+        return false;
+    }
+    if (length > mapped_size_ - offset) {
+        length = mapped_size_ - offset;
+    }
+
+#ifdef _WIN32
+    // No cheap per-range equivalent; the mapping works without hints.
+    (void)advice;
+    return true;
+#else
+    int native_advice = MADV_NORMAL;
+    switch (advice) {
+        case Advice::NORMAL:     native_advice = MADV_NORMAL; break;
+        case Advice::SEQUENTIAL: native_advice = MADV_SEQUENTIAL; break;
+        case Advice::RANDOM:     native_advice = MADV_RANDOM; break;
+        case Advice::WILLNEED:   native_advice = MADV_WILLNEED; break;
+        case Advice::DONTNEED:   native_advice = MADV_DONTNEED; break;
+    }
+
+    // madvise() requires a page-aligned start address
+    static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t aligned_offset = offset - (offset % page_size);
+    size_t aligned_length = length + (offset - aligned_offset);
+
+    char* base = static_cast<char*>(mapped_ptr_) + aligned_offset;
+    return madvise(base, aligned_length, native_advice) == 0;
+#endif
+}
+
 } // namespace platform
 } // namespace minni
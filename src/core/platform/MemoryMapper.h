@@ -14,6 +14,17 @@ namespace platform {
  */
 class MemoryMapper {
 public:
+    /**
+     * Access pattern hints forwarded to madvise() (no-op where unsupported).
+     */
+    enum class Advice {
+        NORMAL,
+        SEQUENTIAL,
+        RANDOM,
+        WILLNEED,
+        DONTNEED
+    };
+
     MemoryMapper();
     ~MemoryMapper();
 
@@ -52,6 +63,15 @@ public:
      */
     bool is_mapped() const;
 
+    /**
+     * Hint the kernel about how a byte range of the mapping will be accessed.
+     * The range is widened to page boundaries.
+     * @param offset Byte offset from the start of the mapping.
+     * @param length Number of bytes.
+     * @return true if the hint was applied (or the platform ignores hints).
+     */
+    bool advise(size_t offset, size_t length, Advice advice) const;
+
 private:
     void* mapped_ptr_ = nullptr;
     size_t mapped_size_ = 0;
@@ -1,6 +1,12 @@
 #include "DSPKernel.h"
+#include "FFTPlan.h"
+#include "PartitionedConvolver.h"
+#include "VectorMath.h"
 #include <cmath>
 #include <algorithm> // for std::swap
+#include <cstring>
+#include <memory>
+#include <vector>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -10,6 +16,8 @@
 #if defined(__ARM_NEON) || defined(__ARM_NEON__)
     #include <arm_neon.h>
     #define HAS_NEON
+#elif defined(__AVX__)
+    #include <immintrin.h>
 #endif
 
 namespace minni {
@@ -38,6 +46,13 @@ void DSPKernel::complex_magnitude(const float* real, const float* imag, float* o
 
         vst1q_f32(output + i, result);
     }
+#elif defined(__AVX__)
+    for (; i + 7 < size; i += 8) {
+        __m256 r_vec = _mm256_loadu_ps(real + i);
+        __m256 i_vec = _mm256_loadu_ps(imag + i);
+        __m256 sum = _mm256_add_ps(_mm256_mul_ps(r_vec, r_vec), _mm256_mul_ps(i_vec, i_vec));
+        _mm256_storeu_ps(output + i, _mm256_sqrt_ps(sum));
+    }
 #endif
 
     // Scalar fallback (tail handling)
@@ -46,6 +61,50 @@ void DSPKernel::complex_magnitude(const float* real, const float* imag, float* o
     }
 }
 
+void DSPKernel::log_magnitude(const float* real, const float* imag, float* output, size_t size,
+                              float floor) {
+    // Power into output, then one vectorized log pass
+    const float floor_sq = floor * floor;
+    for (size_t i = 0; i < size; ++i) {
+        output[i] = std::max(real[i] * real[i] + imag[i] * imag[i], floor_sq);
+    }
+    VectorMath::log(output, output, size);
+    for (size_t i = 0; i < size; ++i) {
+        output[i] *= 0.5f;
+    }
+}
+
+void DSPKernel::db_scale(const float* input, float* output, size_t size, bool power,
+                         float ref, float floor) {
+    for (size_t i = 0; i < size; ++i) {
+        output[i] = std::max(input[i], floor);
+    }
+    VectorMath::log(output, output, size);
+    // k * log10(x / ref) = k / ln(10) * (ln(x) - ln(ref))
+    const float scale = (power ? 10.0f : 20.0f) / 2.302585093f;
+    const float offset = std::log(ref);
+    for (size_t i = 0; i < size; ++i) {
+        output[i] = scale * (output[i] - offset);
+    }
+}
+
+void DSPKernel::softmax(const float* input, float* output, size_t size) {
+    if (size == 0) return;
+    const float max_value = *std::max_element(input, input + size);
+    for (size_t i = 0; i < size; ++i) {
+        output[i] = input[i] - max_value;
+    }
+    VectorMath::exp(output, output, size);
+    float sum = 0.0f;
+    for (size_t i = 0; i < size; ++i) {
+        sum += output[i];
+    }
+    const float inv = 1.0f / sum;
+    for (size_t i = 0; i < size; ++i) {
+        output[i] *= inv;
+    }
+}
+
 void DSPKernel::apply_window(const float* input, const float* window, float* output, size_t size) {
     size_t i = 0;
 #ifdef HAS_NEON
@@ -61,18 +120,103 @@ void DSPKernel::apply_window(const float* input, const float* window, float* out
     }
 }
 
+#if defined(__AVX__) && !defined(HAS_NEON)
+const size_t DSPKernel::FIR_FFT_THRESHOLD = 256;
+#else
+const size_t DSPKernel::FIR_FFT_THRESHOLD = 64;
+#endif
+
 void DSPKernel::fir_filter(const float* input, size_t input_size,
                            const float* taps, size_t taps_size,
                            float* output) {
-    // Naive convolution: O(N*M)
-    // Optimized versions would use FFT for large kernels.
-    for (size_t i = 0; i < input_size; ++i) {
+    if (taps_size >= FIR_FFT_THRESHOLD && input_size >= taps_size) {
+        // Building the tap spectra costs about as much as filtering a frame, so keep
+        // the last convolver per thread. Taps are compared by value because callers
+        // may reuse one buffer for different filters.
+        thread_local std::unique_ptr<PartitionedConvolver> convolver;
+        thread_local std::vector<float> convolver_taps;
+        if (!convolver || convolver_taps.size() != taps_size ||
+            std::memcmp(convolver_taps.data(), taps, taps_size * sizeof(float)) != 0) {
+            convolver.reset(new PartitionedConvolver(taps, taps_size));
+            convolver_taps.assign(taps, taps + taps_size);
+        }
+        convolver->process(input, input_size, output);
+        return;
+    }
+    fir_filter_direct(input, input_size, taps, taps_size, output);
+}
+
+void DSPKernel::fir_filter_direct(const float* input, size_t input_size,
+                                  const float* taps, size_t taps_size,
+                                  float* output) {
+    // 1. Head: outputs with fewer than taps_size past samples (implicit zero history)
+    size_t head = std::min(input_size, taps_size > 0 ? taps_size - 1 : 0);
+    for (size_t i = 0; i < head; ++i) {
         float acc = 0.0f;
+        for (size_t j = 0; j <= i; ++j) {
+            acc += input[i - j] * taps[j];
+        }
+        output[i] = acc;
+    }
+
+    fir_filter_history(input + head, input_size - head, taps, taps_size, output + head);
+}
+
+void DSPKernel::fir_filter_history(const float* input, size_t input_size,
+                                   const float* taps, size_t taps_size,
+                                   float* output) {
+    // 1. Body: several consecutive outputs at once. For each tap the inputs
+    //    x[i-j .. i-j+W) are contiguous, so the loop is a broadcast multiply-add
+    //    with no branches and W independent accumulators.
+    size_t i = 0;
+#ifdef HAS_NEON
+    for (; i + 7 < input_size; i += 8) {
+        float32x4_t acc0 = vdupq_n_f32(0.0f);
+        float32x4_t acc1 = vdupq_n_f32(0.0f);
         for (size_t j = 0; j < taps_size; ++j) {
-            if (i >= j) {
-                acc += input[i - j] * taps[j];
+            const float* x = input + i - j;
+            float32x4_t t = vdupq_n_f32(taps[j]);
+            acc0 = vmlaq_f32(acc0, vld1q_f32(x), t);
+            acc1 = vmlaq_f32(acc1, vld1q_f32(x + 4), t);
+        }
+        vst1q_f32(output + i, acc0);
+        vst1q_f32(output + i + 4, acc1);
+    }
+#elif defined(__AVX__)
+    for (; i + 15 < input_size; i += 16) {
+        __m256 acc0 = _mm256_setzero_ps();
+        __m256 acc1 = _mm256_setzero_ps();
+        for (size_t j = 0; j < taps_size; ++j) {
+            const float* x = input + i - j;
+            __m256 t = _mm256_set1_ps(taps[j]);
+            acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_loadu_ps(x), t));
+            acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_loadu_ps(x + 8), t));
+        }
+        _mm256_storeu_ps(output + i, acc0);
+        _mm256_storeu_ps(output + i + 8, acc1);
+    }
+#else
+    for (; i + 7 < input_size; i += 8) {
+        float acc[8] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+        for (size_t j = 0; j < taps_size; ++j) {
+            const float* x = input + i - j;
+            const float t = taps[j];
+            for (size_t k = 0; k < 8; ++k) {
+                acc[k] += x[k] * t;
             }
         }
+        for (size_t k = 0; k < 8; ++k) {
+            output[i + k] = acc[k];
+        }
+    }
+#endif
+
+    // 2. Tail
+    for (; i < input_size; ++i) {
+        float acc = 0.0f;
+        for (size_t j = 0; j < taps_size; ++j) {
+            acc += input[i - j] * taps[j];
+        }
         output[i] = acc;
     }
 }
@@ -189,59 +333,28 @@ void DSPKernel::bit_reverse_copy(const float* src_r, const float* src_i,
 }
 
 void DSPKernel::fft(float* real, float* imag, size_t size, bool inverse) {
-    // 1. Bit-reversal Permutation (In-place)
-    int bits = 0;
-    while ((1 << bits) < size) bits++;
-
-    for (size_t i = 0; i < size; ++i) {
-        size_t rev = 0;
-        size_t val = i;
-        for (int b = 0; b < bits; ++b) {
-            rev = (rev << 1) | (val & 1);
-            val >>= 1;
-        }
-        if (i < rev) {
-            std::swap(real[i], real[rev]);
-            std::swap(imag[i], imag[rev]);
-        }
+    // Plans are expensive to build and cheap to run: keep the last one per thread
+    thread_local std::unique_ptr<FFTPlan> plan;
+    if (!plan || plan->size() != size) {
+        plan.reset(new FFTPlan(size));
     }
+    plan->execute(real, imag, inverse);
+}
 
-    // 2. Butterfly Operations (Cooley-Tukey)
-    for (size_t len = 2; len <= size; len <<= 1) {
-        float ang = 2 * M_PI / len * (inverse ? -1 : 1);
-        float wlen_r = std::cos(ang);
-        float wlen_i = std::sin(ang);
-
-        for (size_t i = 0; i < size; i += len) {
-            float w_r = 1.0f;
-            float w_i = 0.0f;
-            for (size_t j = 0; j < len / 2; ++j) {
-                float u_r = real[i + j];
-                float u_i = imag[i + j];
-
-                // v = w * input[i+j+len/2]
-                float v_r = real[i + j + len / 2] * w_r - imag[i + j + len / 2] * w_i;
-                float v_i = real[i + j + len / 2] * w_i + imag[i + j + len / 2] * w_r;
-
-                real[i + j] = u_r + v_r;
-                imag[i + j] = u_i + v_i;
-                real[i + j + len / 2] = u_r - v_r;
-                imag[i + j + len / 2] = u_i - v_i;
-
-                float temp_w_r = w_r * wlen_r - w_i * wlen_i;
-                w_i = w_r * wlen_i + w_i * wlen_r;
-                w_r = temp_w_r;
-            }
-        }
+void DSPKernel::rfft(const float* input, float* real, float* imag, size_t size) {
+    thread_local std::unique_ptr<RealFFTPlan> plan;
+    if (!plan || plan->size() != size) {
+        plan.reset(new RealFFTPlan(size));
     }
+    plan->forward(input, real, imag);
+}
 
-    // 3. Scaling for Inverse FFT
-    if (inverse) {
-        for (size_t i = 0; i < size; ++i) {
-            real[i] /= size;
-            imag[i] /= size;
-        }
+void DSPKernel::irfft(float* real, float* imag, float* output, size_t size) {
+    thread_local std::unique_ptr<RealFFTPlan> plan;
+    if (!plan || plan->size() != size) {
+        plan.reset(new RealFFTPlan(size));
     }
+    plan->inverse(real, imag, output);
 }
 
 } // namespace signal
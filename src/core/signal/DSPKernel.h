@@ -19,20 +19,68 @@ public:
      */
     static void complex_magnitude(const float* real, const float* imag, float* output, size_t size);
 
+    /**
+     * Natural log of the complex magnitude (log-spectrum), via VectorMath.
+     * output[i] = log(max(|z[i]|, floor)); computed as 0.5 * log(re^2 + im^2) without a sqrt.
+     */
+    static void log_magnitude(const float* real, const float* imag, float* output, size_t size,
+                              float floor = 1e-10f);
+
+    /**
+     * Convert power (or amplitude) values to decibels relative to ref, via VectorMath.
+     * output[i] = k * log10(max(input[i], floor) / ref), k = 10 for power, 20 for amplitude.
+     * output may alias input.
+     */
+    static void db_scale(const float* input, float* output, size_t size, bool power = true,
+                         float ref = 1.0f, float floor = 1e-10f);
+
+    /**
+     * Numerically stable softmax (max-subtracted), via VectorMath::exp.
+     * output may alias input.
+     */
+    static void softmax(const float* input, float* output, size_t size);
+
     /**
      * Apply a window function (e.g., Hanning) to an input buffer.
      * output[i] = input[i] * window[i]
      */
     static void apply_window(const float* input, const float* window, float* output, size_t size);
 
+    /**
+     * Tap count from which fir_filter() switches to partitioned FFT convolution
+     * (measured crossover: 64 with 4-wide SIMD, 256 with AVX).
+     */
+    static const size_t FIR_FFT_THRESHOLD;
+
     /**
      * FIR (Finite Impulse Response) Filter.
-     * Standard convolution.
+     * Causal convolution with zero history: output[i] = sum_j input[i - j] * taps[j].
+     * Uses PartitionedConvolver (overlap-save) for filters of FIR_FFT_THRESHOLD taps
+     * or more, fir_filter_direct() otherwise. The last convolver is kept per thread
+     * and reused while the taps are unchanged. To filter a continuous stream block
+     * by block, use FirFilter.
      */
     static void fir_filter(const float* input, size_t input_size,
                            const float* taps, size_t taps_size,
                            float* output);
 
+    /**
+     * Direct-form FIR: branch-free, SIMD across consecutive outputs. O(N*M).
+     */
+    static void fir_filter_direct(const float* input, size_t input_size,
+                                  const float* taps, size_t taps_size,
+                                  float* output);
+
+    /**
+     * Direct-form FIR continuing from caller-provided history:
+     * output[i] = sum_j input[i - j] * taps[j] for 0 <= i < input_size, where
+     * input[-1] .. input[1 - taps_size] must be readable and hold the previous samples.
+     * Used by FirFilter to stream a signal block by block.
+     */
+    static void fir_filter_history(const float* input, size_t input_size,
+                                   const float* taps, size_t taps_size,
+                                   float* output);
+
     /**
      * Vector addition: out = a + b
      */
@@ -61,17 +109,38 @@ public:
     static int32_t dot_product_i8(const int8_t* a, const int8_t* b, size_t size);
 
     /**
-     * In-place Radix-2 FFT (Fast Fourier Transform).
-     * Size must be a power of 2.
+     * In-place FFT (Fast Fourier Transform) of any size.
+     * Powers of 2 are fastest; other sizes use mixed radix or Bluestein (see FFTPlan).
      * Real and imaginary parts are stored in separate arrays (split-complex format).
+     * Uses a per-thread cached FFTPlan; hold an FFTPlan directly when alternating sizes.
+     * Forward uses the e^{-i} convention; the inverse is scaled by 1/size.
      *
      * @param real Real components (input and output)
      * @param imag Imaginary components (input and output)
-     * @param size Number of points (must be power of 2)
+     * @param size Number of points
      * @param inverse If true, perform Inverse FFT (IFFT)
      */
     static void fft(float* real, float* imag, size_t size, bool inverse = false);
 
+    /**
+     * Real-input FFT: N real samples -> N/2 + 1 complex bins (DC .. Nyquist).
+     * About twice as fast as fft() on zero-imaginary data. Uses a per-thread cached RealFFTPlan.
+     *
+     * @param input N real samples (may alias real)
+     * @param real Receives N/2 + 1 real components
+     * @param imag Receives N/2 + 1 imaginary components
+     * @param size Number of real samples N (must be even)
+     */
+    static void rfft(const float* input, float* real, float* imag, size_t size);
+
+    /**
+     * Inverse of rfft(), scaled by 1/N. real/imag are overwritten (used as workspace).
+     *
+     * @param output Receives N real samples (may alias real)
+     * @param size Number of real samples N (must be even)
+     */
+    static void irfft(float* real, float* imag, float* output, size_t size);
+
 private:
     // Helper for bit-reversal permutation
     static void bit_reverse_copy(const float* src_r, const float* src_i,
@@ -0,0 +1,681 @@
+#include "FFTPlan.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Check for NEON support
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define HAS_NEON
+#elif defined(__AVX__)
+    #include <immintrin.h>
+    #define HAS_AVX
+#endif
+
+namespace minni {
+namespace signal {
+
+namespace {
+
+// Complex points per cache block (split real/imag floats: 16 KB per block)
+const size_t BLOCK_POINTS = 2048;
+
+// Largest prime handled as a generic radix; larger factors go to Bluestein
+const size_t MAX_GENERIC_RADIX = 31;
+
+// Relative cost per point of one pass (roughly flops per complex element)
+double pass_cost(size_t radix) {
+    switch (radix) {
+        case 2: return 1.0;
+        case 3: return 1.6;
+        case 4: return 1.5;
+        case 5: return 2.4;
+        default: return 1.2 * radix; // Generic radix: direct radix-point DFT
+    }
+}
+
+double power_of_two_cost(size_t size) {
+    double passes = 0.0;
+    for (size_t n = size; n > 1; n >>= 1) passes += 0.5;
+    return size * passes * pass_cost(4);
+}
+
+bool is_power_of_two(size_t size) {
+    return size > 0 && (size & (size - 1)) == 0;
+}
+
+// Radix-4 first (cheapest per factor of 2), then 2, 3, 5 and other primes.
+// Returns false if a prime factor exceeds MAX_GENERIC_RADIX.
+bool factorize(size_t size, std::vector<size_t>& radices) {
+    while (size % 4 == 0) { radices.push_back(4); size /= 4; }
+    if (size % 2 == 0) { radices.push_back(2); size /= 2; }
+    for (size_t p = 3; size > 1; p += 2) {
+        if (p > MAX_GENERIC_RADIX) return false;
+        while (size % p == 0) { radices.push_back(p); size /= p; }
+    }
+    return true;
+}
+
+} // namespace
+
+FFTPlan::FFTPlan(size_t size) : size_(size), algorithm_(Algorithm::NONE), block_size_(0) {
+    if (size_ == 0) return;
+
+    if (is_power_of_two(size_)) {
+        algorithm_ = Algorithm::RADIX2;
+        init_radix2();
+        return;
+    }
+
+    // Cost model: mixed radix over the factorization vs. Bluestein's two
+    // power-of-2 FFTs of length >= 2N - 1 plus the pointwise products
+    std::vector<size_t> radices;
+    double mixed_cost = -1.0;
+    if (factorize(size_, radices)) {
+        mixed_cost = 0.0;
+        for (size_t r : radices) mixed_cost += size_ * pass_cost(r);
+    }
+
+    size_t conv = 1;
+    while (conv < 2 * size_ - 1) conv <<= 1;
+    double bluestein_cost = 2.0 * power_of_two_cost(conv) + 3.0 * conv + 4.0 * size_;
+
+    if (mixed_cost >= 0.0 && mixed_cost <= bluestein_cost) {
+        algorithm_ = Algorithm::MIXED_RADIX;
+        init_mixed(radices);
+    } else {
+        algorithm_ = Algorithm::BLUESTEIN;
+        init_bluestein();
+    }
+}
+
+FFTPlan::~FFTPlan() = default;
+
+void FFTPlan::init_radix2() {
+    if (size_ < 2) return;
+
+    int bits = 0;
+    while ((static_cast<size_t>(1) << bits) < size_) bits++;
+
+    // 1. Bit-reversal swap pairs
+    for (size_t i = 0; i < size_; ++i) {
+        size_t rev = 0;
+        for (int b = 0; b < bits; ++b) {
+            rev |= ((i >> b) & 1) << (bits - 1 - b);
+        }
+        if (i < rev) {
+            swaps_.push_back(static_cast<uint32_t>(i));
+            swaps_.push_back(static_cast<uint32_t>(rev));
+        }
+    }
+
+    // 2. Twiddles: stage `half` owns entries [half - 1, 2 * half - 1), computed directly
+    //    from the angle (no recurrence, so no accumulated rounding error)
+    twiddle_r_.resize(size_ - 1);
+    twiddle_i_.resize(size_ - 1);
+    for (size_t half = 1; half < size_; half <<= 1) {
+        for (size_t j = 0; j < half; ++j) {
+            double angle = M_PI * static_cast<double>(j) / static_cast<double>(half);
+            twiddle_r_[half - 1 + j] = static_cast<float>(std::cos(angle));
+            twiddle_i_[half - 1 + j] = static_cast<float>(-std::sin(angle));
+        }
+    }
+
+    // 3. Passes: a leading radix-2 stage if log2(N) is odd, then radix-4 pairs.
+    //    Passes whose span fits in a block run depth-first per block.
+    block_size_ = size_ < BLOCK_POINTS ? size_ : BLOCK_POINTS;
+    size_t half = 1;
+    if (bits % 2) {
+        block_passes_.push_back({1, false});
+        half = 2;
+    }
+    for (; half < size_; half <<= 2) {
+        Pass pass = {half, true};
+        if (half * 4 <= block_size_) {
+            block_passes_.push_back(pass);
+        } else {
+            global_passes_.push_back(pass);
+        }
+    }
+}
+
+void FFTPlan::init_mixed(const std::vector<size_t>& radices) {
+    size_t stride = 1;
+    for (size_t radix : radices) {
+        MixedPass pass = {radix, stride, twiddle_r_.size(), root_r_.size()};
+
+        // W_{stride*radix}^(p*r) for p < stride, 1 <= r < radix
+        for (size_t p = 0; p < stride; ++p) {
+            for (size_t r = 1; r < radix; ++r) {
+                double angle = -2.0 * M_PI * static_cast<double>(p * r) / static_cast<double>(stride * radix);
+                twiddle_r_.push_back(static_cast<float>(std::cos(angle)));
+                twiddle_i_.push_back(static_cast<float>(std::sin(angle)));
+            }
+        }
+
+        // Generic radices: e^{-2*pi*i*q/radix}, q < radix
+        if (radix > 5) {
+            for (size_t q = 0; q < radix; ++q) {
+                double angle = -2.0 * M_PI * static_cast<double>(q) / static_cast<double>(radix);
+                root_r_.push_back(static_cast<float>(std::cos(angle)));
+                root_i_.push_back(static_cast<float>(std::sin(angle)));
+            }
+        }
+
+        mixed_passes_.push_back(pass);
+        stride *= radix;
+    }
+
+    scratch_r_.resize(size_);
+    scratch_i_.resize(size_);
+}
+
+void FFTPlan::init_bluestein() {
+    size_t conv = 1;
+    while (conv < 2 * size_ - 1) conv <<= 1;
+    inner_.reset(new FFTPlan(conv));
+
+    // Chirp w[n] = e^{-i*pi*n^2/N}; n^2 is reduced mod 2N in integers to keep the angle exact
+    chirp_r_.resize(size_);
+    chirp_i_.resize(size_);
+    for (size_t n = 0; n < size_; ++n) {
+        uint64_t n2 = (static_cast<uint64_t>(n) * n) % (2 * static_cast<uint64_t>(size_));
+        double angle = -M_PI * static_cast<double>(n2) / static_cast<double>(size_);
+        chirp_r_[n] = static_cast<float>(std::cos(angle));
+        chirp_i_[n] = static_cast<float>(std::sin(angle));
+    }
+
+    // Kernel b[n] = conj(w[|n|]) wrapped circularly, pre-transformed
+    kernel_r_.assign(conv, 0.0f);
+    kernel_i_.assign(conv, 0.0f);
+    for (size_t n = 0; n < size_; ++n) {
+        kernel_r_[n] = chirp_r_[n];
+        kernel_i_[n] = -chirp_i_[n];
+        if (n > 0) {
+            kernel_r_[conv - n] = chirp_r_[n];
+            kernel_i_[conv - n] = -chirp_i_[n];
+        }
+    }
+    inner_->forward(kernel_r_.data(), kernel_i_.data());
+
+    scratch_r_.resize(conv);
+    scratch_i_.resize(conv);
+}
+
+bool FFTPlan::is_valid() const {
+    return algorithm_ != Algorithm::NONE;
+}
+
+size_t FFTPlan::size() const {
+    return size_;
+}
+
+FFTPlan::Algorithm FFTPlan::algorithm() const {
+    return algorithm_;
+}
+
+std::vector<size_t> FFTPlan::radices() const {
+    std::vector<size_t> result;
+    for (const auto& pass : mixed_passes_) result.push_back(pass.radix);
+    return result;
+}
+
+void FFTPlan::forward(float* real, float* imag) const {
+    execute(real, imag, false);
+}
+
+void FFTPlan::inverse(float* real, float* imag) const {
+    execute(real, imag, true);
+}
+
+void FFTPlan::execute(float* real, float* imag, bool inverse) const {
+    if (size_ < 2) return;
+
+    // IDFT(x) = swap(DFT(swap(x))) / N, where swap exchanges real and imaginary parts:
+    // the same forward kernel serves both directions.
+    if (inverse) {
+        float* tmp = real;
+        real = imag;
+        imag = tmp;
+    }
+
+    switch (algorithm_) {
+        case Algorithm::RADIX2: execute_radix2(real, imag); break;
+        case Algorithm::MIXED_RADIX: execute_mixed(real, imag); break;
+        case Algorithm::BLUESTEIN: execute_bluestein(real, imag); break;
+        default: return;
+    }
+
+    // Scaling for Inverse FFT
+    if (inverse) {
+        const float scale = 1.0f / static_cast<float>(size_);
+        for (size_t i = 0; i < size_; ++i) {
+            real[i] *= scale;
+            imag[i] *= scale;
+        }
+    }
+}
+
+void FFTPlan::execute_radix2(float* real, float* imag) const {
+    // 1. Bit-reversal permutation
+    for (size_t s = 0; s < swaps_.size(); s += 2) {
+        uint32_t a = swaps_[s];
+        uint32_t b = swaps_[s + 1];
+        float tr = real[a]; real[a] = real[b]; real[b] = tr;
+        float ti = imag[a]; imag[a] = imag[b]; imag[b] = ti;
+    }
+
+    // 2. Butterflies: small stages block by block, then the large ones
+    for (size_t base = 0; base < size_; base += block_size_) {
+        for (const auto& pass : block_passes_) {
+            run_pass(pass, real, imag, base, base + block_size_);
+        }
+    }
+    for (const auto& pass : global_passes_) {
+        run_pass(pass, real, imag, 0, size_);
+    }
+}
+
+void FFTPlan::execute_mixed(float* real, float* imag) const {
+    // Stockham autosort: ping-pong between the data and the scratch buffer
+    const float* in_r = real;
+    const float* in_i = imag;
+    float* out_r = scratch_r_.data();
+    float* out_i = scratch_i_.data();
+
+    for (const auto& pass : mixed_passes_) {
+        run_mixed_pass(pass, in_r, in_i, out_r, out_i);
+        in_r = out_r;
+        in_i = out_i;
+        out_r = (out_r == real) ? scratch_r_.data() : real;
+        out_i = (out_i == imag) ? scratch_i_.data() : imag;
+    }
+
+    if (in_r != real) {
+        std::memcpy(real, in_r, size_ * sizeof(float));
+        std::memcpy(imag, in_i, size_ * sizeof(float));
+    }
+}
+
+void FFTPlan::execute_bluestein(float* real, float* imag) const {
+    const size_t conv = inner_->size();
+    float* ar = scratch_r_.data();
+    float* ai = scratch_i_.data();
+
+    // 1. a[n] = x[n] * w[n], zero padded
+    for (size_t n = 0; n < size_; ++n) {
+        ar[n] = real[n] * chirp_r_[n] - imag[n] * chirp_i_[n];
+        ai[n] = real[n] * chirp_i_[n] + imag[n] * chirp_r_[n];
+    }
+    std::fill(ar + size_, ar + conv, 0.0f);
+    std::fill(ai + size_, ai + conv, 0.0f);
+
+    // 2. Circular convolution with the conjugate chirp
+    inner_->forward(ar, ai);
+    for (size_t k = 0; k < conv; ++k) {
+        float r = ar[k] * kernel_r_[k] - ai[k] * kernel_i_[k];
+        float i = ar[k] * kernel_i_[k] + ai[k] * kernel_r_[k];
+        ar[k] = r;
+        ai[k] = i;
+    }
+    inner_->inverse(ar, ai);
+
+    // 3. X[k] = w[k] * (a * b)[k]
+    for (size_t k = 0; k < size_; ++k) {
+        real[k] = ar[k] * chirp_r_[k] - ai[k] * chirp_i_[k];
+        imag[k] = ar[k] * chirp_i_[k] + ai[k] * chirp_r_[k];
+    }
+}
+
+void FFTPlan::run_mixed_pass(const MixedPass& pass, const float* in_r, const float* in_i,
+                             float* out_r, float* out_i) const {
+    const size_t radix = pass.radix;
+    const size_t stride = pass.stride;
+    const size_t span = size_ / radix;
+    const float* tw_r = twiddle_r_.data() + pass.twiddle_offset;
+    const float* tw_i = twiddle_i_.data() + pass.twiddle_offset;
+
+    // Sine constants of the hard-coded butterflies (forward direction)
+    const float s3 = 0.86602540378443864676f;  // sin(2*pi/3)
+    const float c5a = 0.30901699437494742410f; // cos(2*pi/5)
+    const float c5b = -0.80901699437494742410f; // cos(4*pi/5)
+    const float s5a = 0.95105651629515357212f; // sin(2*pi/5)
+    const float s5b = 0.58778525229247312917f; // sin(4*pi/5)
+
+    float vr[MAX_GENERIC_RADIX];
+    float vi[MAX_GENERIC_RADIX];
+
+    for (size_t j = 0; j < span; ++j) {
+        const size_t p = j % stride;
+
+        // 1. Gather and twiddle: v[r] = x[j + r*span] * W_{stride*radix}^(p*r)
+        vr[0] = in_r[j];
+        vi[0] = in_i[j];
+        const float* wr = tw_r + p * (radix - 1);
+        const float* wi = tw_i + p * (radix - 1);
+        for (size_t r = 1; r < radix; ++r) {
+            float xr = in_r[j + r * span];
+            float xi = in_i[j + r * span];
+            vr[r] = xr * wr[r - 1] - xi * wi[r - 1];
+            vi[r] = xr * wi[r - 1] + xi * wr[r - 1];
+        }
+
+        // 2. Radix-point DFT, results scattered with stride `stride`
+        const size_t dst = (j / stride) * stride * radix + p;
+        float* yr = out_r + dst;
+        float* yi = out_i + dst;
+
+        switch (radix) {
+            case 2: {
+                yr[0] = vr[0] + vr[1];      yi[0] = vi[0] + vi[1];
+                yr[stride] = vr[0] - vr[1]; yi[stride] = vi[0] - vi[1];
+                break;
+            }
+            case 3: {
+                float tr = vr[1] + vr[2], ti = vi[1] + vi[2];
+                float mr = vr[0] - 0.5f * tr, mi = vi[0] - 0.5f * ti;
+                // d = -i * s3 * (v1 - v2)
+                float dr = s3 * (vi[1] - vi[2]), di = -s3 * (vr[1] - vr[2]);
+                yr[0] = vr[0] + tr;          yi[0] = vi[0] + ti;
+                yr[stride] = mr + dr;        yi[stride] = mi + di;
+                yr[2 * stride] = mr - dr;    yi[2 * stride] = mi - di;
+                break;
+            }
+            case 4: {
+                float t0r = vr[0] + vr[2], t0i = vi[0] + vi[2];
+                float t1r = vr[0] - vr[2], t1i = vi[0] - vi[2];
+                float t2r = vr[1] + vr[3], t2i = vi[1] + vi[3];
+                // t3 = -i * (v1 - v3)
+                float t3r = vi[1] - vi[3], t3i = vr[3] - vr[1];
+                yr[0] = t0r + t2r;           yi[0] = t0i + t2i;
+                yr[stride] = t1r + t3r;      yi[stride] = t1i + t3i;
+                yr[2 * stride] = t0r - t2r;  yi[2 * stride] = t0i - t2i;
+                yr[3 * stride] = t1r - t3r;  yi[3 * stride] = t1i - t3i;
+                break;
+            }
+            case 5: {
+                float t1r = vr[1] + vr[4], t1i = vi[1] + vi[4];
+                float t2r = vr[2] + vr[3], t2i = vi[2] + vi[3];
+                float t3r = vr[1] - vr[4], t3i = vi[1] - vi[4];
+                float t4r = vr[2] - vr[3], t4i = vi[2] - vi[3];
+
+                float m1r = vr[0] + c5a * t1r + c5b * t2r, m1i = vi[0] + c5a * t1i + c5b * t2i;
+                float m2r = vr[0] + c5b * t1r + c5a * t2r, m2i = vi[0] + c5b * t1i + c5a * t2i;
+                // n1 = -i * (s5a*t3 + s5b*t4), n2 = -i * (s5b*t3 - s5a*t4)
+                float n1r = s5a * t3i + s5b * t4i, n1i = -(s5a * t3r + s5b * t4r);
+                float n2r = s5b * t3i - s5a * t4i, n2i = -(s5b * t3r - s5a * t4r);
+
+                yr[0] = vr[0] + t1r + t2r;   yi[0] = vi[0] + t1i + t2i;
+                yr[stride] = m1r + n1r;      yi[stride] = m1i + n1i;
+                yr[2 * stride] = m2r + n2r;  yi[2 * stride] = m2i + n2i;
+                yr[3 * stride] = m2r - n2r;  yi[3 * stride] = m2i - n2i;
+                yr[4 * stride] = m1r - n1r;  yi[4 * stride] = m1i - n1i;
+                break;
+            }
+            default: {
+                const float* rr = root_r_.data() + pass.root_offset;
+                const float* ri = root_i_.data() + pass.root_offset;
+                for (size_t k = 0; k < radix; ++k) {
+                    float accr = 0.0f, acci = 0.0f;
+                    size_t q = 0; // (k * r) mod radix
+                    for (size_t r = 0; r < radix; ++r) {
+                        accr += vr[r] * rr[q] - vi[r] * ri[q];
+                        acci += vr[r] * ri[q] + vi[r] * rr[q];
+                        q += k;
+                        if (q >= radix) q -= radix;
+                    }
+                    yr[k * stride] = accr;
+                    yi[k * stride] = acci;
+                }
+                break;
+            }
+        }
+    }
+}
+
+void FFTPlan::run_pass(const Pass& pass, float* real, float* imag, size_t begin, size_t end) const {
+    const size_t h = pass.half;
+
+    if (!pass.radix4) {
+        const float* wr = twiddle_r_.data() + h - 1;
+        const float* wi = twiddle_i_.data() + h - 1;
+        for (size_t base = begin; base < end; base += 2 * h) {
+            float* r0 = real + base;
+            float* i0 = imag + base;
+            float* r1 = r0 + h;
+            float* i1 = i0 + h;
+            for (size_t j = 0; j < h; ++j) {
+                float vr = r1[j] * wr[j] - i1[j] * wi[j];
+                float vi = r1[j] * wi[j] + i1[j] * wr[j];
+                r1[j] = r0[j] - vr;
+                i1[j] = i0[j] - vi;
+                r0[j] += vr;
+                i0[j] += vi;
+            }
+        }
+        return;
+    }
+
+    // Radix-4 pass = radix-2 stages `h` and `2h` fused. With W1 = W_{2h}^j, W2 = W_{4h}^j:
+    //   a0 = x0 + W1*x1, a1 = x0 - W1*x1, a2 = x2 + W1*x3, a3 = x2 - W1*x3
+    //   y0 = a0 + W2*a2, y2 = a0 - W2*a2, y1 = a1 - i*W2*a3, y3 = a1 + i*W2*a3
+    // (W_{4h}^{j+h} = -i * W_{4h}^j)
+    const float* w1r = twiddle_r_.data() + h - 1;
+    const float* w1i = twiddle_i_.data() + h - 1;
+    const float* w2r = twiddle_r_.data() + 2 * h - 1;
+    const float* w2i = twiddle_i_.data() + 2 * h - 1;
+
+    for (size_t base = begin; base < end; base += 4 * h) {
+        float* r0 = real + base;
+        float* i0 = imag + base;
+        float* r1 = r0 + h;
+        float* i1 = i0 + h;
+        float* r2 = r0 + 2 * h;
+        float* i2 = i0 + 2 * h;
+        float* r3 = r0 + 3 * h;
+        float* i3 = i0 + 3 * h;
+
+        size_t j = 0;
+#if defined(HAS_NEON)
+        for (; j + 3 < h; j += 4) {
+            float32x4_t ar = vld1q_f32(w1r + j), ai = vld1q_f32(w1i + j);
+            float32x4_t br = vld1q_f32(w2r + j), bi = vld1q_f32(w2i + j);
+            float32x4_t x0r = vld1q_f32(r0 + j), x0i = vld1q_f32(i0 + j);
+            float32x4_t x1r = vld1q_f32(r1 + j), x1i = vld1q_f32(i1 + j);
+            float32x4_t x2r = vld1q_f32(r2 + j), x2i = vld1q_f32(i2 + j);
+            float32x4_t x3r = vld1q_f32(r3 + j), x3i = vld1q_f32(i3 + j);
+
+            float32x4_t t1r = vmlsq_f32(vmulq_f32(x1r, ar), x1i, ai);
+            float32x4_t t1i = vmlaq_f32(vmulq_f32(x1r, ai), x1i, ar);
+            float32x4_t t3r = vmlsq_f32(vmulq_f32(x3r, ar), x3i, ai);
+            float32x4_t t3i = vmlaq_f32(vmulq_f32(x3r, ai), x3i, ar);
+
+            float32x4_t a0r = vaddq_f32(x0r, t1r), a0i = vaddq_f32(x0i, t1i);
+            float32x4_t a1r = vsubq_f32(x0r, t1r), a1i = vsubq_f32(x0i, t1i);
+            float32x4_t a2r = vaddq_f32(x2r, t3r), a2i = vaddq_f32(x2i, t3i);
+            float32x4_t a3r = vsubq_f32(x2r, t3r), a3i = vsubq_f32(x2i, t3i);
+
+            float32x4_t t2r = vmlsq_f32(vmulq_f32(a2r, br), a2i, bi);
+            float32x4_t t2i = vmlaq_f32(vmulq_f32(a2r, bi), a2i, br);
+            float32x4_t ur = vmlsq_f32(vmulq_f32(a3r, br), a3i, bi);
+            float32x4_t ui = vmlaq_f32(vmulq_f32(a3r, bi), a3i, br);
+
+            vst1q_f32(r0 + j, vaddq_f32(a0r, t2r)); vst1q_f32(i0 + j, vaddq_f32(a0i, t2i));
+            vst1q_f32(r2 + j, vsubq_f32(a0r, t2r)); vst1q_f32(i2 + j, vsubq_f32(a0i, t2i));
+            vst1q_f32(r1 + j, vaddq_f32(a1r, ui));  vst1q_f32(i1 + j, vsubq_f32(a1i, ur));
+            vst1q_f32(r3 + j, vsubq_f32(a1r, ui));  vst1q_f32(i3 + j, vaddq_f32(a1i, ur));
+        }
+#elif defined(HAS_AVX)
+        for (; j + 7 < h; j += 8) {
+            __m256 ar = _mm256_loadu_ps(w1r + j), ai = _mm256_loadu_ps(w1i + j);
+            __m256 br = _mm256_loadu_ps(w2r + j), bi = _mm256_loadu_ps(w2i + j);
+            __m256 x0r = _mm256_loadu_ps(r0 + j), x0i = _mm256_loadu_ps(i0 + j);
+            __m256 x1r = _mm256_loadu_ps(r1 + j), x1i = _mm256_loadu_ps(i1 + j);
+            __m256 x2r = _mm256_loadu_ps(r2 + j), x2i = _mm256_loadu_ps(i2 + j);
+            __m256 x3r = _mm256_loadu_ps(r3 + j), x3i = _mm256_loadu_ps(i3 + j);
+
+            __m256 t1r = _mm256_sub_ps(_mm256_mul_ps(x1r, ar), _mm256_mul_ps(x1i, ai));
+            __m256 t1i = _mm256_add_ps(_mm256_mul_ps(x1r, ai), _mm256_mul_ps(x1i, ar));
+            __m256 t3r = _mm256_sub_ps(_mm256_mul_ps(x3r, ar), _mm256_mul_ps(x3i, ai));
+            __m256 t3i = _mm256_add_ps(_mm256_mul_ps(x3r, ai), _mm256_mul_ps(x3i, ar));
+
+            __m256 a0r = _mm256_add_ps(x0r, t1r), a0i = _mm256_add_ps(x0i, t1i);
+            __m256 a1r = _mm256_sub_ps(x0r, t1r), a1i = _mm256_sub_ps(x0i, t1i);
+            __m256 a2r = _mm256_add_ps(x2r, t3r), a2i = _mm256_add_ps(x2i, t3i);
+            __m256 a3r = _mm256_sub_ps(x2r, t3r), a3i = _mm256_sub_ps(x2i, t3i);
+
+            __m256 t2r = _mm256_sub_ps(_mm256_mul_ps(a2r, br), _mm256_mul_ps(a2i, bi));
+            __m256 t2i = _mm256_add_ps(_mm256_mul_ps(a2r, bi), _mm256_mul_ps(a2i, br));
+            __m256 ur = _mm256_sub_ps(_mm256_mul_ps(a3r, br), _mm256_mul_ps(a3i, bi));
+            __m256 ui = _mm256_add_ps(_mm256_mul_ps(a3r, bi), _mm256_mul_ps(a3i, br));
+
+            _mm256_storeu_ps(r0 + j, _mm256_add_ps(a0r, t2r)); _mm256_storeu_ps(i0 + j, _mm256_add_ps(a0i, t2i));
+            _mm256_storeu_ps(r2 + j, _mm256_sub_ps(a0r, t2r)); _mm256_storeu_ps(i2 + j, _mm256_sub_ps(a0i, t2i));
+            _mm256_storeu_ps(r1 + j, _mm256_add_ps(a1r, ui));  _mm256_storeu_ps(i1 + j, _mm256_sub_ps(a1i, ur));
+            _mm256_storeu_ps(r3 + j, _mm256_sub_ps(a1r, ui));  _mm256_storeu_ps(i3 + j, _mm256_add_ps(a1i, ur));
+        }
+#endif
+        // Scalar fallback (tail handling, and small spans)
+        for (; j < h; ++j) {
+            float t1r = r1[j] * w1r[j] - i1[j] * w1i[j];
+            float t1i = r1[j] * w1i[j] + i1[j] * w1r[j];
+            float t3r = r3[j] * w1r[j] - i3[j] * w1i[j];
+            float t3i = r3[j] * w1i[j] + i3[j] * w1r[j];
+
+            float a0r = r0[j] + t1r, a0i = i0[j] + t1i;
+            float a1r = r0[j] - t1r, a1i = i0[j] - t1i;
+            float a2r = r2[j] + t3r, a2i = i2[j] + t3i;
+            float a3r = r2[j] - t3r, a3i = i2[j] - t3i;
+
+            float t2r = a2r * w2r[j] - a2i * w2i[j];
+            float t2i = a2r * w2i[j] + a2i * w2r[j];
+            float ur = a3r * w2r[j] - a3i * w2i[j];
+            float ui = a3r * w2i[j] + a3i * w2r[j];
+
+            r0[j] = a0r + t2r; i0[j] = a0i + t2i;
+            r2[j] = a0r - t2r; i2[j] = a0i - t2i;
+            r1[j] = a1r + ui;  i1[j] = a1i - ur;
+            r3[j] = a1r - ui;  i3[j] = a1i + ur;
+        }
+    }
+}
+
+RealFFTPlan::RealFFTPlan(size_t size) : size_(size), half_(size / 2) {
+    if (!is_valid()) return;
+
+    const size_t m = size_ / 2;
+    twiddle_r_.resize(m / 2 + 1);
+    twiddle_i_.resize(m / 2 + 1);
+    for (size_t k = 0; k <= m / 2; ++k) {
+        double angle = 2.0 * M_PI * static_cast<double>(k) / static_cast<double>(size_);
+        twiddle_r_[k] = static_cast<float>(std::cos(angle));
+        twiddle_i_[k] = static_cast<float>(-std::sin(angle));
+    }
+}
+
+RealFFTPlan::~RealFFTPlan() = default;
+
+bool RealFFTPlan::is_valid() const {
+    return size_ >= 2 && size_ % 2 == 0 && half_.is_valid();
+}
+
+size_t RealFFTPlan::size() const {
+    return size_;
+}
+
+size_t RealFFTPlan::bins() const {
+    return size_ / 2 + 1;
+}
+
+void RealFFTPlan::forward(const float* input, float* real, float* imag) const {
+    if (!is_valid()) return;
+    const size_t m = size_ / 2;
+
+    // 1. z[n] = x[2n] + i*x[2n+1] (front to back, so input may alias real)
+    for (size_t n = 0; n < m; ++n) {
+        float even = input[2 * n];
+        float odd = input[2 * n + 1];
+        real[n] = even;
+        imag[n] = odd;
+    }
+
+    // 2. Z = FFT_{N/2}(z)
+    half_.forward(real, imag);
+
+    // 3. Split: E[k] = (Z[k] + conj(Z[m-k])) / 2, O[k] = -i * (Z[k] - conj(Z[m-k])) / 2,
+    //    X[k] = E[k] + W^k O[k] and X[m-k] = conj(E[k] - W^k O[k]), with W = e^{-2*pi*i/N}
+    float z0r = real[0];
+    float z0i = imag[0];
+    real[0] = z0r + z0i;
+    imag[0] = 0.0f;
+    real[m] = z0r - z0i;
+    imag[m] = 0.0f;
+
+    for (size_t k = 1; k <= m / 2; ++k) {
+        size_t j = m - k;
+        float ar = real[k], ai = imag[k];
+        float br = real[j], bi = -imag[j]; // conj(Z[m-k])
+
+        float er = 0.5f * (ar + br), ei = 0.5f * (ai + bi);
+        float or_ = 0.5f * (ai - bi), oi = -0.5f * (ar - br);
+
+        float tr = twiddle_r_[k] * or_ - twiddle_i_[k] * oi;
+        float ti = twiddle_r_[k] * oi + twiddle_i_[k] * or_;
+
+        real[k] = er + tr;
+        imag[k] = ei + ti;
+        if (j != k) {
+            real[j] = er - tr;
+            imag[j] = -(ei - ti);
+        }
+    }
+}
+
+void RealFFTPlan::inverse(float* real, float* imag, float* output) const {
+    if (!is_valid()) return;
+    const size_t m = size_ / 2;
+
+    // 1. Undo the split: E = (X[k] + conj(X[m-k])) / 2, T = (X[k] - conj(X[m-k])) / 2,
+    //    O = T * conj(W^k), Z[k] = E + i*O and Z[m-k] = conj(E) + i*conj(O)
+    float x0 = real[0];
+    float xm = real[m];
+    real[0] = 0.5f * (x0 + xm);
+    imag[0] = 0.5f * (x0 - xm);
+
+    for (size_t k = 1; k <= m / 2; ++k) {
+        size_t j = m - k;
+        float ar = real[k], ai = imag[k];
+        float br = real[j], bi = -imag[j]; // conj(X[m-k])
+
+        float er = 0.5f * (ar + br), ei = 0.5f * (ai + bi);
+        float tr = 0.5f * (ar - br), ti = 0.5f * (ai - bi);
+
+        float or_ = tr * twiddle_r_[k] + ti * twiddle_i_[k];
+        float oi = ti * twiddle_r_[k] - tr * twiddle_i_[k];
+
+        real[k] = er - oi;
+        imag[k] = ei + or_;
+        if (j != k) {
+            real[j] = er + oi;
+            imag[j] = -ei + or_;
+        }
+    }
+
+    // 2. z = IFFT_{N/2}(Z); x[2n] = Re z[n], x[2n+1] = Im z[n]
+    half_.inverse(real, imag);
+
+    // 3. Interleave back to front, so output may alias real
+    for (size_t n = m; n-- > 0;) {
+        float even = real[n];
+        float odd = imag[n];
+        output[2 * n] = even;
+        output[2 * n + 1] = odd;
+    }
+}
+
+} // namespace signal
+} // namespace minni
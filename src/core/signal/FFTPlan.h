@@ -0,0 +1,172 @@
+#ifndef MINNI_CORE_SIGNAL_FFT_PLAN_H_
+#define MINNI_CORE_SIGNAL_FFT_PLAN_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace minni {
+namespace signal {
+
+/**
+ * Precomputed FFT for one transform size.
+ * Create once per size and reuse: construction picks an algorithm and computes
+ * all twiddle tables (in double precision, so accuracy does not degrade with size).
+ * Execution never allocates.
+ *
+ * - Power of 2: in-place radix-2/4 with a bit-reversal swap table; pairs of radix-2
+ *   stages are fused into radix-4 passes (NEON / AVX where available) and the small
+ *   stages run block by block so each block stays in L1.
+ * - Other sizes: mixed-radix Stockham passes (radix 2/3/4/5, generic odd radix for
+ *   other small primes) or Bluestein's chirp-z algorithm on a power-of-2 transform,
+ *   whichever a simple flop-cost model estimates to be cheaper. Prime sizes and
+ *   sizes with large prime factors end up on Bluestein.
+ *
+ * Data is split-complex (separate real and imaginary arrays), in place.
+ * Forward transform: X[k] = sum_n x[n] * e^{-2*pi*i*k*n/N} (unscaled).
+ * Inverse transform: scaled by 1/N, so inverse(forward(x)) == x.
+ *
+ * Non power-of-2 plans keep internal scratch buffers: do not execute the same plan
+ * from several threads at once (one plan per thread, as DSPKernel::fft does).
+ */
+class FFTPlan {
+public:
+    enum class Algorithm {
+        NONE,        // size 0
+        RADIX2,      // Power of 2
+        MIXED_RADIX, // Stockham over the factorization
+        BLUESTEIN    // Chirp-z via a power-of-2 convolution
+    };
+
+    /**
+     * @param size Number of points (any size >= 1).
+     */
+    explicit FFTPlan(size_t size);
+    ~FFTPlan();
+
+    FFTPlan(const FFTPlan&) = delete;
+    FFTPlan& operator=(const FFTPlan&) = delete;
+
+    /**
+     * False if the size is not supported (the plan is then a no-op).
+     */
+    bool is_valid() const;
+
+    size_t size() const;
+
+    Algorithm algorithm() const;
+
+    /**
+     * Radices of the mixed-radix passes, in execution order (empty otherwise).
+     */
+    std::vector<size_t> radices() const;
+
+    void forward(float* real, float* imag) const;
+    void inverse(float* real, float* imag) const;
+    void execute(float* real, float* imag, bool inverse) const;
+
+private:
+    struct Pass {
+        size_t half;   // Butterfly span of the first radix-2 stage in the pass
+        bool radix4;   // Fuses stages `half` and `2 * half`
+    };
+
+    struct MixedPass {
+        size_t radix;
+        size_t stride;         // Product of the radices of the previous passes (Ns)
+        size_t twiddle_offset; // stride * (radix - 1) entries: W^(p*r), p < stride, 1 <= r < radix
+        size_t root_offset;    // Generic radix only: radix roots of unity in root_r_/root_i_
+    };
+
+    size_t size_;
+    Algorithm algorithm_;
+
+    // Power of 2
+    std::vector<uint32_t> swaps_;        // Bit-reversal pairs (i, rev(i)) with i < rev(i)
+    std::vector<float> twiddle_r_;       // Stage `half`: cos(pi*j/half) at [half - 1 + j], j < half
+    std::vector<float> twiddle_i_;       // Stage `half`: -sin(pi*j/half)
+    std::vector<Pass> block_passes_;     // Run per L1-sized block
+    std::vector<Pass> global_passes_;    // Run over the whole array
+    size_t block_size_;
+
+    // Mixed radix (twiddle_r_/twiddle_i_ hold the per-pass tables)
+    std::vector<MixedPass> mixed_passes_;
+    std::vector<float> root_r_;          // Generic radices: e^{-2*pi*i*q/radix}, q < radix
+    std::vector<float> root_i_;
+
+    // Bluestein
+    std::unique_ptr<FFTPlan> inner_;     // Power-of-2 plan of the convolution length
+    std::vector<float> chirp_r_;         // e^{-i*pi*n^2/N}, n < N
+    std::vector<float> chirp_i_;
+    std::vector<float> kernel_r_;        // FFT of the conjugate chirp, wrapped to the convolution length
+    std::vector<float> kernel_i_;
+
+    mutable std::vector<float> scratch_r_;
+    mutable std::vector<float> scratch_i_;
+
+    void init_radix2();
+    void init_mixed(const std::vector<size_t>& radices);
+    void init_bluestein();
+
+    void run_pass(const Pass& pass, float* real, float* imag, size_t begin, size_t end) const;
+    void run_mixed_pass(const MixedPass& pass, const float* in_r, const float* in_i,
+                        float* out_r, float* out_i) const;
+    void execute_radix2(float* real, float* imag) const;
+    void execute_mixed(float* real, float* imag) const;
+    void execute_bluestein(float* real, float* imag) const;
+};
+
+/**
+ * Real-input FFT of N points (N even).
+ * Packs the N real samples into an N/2-point complex transform (even samples as
+ * real, odd samples as imaginary) and separates the two halves with a post-twiddle,
+ * so it costs roughly half of a complex FFT of the same size.
+ * The spectrum is returned as N/2 + 1 bins (DC .. Nyquist); the remaining bins
+ * follow from conjugate symmetry.
+ */
+class RealFFTPlan {
+public:
+    explicit RealFFTPlan(size_t size);
+    ~RealFFTPlan();
+
+    bool is_valid() const;
+
+    /**
+     * Number of real samples (N).
+     */
+    size_t size() const;
+
+    /**
+     * Number of spectrum bins (N/2 + 1).
+     */
+    size_t bins() const;
+
+    /**
+     * Forward transform (unscaled).
+     * @param input N real samples. May alias `real` (processed in place).
+     * @param real Receives bins() real parts.
+     * @param imag Receives bins() imaginary parts.
+     */
+    void forward(const float* input, float* real, float* imag) const;
+
+    /**
+     * Inverse transform, scaled by 1/N so inverse(forward(x)) == x.
+     * The spectrum arrays are used as workspace and are overwritten.
+     * @param real bins() real parts.
+     * @param imag bins() imaginary parts.
+     * @param output Receives N samples. May alias `real`.
+     */
+    void inverse(float* real, float* imag, float* output) const;
+
+private:
+    size_t size_;
+    FFTPlan half_;
+    std::vector<float> twiddle_r_; // cos(2*pi*k/N), k <= N/4
+    std::vector<float> twiddle_i_; // -sin(2*pi*k/N)
+};
+
+} // namespace signal
+} // namespace minni
+
+#endif // MINNI_CORE_SIGNAL_FFT_PLAN_H_
@@ -0,0 +1,92 @@
+#include "FirFilter.h"
+#include "DSPKernel.h"
+#include <algorithm>
+#include <cstring>
+
+namespace minni {
+namespace signal {
+
+FirFilter::FirFilter(const float* taps, size_t taps_size, size_t channels, size_t max_block)
+    : taps_(taps, taps + taps_size),
+      channels_(std::max<size_t>(1, channels)),
+      max_block_(std::max<size_t>(1, max_block)) {
+    if (taps_.empty()) {
+        taps_.push_back(0.0f);
+    }
+    stride_ = taps_.size() - 1 + max_block_;
+    buffer_.assign(channels_ * stride_, 0.0f);
+    scratch_.assign(max_block_, 0.0f);
+}
+
+FirFilter::~FirFilter() = default;
+
+size_t FirFilter::taps_size() const {
+    return taps_.size();
+}
+
+size_t FirFilter::channels() const {
+    return channels_;
+}
+
+void FirFilter::reset() {
+    std::fill(buffer_.begin(), buffer_.end(), 0.0f);
+}
+
+void FirFilter::run_channel(size_t c, size_t frames, float* output) {
+    const size_t history = taps_.size() - 1;
+    float* buf = buffer_.data() + c * stride_;
+
+    DSPKernel::fir_filter_history(buf + history, frames, taps_.data(), taps_.size(), output);
+
+    // Keep the newest taps - 1 samples as history for the next block
+    if (history > 0) {
+        std::memmove(buf, buf + frames, history * sizeof(float));
+    }
+}
+
+void FirFilter::process(const float* input, float* output, size_t frames) {
+    const size_t history = taps_.size() - 1;
+    const size_t ch = channels_;
+
+    for (size_t begin = 0; begin < frames; begin += max_block_) {
+        const size_t n = std::min(max_block_, frames - begin);
+        const float* in = input + begin * ch;
+        float* out = output + begin * ch;
+
+        if (ch == 1) {
+            std::memcpy(buffer_.data() + history, in, n * sizeof(float));
+            run_channel(0, n, out);
+            continue;
+        }
+
+        // De-interleave every channel first so that output may alias input
+        for (size_t c = 0; c < ch; ++c) {
+            float* dst = buffer_.data() + c * stride_ + history;
+            for (size_t i = 0; i < n; ++i) {
+                dst[i] = in[i * ch + c];
+            }
+        }
+        for (size_t c = 0; c < ch; ++c) {
+            run_channel(c, n, scratch_.data());
+            for (size_t i = 0; i < n; ++i) {
+                out[i * ch + c] = scratch_[i];
+            }
+        }
+    }
+}
+
+void FirFilter::process_planar(const float* const* input, float* const* output, size_t frames) {
+    const size_t history = taps_.size() - 1;
+
+    for (size_t c = 0; c < channels_; ++c) {
+        float* dst = buffer_.data() + c * stride_ + history;
+        for (size_t begin = 0; begin < frames; begin += max_block_) {
+            const size_t n = std::min(max_block_, frames - begin);
+            std::memcpy(dst, input[c] + begin, n * sizeof(float));
+            run_channel(c, n, output[c] + begin);
+        }
+    }
+}
+
+} // namespace signal
+} // namespace minni
@@ -0,0 +1,68 @@
+#ifndef MINNI_CORE_SIGNAL_FIR_FILTER_H_
+#define MINNI_CORE_SIGNAL_FIR_FILTER_H_
+
+#include <cstddef>
+#include <vector>
+
+namespace minni {
+namespace signal {
+
+/**
+ * Streaming multi-channel FIR filter.
+ * Unlike DSPKernel::fir_filter (which treats every call as a fresh signal with zero
+ * history), the last taps_size - 1 input samples of each channel are kept between
+ * process() calls, so splitting a signal into blocks of any length gives exactly the
+ * same output as filtering it in one go.
+ *
+ * Each channel owns a contiguous [history | block] buffer that is filtered with the
+ * SIMD kernel of DSPKernel::fir_filter_history. Everything is allocated in the
+ * constructor; process() never allocates, so it is safe on a real-time thread.
+ * Long inputs are processed in chunks of at most max_block frames.
+ */
+class FirFilter {
+public:
+    /**
+     * @param taps Filter coefficients (copied).
+     * @param taps_size Number of coefficients (>= 1).
+     * @param channels Number of channels (>= 1).
+     * @param max_block Internal chunk length in frames.
+     */
+    FirFilter(const float* taps, size_t taps_size, size_t channels = 1, size_t max_block = 256);
+    ~FirFilter();
+
+    size_t taps_size() const;
+    size_t channels() const;
+
+    /**
+     * Clear the delay lines (as if all previous input were zero).
+     */
+    void reset();
+
+    /**
+     * Filter interleaved frames (input[frame * channels + channel]).
+     * input and output may alias.
+     */
+    void process(const float* input, float* output, size_t frames);
+
+    /**
+     * Filter planar frames (input[channel][frame]).
+     * input[c] and output[c] may alias.
+     */
+    void process_planar(const float* const* input, float* const* output, size_t frames);
+
+private:
+    std::vector<float> taps_;
+    size_t channels_;
+    size_t max_block_;
+    size_t stride_;                  // Per-channel buffer length: taps - 1 + max_block
+    std::vector<float> buffer_;      // channels x [history | block]
+    std::vector<float> scratch_;     // One block of output (interleaved path)
+
+    // Filter `frames` samples already copied behind the history of channel c
+    void run_channel(size_t c, size_t frames, float* output);
+};
+
+} // namespace signal
+} // namespace minni
+
+#endif // MINNI_CORE_SIGNAL_FIR_FILTER_H_
@@ -0,0 +1,196 @@
+#include "IirFilter.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+// Check for NEON support
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define HAS_NEON
+#elif defined(__AVX__)
+    #include <immintrin.h>
+#endif
+
+namespace minni {
+namespace signal {
+
+IirFilter::IirFilter(const Biquad* sections, size_t num_sections, size_t channels)
+    : sections_(sections, sections + num_sections),
+      channels_(std::max<size_t>(1, channels)) {
+    state_.assign(2 * sections_.size() * channels_, 0.0f);
+}
+
+IirFilter::~IirFilter() = default;
+
+size_t IirFilter::num_sections() const {
+    return sections_.size();
+}
+
+size_t IirFilter::channels() const {
+    return channels_;
+}
+
+void IirFilter::reset() {
+    std::fill(state_.begin(), state_.end(), 0.0f);
+}
+
+void IirFilter::run_planar(size_t c, float* data, size_t frames) {
+    const size_t ch = channels_;
+    for (size_t s = 0; s < sections_.size(); ++s) {
+        const Biquad& q = sections_[s];
+        float* z = state_.data() + 2 * s * ch + c;
+        float z1 = z[0];
+        float z2 = z[ch];
+        for (size_t i = 0; i < frames; ++i) {
+            const float x = data[i];
+            const float y = q.b0 * x + z1;
+            z1 = q.b1 * x - q.a1 * y + z2;
+            z2 = q.b2 * x - q.a2 * y;
+            data[i] = y;
+        }
+        z[0] = z1;
+        z[ch] = z2;
+    }
+}
+
+void IirFilter::process(const float* input, float* output, size_t frames) {
+    const size_t ch = channels_;
+    if (input != output) {
+        std::memcpy(output, input, frames * ch * sizeof(float));
+    }
+    if (ch == 1) {
+        run_planar(0, output, frames);
+        return;
+    }
+
+    // A biquad is a serial recursion in time, so vectorize across channels:
+    // every frame runs all sections on a vector of channels.
+    for (size_t f = 0; f < frames; ++f) {
+        float* w = output + f * ch;
+        for (size_t s = 0; s < sections_.size(); ++s) {
+            const Biquad& q = sections_[s];
+            float* z1 = state_.data() + 2 * s * ch;
+            float* z2 = z1 + ch;
+            size_t c = 0;
+#ifdef HAS_NEON
+            const float32x4_t b0 = vdupq_n_f32(q.b0);
+            const float32x4_t b1 = vdupq_n_f32(q.b1);
+            const float32x4_t b2 = vdupq_n_f32(q.b2);
+            const float32x4_t a1 = vdupq_n_f32(q.a1);
+            const float32x4_t a2 = vdupq_n_f32(q.a2);
+            for (; c + 3 < ch; c += 4) {
+                float32x4_t x = vld1q_f32(w + c);
+                float32x4_t y = vmlaq_f32(vld1q_f32(z1 + c), b0, x);
+                float32x4_t n1 = vmlsq_f32(vmlaq_f32(vld1q_f32(z2 + c), b1, x), a1, y);
+                float32x4_t n2 = vmlsq_f32(vmulq_f32(b2, x), a2, y);
+                vst1q_f32(z1 + c, n1);
+                vst1q_f32(z2 + c, n2);
+                vst1q_f32(w + c, y);
+            }
+#elif defined(__AVX__)
+            const __m256 b0 = _mm256_set1_ps(q.b0);
+            const __m256 b1 = _mm256_set1_ps(q.b1);
+            const __m256 b2 = _mm256_set1_ps(q.b2);
+            const __m256 a1 = _mm256_set1_ps(q.a1);
+            const __m256 a2 = _mm256_set1_ps(q.a2);
+            for (; c + 7 < ch; c += 8) {
+                __m256 x = _mm256_loadu_ps(w + c);
+                __m256 y = _mm256_add_ps(_mm256_mul_ps(b0, x), _mm256_loadu_ps(z1 + c));
+                __m256 n1 = _mm256_sub_ps(_mm256_add_ps(_mm256_mul_ps(b1, x), _mm256_loadu_ps(z2 + c)),
+                                          _mm256_mul_ps(a1, y));
+                __m256 n2 = _mm256_sub_ps(_mm256_mul_ps(b2, x), _mm256_mul_ps(a2, y));
+                _mm256_storeu_ps(z1 + c, n1);
+                _mm256_storeu_ps(z2 + c, n2);
+                _mm256_storeu_ps(w + c, y);
+            }
+#endif
+            for (; c < ch; ++c) {
+                const float x = w[c];
+                const float y = q.b0 * x + z1[c];
+                z1[c] = q.b1 * x - q.a1 * y + z2[c];
+                z2[c] = q.b2 * x - q.a2 * y;
+                w[c] = y;
+            }
+        }
+    }
+}
+
+void IirFilter::process_planar(const float* const* input, float* const* output, size_t frames) {
+    for (size_t c = 0; c < channels_; ++c) {
+        if (input[c] != output[c]) {
+            std::memcpy(output[c], input[c], frames * sizeof(float));
+        }
+        run_planar(c, output[c], frames);
+    }
+}
+
+IirFilter::Biquad IirFilter::lowpass(float sample_rate, float cutoff, float q) {
+    const double w0 = 2.0 * M_PI * cutoff / sample_rate;
+    const double cw = std::cos(w0);
+    const double alpha = std::sin(w0) / (2.0 * q);
+    const double a0 = 1.0 + alpha;
+    Biquad bq;
+    bq.b0 = static_cast<float>((1.0 - cw) / 2.0 / a0);
+    bq.b1 = static_cast<float>((1.0 - cw) / a0);
+    bq.b2 = bq.b0;
+    bq.a1 = static_cast<float>(-2.0 * cw / a0);
+    bq.a2 = static_cast<float>((1.0 - alpha) / a0);
+    return bq;
+}
+
+IirFilter::Biquad IirFilter::highpass(float sample_rate, float cutoff, float q) {
+    const double w0 = 2.0 * M_PI * cutoff / sample_rate;
+    const double cw = std::cos(w0);
+    const double alpha = std::sin(w0) / (2.0 * q);
+    const double a0 = 1.0 + alpha;
+    Biquad bq;
+    bq.b0 = static_cast<float>((1.0 + cw) / 2.0 / a0);
+    bq.b1 = static_cast<float>(-(1.0 + cw) / a0);
+    bq.b2 = bq.b0;
+    bq.a1 = static_cast<float>(-2.0 * cw / a0);
+    bq.a2 = static_cast<float>((1.0 - alpha) / a0);
+    return bq;
+}
+
+IirFilter::Biquad IirFilter::bandpass(float sample_rate, float center, float q) {
+    // Constant 0 dB peak gain
+    const double w0 = 2.0 * M_PI * center / sample_rate;
+    const double cw = std::cos(w0);
+    const double alpha = std::sin(w0) / (2.0 * q);
+    const double a0 = 1.0 + alpha;
+    Biquad bq;
+    bq.b0 = static_cast<float>(alpha / a0);
+    bq.b1 = 0.0f;
+    bq.b2 = static_cast<float>(-alpha / a0);
+    bq.a1 = static_cast<float>(-2.0 * cw / a0);
+    bq.a2 = static_cast<float>((1.0 - alpha) / a0);
+    return bq;
+}
+
+std::vector<IirFilter::Biquad> IirFilter::butterworth_lowpass(size_t order, float sample_rate, float cutoff) {
+    std::vector<Biquad> sections;
+    // Conjugate pole pairs: Q_k = 1 / (2 cos((2k + 1) * pi / (2 * order)))
+    for (size_t k = 0; k < order / 2; ++k) {
+        double theta = (2.0 * k + 1.0) * M_PI / (2.0 * order);
+        sections.push_back(lowpass(sample_rate, cutoff, static_cast<float>(1.0 / (2.0 * std::cos(theta)))));
+    }
+    if (order % 2 == 1) {
+        // Real pole: bilinear first-order low-pass
+        const double k = std::tan(M_PI * cutoff / sample_rate);
+        Biquad bq;
+        bq.b0 = static_cast<float>(k / (1.0 + k));
+        bq.b1 = bq.b0;
+        bq.b2 = 0.0f;
+        bq.a1 = static_cast<float>((k - 1.0) / (k + 1.0));
+        bq.a2 = 0.0f;
+        sections.push_back(bq);
+    }
+    return sections;
+}
+
+} // namespace signal
+} // namespace minni
@@ -0,0 +1,80 @@
+#ifndef MINNI_CORE_SIGNAL_IIR_FILTER_H_
+#define MINNI_CORE_SIGNAL_IIR_FILTER_H_
+
+#include <cstddef>
+#include <vector>
+
+namespace minni {
+namespace signal {
+
+/**
+ * Streaming multi-channel IIR filter: a cascade of biquad sections in transposed
+ * direct form II. The two state variables of every section and channel persist
+ * between process() calls, so block-by-block processing is seamless.
+ *
+ * Interleaved input is filtered frame by frame with SIMD across channels (NEON /
+ * AVX where available); planar input is filtered section by section along each
+ * channel with the state kept in registers. No allocations after construction.
+ */
+class IirFilter {
+public:
+    /**
+     * One second-order section, normalized so that a0 == 1:
+     * y[n] = b0*x[n] + b1*x[n-1] + b2*x[n-2] - a1*y[n-1] - a2*y[n-2]
+     */
+    struct Biquad {
+        float b0, b1, b2;
+        float a1, a2;
+    };
+
+    /**
+     * @param sections Biquad sections, applied in order (copied).
+     * @param num_sections Number of sections.
+     * @param channels Number of channels (>= 1).
+     */
+    IirFilter(const Biquad* sections, size_t num_sections, size_t channels = 1);
+    ~IirFilter();
+
+    size_t num_sections() const;
+    size_t channels() const;
+
+    /**
+     * Clear the state of every section (as if all previous input were zero).
+     */
+    void reset();
+
+    /**
+     * Filter interleaved frames (input[frame * channels + channel]).
+     * input and output may alias.
+     */
+    void process(const float* input, float* output, size_t frames);
+
+    /**
+     * Filter planar frames (input[channel][frame]).
+     * input[c] and output[c] may alias.
+     */
+    void process_planar(const float* const* input, float* const* output, size_t frames);
+
+    // RBJ audio-EQ-cookbook designs (cutoff / center in Hz)
+    static Biquad lowpass(float sample_rate, float cutoff, float q = 0.70710678f);
+    static Biquad highpass(float sample_rate, float cutoff, float q = 0.70710678f);
+    static Biquad bandpass(float sample_rate, float center, float q);
+
+    /**
+     * Butterworth low-pass of the given order as (order + 1) / 2 sections
+     * (the last one first-order when the order is odd).
+     */
+    static std::vector<Biquad> butterworth_lowpass(size_t order, float sample_rate, float cutoff);
+
+private:
+    std::vector<Biquad> sections_;
+    size_t channels_;
+    std::vector<float> state_;   // (section, z1|z2, channel): [(2 * s + k) * channels + c]
+
+    void run_planar(size_t c, float* data, size_t frames);
+};
+
+} // namespace signal
+} // namespace minni
+
+#endif // MINNI_CORE_SIGNAL_IIR_FILTER_H_
@@ -0,0 +1,183 @@
+#include "KalmanFilterBank.h"
+#include <algorithm>
+#include <cmath>
+
+// Check for NEON support
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define HAS_NEON
+#elif defined(__AVX__)
+    #include <immintrin.h>
+#endif
+
+namespace minni {
+namespace signal {
+
+namespace {
+
+/**
+ * KalmanFilter::update on n lanes:
+ *   g = e / (e + m); x' = x + g (z - x); e' = (1 - g) e + |x - x'| q
+ */
+void update_lanes(const float* z, const float* m, float* e, const float* q,
+                  float* x, float* g, size_t n) {
+    size_t i = 0;
+#if defined(HAS_NEON) && defined(__aarch64__)
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    for (; i + 3 < n; i += 4) {
+        float32x4_t ev = vld1q_f32(e + i);
+        float32x4_t xv = vld1q_f32(x + i);
+        float32x4_t gv = vdivq_f32(ev, vaddq_f32(ev, vld1q_f32(m + i)));
+        float32x4_t xn = vmlaq_f32(xv, gv, vsubq_f32(vld1q_f32(z + i), xv));
+        float32x4_t en = vmlaq_f32(vmulq_f32(vsubq_f32(one, gv), ev),
+                                   vabsq_f32(vsubq_f32(xv, xn)), vld1q_f32(q + i));
+        vst1q_f32(g + i, gv);
+        vst1q_f32(x + i, xn);
+        vst1q_f32(e + i, en);
+    }
+#elif defined(__AVX__)
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    for (; i + 7 < n; i += 8) {
+        __m256 ev = _mm256_loadu_ps(e + i);
+        __m256 xv = _mm256_loadu_ps(x + i);
+        __m256 gv = _mm256_div_ps(ev, _mm256_add_ps(ev, _mm256_loadu_ps(m + i)));
+        __m256 xn = _mm256_add_ps(xv, _mm256_mul_ps(gv, _mm256_sub_ps(_mm256_loadu_ps(z + i), xv)));
+        __m256 diff = _mm256_andnot_ps(sign, _mm256_sub_ps(xv, xn));
+        __m256 en = _mm256_add_ps(_mm256_mul_ps(_mm256_sub_ps(one, gv), ev),
+                                  _mm256_mul_ps(diff, _mm256_loadu_ps(q + i)));
+        _mm256_storeu_ps(g + i, gv);
+        _mm256_storeu_ps(x + i, xn);
+        _mm256_storeu_ps(e + i, en);
+    }
+#endif
+    for (; i < n; ++i) {
+        const float gain = e[i] / (e[i] + m[i]);
+        const float next = x[i] + gain * (z[i] - x[i]);
+        e[i] = (1.0f - gain) * e[i] + std::abs(x[i] - next) * q[i];
+        x[i] = next;
+        g[i] = gain;
+    }
+}
+
+} // namespace
+
+KalmanFilterBank::KalmanFilterBank(size_t tracks, float measurement_uncertainty,
+                                   float estimation_uncertainty, float process_noise)
+    : err_measure_(tracks, measurement_uncertainty),
+      err_estimate_(tracks, estimation_uncertainty),
+      q_(tracks, process_noise),
+      estimate_(tracks, 0.0f),
+      gain_(tracks, 0.0f),
+      stamp_(tracks, 0),
+      generation_(1),
+      lane_z_(kLanes), lane_m_(kLanes), lane_e_(kLanes), lane_q_(kLanes),
+      lane_x_(kLanes), lane_g_(kLanes), lane_track_(kLanes), lane_pos_(kLanes) {
+}
+
+KalmanFilterBank::~KalmanFilterBank() = default;
+
+size_t KalmanFilterBank::size() const {
+    return estimate_.size();
+}
+
+void KalmanFilterBank::set_params(size_t track, float measurement_uncertainty,
+                                  float estimation_uncertainty, float process_noise) {
+    if (track >= size()) return;
+    err_measure_[track] = measurement_uncertainty;
+    err_estimate_[track] = estimation_uncertainty;
+    q_[track] = process_noise;
+}
+
+void KalmanFilterBank::reset(size_t track, float initial_value) {
+    if (track >= size()) return;
+    estimate_[track] = initial_value;
+}
+
+void KalmanFilterBank::reset_all(float initial_value) {
+    std::fill(estimate_.begin(), estimate_.end(), initial_value);
+}
+
+void KalmanFilterBank::update_all(const float* measurements, float* estimates) {
+    // Dense: the SoA arrays are the lanes
+    update_lanes(measurements, err_measure_.data(), err_estimate_.data(), q_.data(),
+                 estimate_.data(), gain_.data(), size());
+    if (estimates) {
+        std::copy(estimate_.begin(), estimate_.end(), estimates);
+    }
+}
+
+void KalmanFilterBank::next_generation() {
+    if (++generation_ == 0) {
+        // Wrapped: clear stamps so no track looks "already gathered"
+        std::fill(stamp_.begin(), stamp_.end(), 0);
+        generation_ = 1;
+    }
+}
+
+void KalmanFilterBank::flush(size_t lanes, float* estimates) {
+    if (lanes == 0) return;
+    update_lanes(lane_z_.data(), lane_m_.data(), lane_e_.data(), lane_q_.data(),
+                 lane_x_.data(), lane_g_.data(), lanes);
+    for (size_t l = 0; l < lanes; ++l) {
+        const size_t t = static_cast<size_t>(lane_track_[l]);
+        err_estimate_[t] = lane_e_[l];
+        estimate_[t] = lane_x_[l];
+        gain_[t] = lane_g_[l];
+        if (estimates) {
+            estimates[lane_pos_[l]] = lane_x_[l];
+        }
+    }
+    next_generation();
+}
+
+size_t KalmanFilterBank::update(const int32_t* tracks, const float* measurements, size_t count,
+                                float* estimates) {
+    const size_t n = size();
+    size_t lanes = 0;
+    size_t applied = 0;
+
+    for (size_t i = 0; i < count; ++i) {
+        const int32_t track = tracks[i];
+        if (track < 0 || static_cast<size_t>(track) >= n) continue;
+        const size_t t = static_cast<size_t>(track);
+
+        // A repeated track must see the result of its earlier update
+        if (stamp_[t] == generation_ || lanes == kLanes) {
+            flush(lanes, estimates);
+            lanes = 0;
+        }
+        stamp_[t] = generation_;
+
+        lane_z_[lanes] = measurements[i];
+        lane_m_[lanes] = err_measure_[t];
+        lane_e_[lanes] = err_estimate_[t];
+        lane_q_[lanes] = q_[t];
+        lane_x_[lanes] = estimate_[t];
+        lane_track_[lanes] = track;
+        lane_pos_[lanes] = i;
+        ++lanes;
+        ++applied;
+    }
+    flush(lanes, estimates);
+    return applied;
+}
+
+float KalmanFilterBank::get_estimate(size_t track) const {
+    return track < size() ? estimate_[track] : 0.0f;
+}
+
+float KalmanFilterBank::get_error_estimate(size_t track) const {
+    return track < size() ? err_estimate_[track] : 0.0f;
+}
+
+float KalmanFilterBank::get_gain(size_t track) const {
+    return track < size() ? gain_[track] : 0.0f;
+}
+
+const float* KalmanFilterBank::estimates() const {
+    return estimate_.data();
+}
+
+} // namespace signal
+} // namespace minni
@@ -0,0 +1,106 @@
+#ifndef MINNI_CORE_SIGNAL_KALMAN_FILTER_BANK_H_
+#define MINNI_CORE_SIGNAL_KALMAN_FILTER_BANK_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace minni {
+namespace signal {
+
+/**
+ * Many independent 1D Kalman filters (same update rule as KalmanFilter), stored
+ * structure-of-arrays: gains, estimates and uncertainties of all tracks live in
+ * contiguous float arrays, and one call updates any number of tracks with SIMD
+ * (NEON on ARMv8, AVX on x86).
+ *
+ * Indexed updates gather the addressed tracks into lane buffers, run the vector
+ * update and scatter the results back. A track that appears several times in one
+ * call is updated in order, exactly as with repeated KalmanFilter::update().
+ * No allocations after construction.
+ */
+class KalmanFilterBank {
+public:
+    /**
+     * @param tracks Number of filters.
+     * @param measurement_uncertainty Initial parameters of every track (see KalmanFilter).
+     * @param estimation_uncertainty
+     * @param process_noise
+     */
+    KalmanFilterBank(size_t tracks, float measurement_uncertainty,
+                     float estimation_uncertainty, float process_noise);
+    ~KalmanFilterBank();
+
+    size_t size() const;
+
+    /**
+     * Per-track parameters (e.g. a noisier beacon). Out-of-range tracks are ignored.
+     */
+    void set_params(size_t track, float measurement_uncertainty,
+                    float estimation_uncertainty, float process_noise);
+
+    /**
+     * Reset one track's estimate (uncertainties are kept, as KalmanFilter::reset).
+     */
+    void reset(size_t track, float initial_value = 0.0f);
+    void reset_all(float initial_value = 0.0f);
+
+    /**
+     * Update every track: measurements[t] is the new reading of track t.
+     * @param estimates Optional: receives size() filtered estimates.
+     */
+    void update_all(const float* measurements, float* estimates = nullptr);
+
+    /**
+     * Update the tracks listed in `tracks` with the matching measurements.
+     * @param tracks Track indices (entries outside [0, size()) are skipped).
+     * @param measurements count readings.
+     * @param count Number of (track, measurement) pairs.
+     * @param estimates Optional: receives count filtered estimates, in input order
+     *                  (skipped entries are left untouched).
+     * @return Number of pairs applied.
+     */
+    size_t update(const int32_t* tracks, const float* measurements, size_t count,
+                  float* estimates = nullptr);
+
+    float get_estimate(size_t track) const;
+    float get_error_estimate(size_t track) const;
+    float get_gain(size_t track) const;
+
+    /**
+     * All estimates (size() values).
+     */
+    const float* estimates() const;
+
+private:
+    static const size_t kLanes = 256;  // Gather/scatter chunk
+
+    std::vector<float> err_measure_;
+    std::vector<float> err_estimate_;
+    std::vector<float> q_;
+    std::vector<float> estimate_;
+    std::vector<float> gain_;
+
+    // Duplicate detection for indexed updates: stamp_[t] == generation_ if track t
+    // is already in the current chunk
+    std::vector<uint32_t> stamp_;
+    uint32_t generation_;
+
+    // Lane buffers for gathered tracks
+    std::vector<float> lane_z_;
+    std::vector<float> lane_m_;
+    std::vector<float> lane_e_;
+    std::vector<float> lane_q_;
+    std::vector<float> lane_x_;
+    std::vector<float> lane_g_;
+    std::vector<int32_t> lane_track_;
+    std::vector<size_t> lane_pos_;
+
+    void flush(size_t lanes, float* estimates);
+    void next_generation();
+};
+
+} // namespace signal
+} // namespace minni
+
+#endif // MINNI_CORE_SIGNAL_KALMAN_FILTER_BANK_H_
@@ -0,0 +1,250 @@
+#include "MelSpectrogram.h"
+#include "DSPKernel.h"
+#include "FFTPlan.h"
+#include "VectorMath.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+namespace minni {
+namespace signal {
+
+namespace {
+
+// Slaney mel scale (librosa default): linear below 1 kHz, logarithmic above
+double hz_to_mel(double hz) {
+    const double f_sp = 200.0 / 3.0;
+    const double min_log_hz = 1000.0;
+    const double min_log_mel = min_log_hz / f_sp;
+    const double logstep = std::log(6.4) / 27.0;
+    if (hz >= min_log_hz) {
+        return min_log_mel + std::log(hz / min_log_hz) / logstep;
+    }
+    return hz / f_sp;
+}
+
+double mel_to_hz(double mel) {
+    const double f_sp = 200.0 / 3.0;
+    const double min_log_hz = 1000.0;
+    const double min_log_mel = min_log_hz / f_sp;
+    const double logstep = std::log(6.4) / 27.0;
+    if (mel >= min_log_mel) {
+        return min_log_hz * std::exp(logstep * (mel - min_log_mel));
+    }
+    return f_sp * mel;
+}
+
+// Reflect an index into [0, size) (numpy "reflect": edge sample not repeated)
+size_t reflect_index(long long i, size_t size) {
+    const long long n = static_cast<long long>(size);
+    if (n == 1) return 0;
+    const long long period = 2 * (n - 1);
+    i %= period;
+    if (i < 0) i += period;
+    return static_cast<size_t>(i < n ? i : period - i);
+}
+
+} // namespace
+
+MelSpectrogram::MelSpectrogram() : MelSpectrogram(Config()) {}
+
+MelSpectrogram::MelSpectrogram(const Config& config)
+    : config_(config),
+      stream_fill_(0) {
+    config_.n_fft = std::max<size_t>(2, config_.n_fft & ~static_cast<size_t>(1));
+    config_.hop_length = std::min(std::max<size_t>(1, config_.hop_length), config_.n_fft);
+    if (config_.f_max <= 0.0f) {
+        config_.f_max = config_.sample_rate / 2.0f;
+    }
+
+    const size_t n = config_.n_fft;
+    bins_ = n / 2 + 1;
+    plan_.reset(new RealFFTPlan(n));
+
+    window_.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        double phase = 2.0 * M_PI * i / n;
+        switch (config_.window) {
+            case Window::HANN:        window_[i] = static_cast<float>(0.5 - 0.5 * std::cos(phase)); break;
+            case Window::HAMMING:     window_[i] = static_cast<float>(0.54 - 0.46 * std::cos(phase)); break;
+            case Window::RECTANGULAR: window_[i] = 1.0f; break;
+        }
+    }
+
+    frame_.assign(n, 0.0f);
+    real_.assign(bins_, 0.0f);
+    imag_.assign(bins_, 0.0f);
+    mel_.assign(config_.n_mels, 0.0f);
+    stream_.assign(n, 0.0f);
+
+    init_filterbank();
+}
+
+MelSpectrogram::~MelSpectrogram() = default;
+
+void MelSpectrogram::init_filterbank() {
+    const size_t n_mels = config_.n_mels;
+    const double sr = static_cast<double>(config_.sample_rate);
+
+    // n_mels + 2 band edges equally spaced on the mel scale
+    std::vector<double> edges(n_mels + 2);
+    const double mel_min = hz_to_mel(config_.f_min);
+    const double mel_max = hz_to_mel(config_.f_max);
+    for (size_t i = 0; i < edges.size(); ++i) {
+        edges[i] = mel_to_hz(mel_min + (mel_max - mel_min) * i / (n_mels + 1));
+    }
+
+    band_start_.assign(n_mels, 0);
+    band_size_.assign(n_mels, 0);
+    band_offset_.assign(n_mels, 0);
+    weights_.clear();
+
+    std::vector<float> row(bins_);
+    for (size_t m = 0; m < n_mels; ++m) {
+        const double lower_width = edges[m + 1] - edges[m];
+        const double upper_width = edges[m + 2] - edges[m + 1];
+        const double enorm = 2.0 / (edges[m + 2] - edges[m]); // Slaney area normalization
+
+        size_t first = bins_, last = 0;
+        for (size_t k = 0; k < bins_; ++k) {
+            const double f = sr * k / config_.n_fft;
+            const double lower = (f - edges[m]) / lower_width;
+            const double upper = (edges[m + 2] - f) / upper_width;
+            const double w = std::max(0.0, std::min(lower, upper)) * enorm;
+            row[k] = static_cast<float>(w);
+            if (w > 0.0) {
+                first = std::min(first, k);
+                last = k;
+            }
+        }
+
+        band_offset_[m] = weights_.size();
+        if (first <= last && first < bins_) {
+            band_start_[m] = first;
+            band_size_[m] = last - first + 1;
+            weights_.insert(weights_.end(), row.begin() + first, row.begin() + last + 1);
+        }
+    }
+}
+
+const MelSpectrogram::Config& MelSpectrogram::config() const {
+    return config_;
+}
+
+size_t MelSpectrogram::bins() const {
+    return bins_;
+}
+
+size_t MelSpectrogram::num_frames(size_t num_samples) const {
+    return 1 + num_samples / config_.hop_length;
+}
+
+void MelSpectrogram::compute_frame(float* out, size_t stride) {
+    DSPKernel::apply_window(frame_.data(), window_.data(), frame_.data(), config_.n_fft);
+    plan_->forward(frame_.data(), real_.data(), imag_.data());
+
+    // Power spectrum (reuses real_)
+    float* power = real_.data();
+    const float* im = imag_.data();
+    for (size_t k = 0; k < bins_; ++k) {
+        power[k] = power[k] * power[k] + im[k] * im[k];
+    }
+
+    const float floor = config_.log_floor;
+    float* mel = mel_.data();
+    for (size_t m = 0; m < config_.n_mels; ++m) {
+        const float* p = power + band_start_[m];
+        const float* w = weights_.data() + band_offset_[m];
+        float acc = 0.0f;
+        for (size_t k = 0; k < band_size_[m]; ++k) {
+            acc += p[k] * w[k];
+        }
+        mel[m] = std::max(acc, floor);
+    }
+
+    // log10(x) = ln(x) / ln(10), one vectorized pass over all bands
+    VectorMath::log(mel, mel, config_.n_mels);
+    const float inv_ln10 = 0.434294481903f;
+    for (size_t m = 0; m < config_.n_mels; ++m) {
+        out[m * stride] = mel[m] * inv_ln10;
+    }
+}
+
+size_t MelSpectrogram::compute(const float* audio, size_t num_samples, float* out, size_t max_frames,
+                               Layout layout) {
+    if (num_samples == 0) return 0;
+    const size_t n = config_.n_fft;
+    const size_t hop = config_.hop_length;
+    const long long pad = static_cast<long long>(n / 2);
+    const size_t frames = std::min(num_frames(num_samples), max_frames);
+
+    for (size_t t = 0; t < frames; ++t) {
+        const long long start = static_cast<long long>(t * hop) - pad;
+        if (start >= 0 && static_cast<size_t>(start) + n <= num_samples) {
+            std::memcpy(frame_.data(), audio + start, n * sizeof(float));
+        } else {
+            for (size_t i = 0; i < n; ++i) {
+                frame_[i] = audio[reflect_index(start + static_cast<long long>(i), num_samples)];
+            }
+        }
+
+        if (layout == Layout::FRAME_MAJOR) {
+            compute_frame(out + t * config_.n_mels, 1);
+        } else {
+            compute_frame(out + t, max_frames);
+        }
+    }
+    return frames;
+}
+
+size_t MelSpectrogram::pending_frames(size_t num_samples) const {
+    const size_t n = config_.n_fft;
+    const size_t total = stream_fill_ + num_samples;
+    if (total < n) return 0;
+    return 1 + (total - n) / config_.hop_length;
+}
+
+size_t MelSpectrogram::process(const float* samples, size_t num_samples, float* out) {
+    const size_t n = config_.n_fft;
+    const size_t hop = config_.hop_length;
+    size_t written = 0;
+
+    while (num_samples > 0) {
+        size_t take = std::min(n - stream_fill_, num_samples);
+        std::memcpy(stream_.data() + stream_fill_, samples, take * sizeof(float));
+        stream_fill_ += take;
+        samples += take;
+        num_samples -= take;
+
+        if (stream_fill_ < n) break;
+
+        std::memcpy(frame_.data(), stream_.data(), n * sizeof(float));
+        compute_frame(out + written * config_.n_mels, 1);
+        ++written;
+
+        // Drop one hop (hop_length <= n_fft)
+        std::memmove(stream_.data(), stream_.data() + hop, (n - hop) * sizeof(float));
+        stream_fill_ = n - hop;
+    }
+    return written;
+}
+
+void MelSpectrogram::reset() {
+    stream_fill_ = 0;
+}
+
+void MelSpectrogram::normalize_whisper(float* data, size_t size) {
+    if (size == 0) return;
+    float max_val = *std::max_element(data, data + size);
+    float min_val = max_val - 8.0f;
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = (std::max(data[i], min_val) + 4.0f) / 4.0f;
+    }
+}
+
+} // namespace signal
+} // namespace minni
@@ -0,0 +1,137 @@
+#ifndef MINNI_CORE_SIGNAL_MEL_SPECTROGRAM_H_
+#define MINNI_CORE_SIGNAL_MEL_SPECTROGRAM_H_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace minni {
+namespace signal {
+
+class RealFFTPlan;
+
+/**
+ * Short-time Fourier transform + log-mel filterbank feature extractor.
+ * Per frame: window -> real FFT -> power spectrum -> sparse mel matmul -> log10.
+ * The defaults match Whisper's front end (16 kHz, 400-point Hann window, hop 160,
+ * 80 Slaney-normalized mel bands, log10 with a 1e-10 floor); apply
+ * normalize_whisper() to a whole clip to get the model's input scaling.
+ *
+ * Output is written straight into a caller-provided buffer (e.g. the data of a
+ * preallocated genai::Tensor of shape {1, n_mels, frames} with MEL_MAJOR layout),
+ * so a clip costs no allocations after construction.
+ * Not thread-safe: use one instance per thread.
+ */
+class MelSpectrogram {
+public:
+    enum class Window {
+        HANN,        // Periodic Hann (as torch.hann_window)
+        HAMMING,     // Periodic Hamming
+        RECTANGULAR
+    };
+
+    enum class Layout {
+        FRAME_MAJOR, // out[frame * n_mels + mel]
+        MEL_MAJOR    // out[mel * max_frames + frame] (Whisper input: {1, n_mels, frames})
+    };
+
+    struct Config {
+        size_t sample_rate = 16000;
+        size_t n_fft = 400;          // Frame and FFT length (even)
+        size_t hop_length = 160;     // Clamped to n_fft
+        size_t n_mels = 80;
+        float f_min = 0.0f;
+        float f_max = 0.0f;          // 0 = sample_rate / 2
+        Window window = Window::HANN;
+        float log_floor = 1e-10f;    // log10(max(mel, log_floor))
+    };
+
+    MelSpectrogram();
+    explicit MelSpectrogram(const Config& config);
+    ~MelSpectrogram();
+
+    MelSpectrogram(const MelSpectrogram&) = delete;
+    MelSpectrogram& operator=(const MelSpectrogram&) = delete;
+
+    const Config& config() const;
+
+    /**
+     * Number of spectrum bins (n_fft / 2 + 1).
+     */
+    size_t bins() const;
+
+    /**
+     * Frames produced by compute() for a clip (centered framing: 1 + num_samples / hop).
+     */
+    size_t num_frames(size_t num_samples) const;
+
+    /**
+     * Log-mel spectrogram of a whole clip. Frames are centered on t * hop_length
+     * with reflect padding at both ends (torch.stft(center=True)).
+     * @param audio Samples.
+     * @param num_samples Number of samples.
+     * @param out Receives min(num_frames(num_samples), max_frames) frames.
+     * @param max_frames Capacity of out in frames (also the row stride for MEL_MAJOR).
+     * @param layout Output layout.
+     * @return Number of frames written.
+     */
+    size_t compute(const float* audio, size_t num_samples, float* out, size_t max_frames,
+                   Layout layout = Layout::FRAME_MAJOR);
+
+    /**
+     * Streaming STFT: append samples and emit one frame per hop_length samples once
+     * n_fft samples have been seen (no centering; state persists between calls).
+     * @param out Frame-major output with room for pending_frames(num_samples) frames.
+     * @return Number of frames written.
+     */
+    size_t process(const float* samples, size_t num_samples, float* out);
+
+    /**
+     * Frames the next process() call will emit for num_samples new samples.
+     */
+    size_t pending_frames(size_t num_samples) const;
+
+    /**
+     * Clear the streaming buffer.
+     */
+    void reset();
+
+    /**
+     * Whisper scaling of a whole log-mel clip, in place:
+     * x = (max(x, max_all - 8) + 4) / 4.
+     */
+    static void normalize_whisper(float* data, size_t size);
+
+private:
+    Config config_;
+    size_t bins_;
+    std::unique_ptr<RealFFTPlan> plan_;
+    std::vector<float> window_;
+
+    // Sparse mel filterbank: band m covers bins [band_start_[m], band_start_[m] + band_size_[m])
+    // with weights at weights_[band_offset_[m] ...]
+    std::vector<size_t> band_start_;
+    std::vector<size_t> band_size_;
+    std::vector<size_t> band_offset_;
+    std::vector<float> weights_;
+
+    // Scratch
+    std::vector<float> frame_;
+    std::vector<float> real_;
+    std::vector<float> imag_;
+    std::vector<float> mel_;
+
+    // Streaming
+    std::vector<float> stream_;
+    size_t stream_fill_;
+
+    void init_filterbank();
+
+    // frame_ holds n_fft samples: window, transform and write n_mels values at out[m * stride]
+    void compute_frame(float* out, size_t stride);
+};
+
+} // namespace signal
+} // namespace minni
+
+#endif // MINNI_CORE_SIGNAL_MEL_SPECTROGRAM_H_
@@ -0,0 +1,122 @@
+#include "PartitionedConvolver.h"
+#include <algorithm>
+#include <cstring>
+
+namespace minni {
+namespace signal {
+
+namespace {
+
+size_t pick_block_size(size_t taps_size, size_t requested) {
+    size_t target = requested;
+    if (target == 0) {
+        // One partition for short filters; cap the block (latency / FFT size) for long ones
+        target = std::min<size_t>(std::max<size_t>(taps_size, 64), 1024);
+    }
+    size_t block = 1;
+    while (block < target) block <<= 1;
+    return block;
+}
+
+} // namespace
+
+PartitionedConvolver::PartitionedConvolver(const float* taps, size_t taps_size, size_t block_size)
+    : block_size_(pick_block_size(taps_size, block_size)),
+      num_partitions_(std::max<size_t>(1, (taps_size + block_size_ - 1) / block_size_)),
+      plan_(2 * block_size_),
+      head_(0) {
+    const size_t bins = plan_.bins();
+
+    filter_r_.assign(num_partitions_ * bins, 0.0f);
+    filter_i_.assign(num_partitions_ * bins, 0.0f);
+    history_r_.assign(num_partitions_ * bins, 0.0f);
+    history_i_.assign(num_partitions_ * bins, 0.0f);
+    window_.assign(2 * block_size_, 0.0f);
+    acc_r_.assign(bins, 0.0f);
+    acc_i_.assign(bins, 0.0f);
+    time_.assign(2 * block_size_, 0.0f);
+    pad_.assign(block_size_, 0.0f);
+
+    // Spectrum of each partition, zero padded to the FFT length
+    for (size_t p = 0; p < num_partitions_; ++p) {
+        std::fill(time_.begin(), time_.end(), 0.0f);
+        size_t begin = p * block_size_;
+        size_t count = std::min(block_size_, taps_size - std::min(begin, taps_size));
+        if (count > 0) {
+            std::memcpy(time_.data(), taps + begin, count * sizeof(float));
+        }
+        plan_.forward(time_.data(), filter_r_.data() + p * bins, filter_i_.data() + p * bins);
+    }
+}
+
+PartitionedConvolver::~PartitionedConvolver() = default;
+
+size_t PartitionedConvolver::block_size() const {
+    return block_size_;
+}
+
+size_t PartitionedConvolver::num_partitions() const {
+    return num_partitions_;
+}
+
+void PartitionedConvolver::reset() {
+    std::fill(history_r_.begin(), history_r_.end(), 0.0f);
+    std::fill(history_i_.begin(), history_i_.end(), 0.0f);
+    std::fill(window_.begin(), window_.end(), 0.0f);
+    head_ = 0;
+}
+
+void PartitionedConvolver::process_block(const float* input, float* output) {
+    const size_t bins = plan_.bins();
+    const size_t b = block_size_;
+
+    // 1. Slide the window and transform it into the newest delay-line slot
+    std::memcpy(window_.data(), window_.data() + b, b * sizeof(float));
+    std::memcpy(window_.data() + b, input, b * sizeof(float));
+
+    head_ = (head_ + 1) % num_partitions_;
+    float* xr = history_r_.data() + head_ * bins;
+    float* xi = history_i_.data() + head_ * bins;
+    plan_.forward(window_.data(), xr, xi);
+
+    // 2. Y = sum_p X[t - p] * H[p]
+    std::fill(acc_r_.begin(), acc_r_.end(), 0.0f);
+    std::fill(acc_i_.begin(), acc_i_.end(), 0.0f);
+    float* ar = acc_r_.data();
+    float* ai = acc_i_.data();
+    size_t slot = head_;
+    for (size_t p = 0; p < num_partitions_; ++p) {
+        const float* hr = filter_r_.data() + p * bins;
+        const float* hi = filter_i_.data() + p * bins;
+        const float* sr = history_r_.data() + slot * bins;
+        const float* si = history_i_.data() + slot * bins;
+        for (size_t k = 0; k < bins; ++k) {
+            ar[k] += sr[k] * hr[k] - si[k] * hi[k];
+            ai[k] += sr[k] * hi[k] + si[k] * hr[k];
+        }
+        slot = (slot == 0) ? num_partitions_ - 1 : slot - 1;
+    }
+
+    // 3. Back to time domain; the second half is the valid (non-wrapped) part
+    plan_.inverse(ar, ai, time_.data());
+    std::memcpy(output, time_.data() + b, b * sizeof(float));
+}
+
+void PartitionedConvolver::process(const float* input, size_t size, float* output) {
+    reset();
+
+    size_t i = 0;
+    for (; i + block_size_ <= size; i += block_size_) {
+        process_block(input + i, output + i);
+    }
+    if (i < size) {
+        size_t rest = size - i;
+        std::fill(pad_.begin(), pad_.end(), 0.0f);
+        std::memcpy(pad_.data(), input + i, rest * sizeof(float));
+        process_block(pad_.data(), pad_.data());
+        std::memcpy(output + i, pad_.data(), rest * sizeof(float));
+    }
+}
+
+} // namespace signal
+} // namespace minni
@@ -0,0 +1,73 @@
+#ifndef MINNI_CORE_SIGNAL_PARTITIONED_CONVOLVER_H_
+#define MINNI_CORE_SIGNAL_PARTITIONED_CONVOLVER_H_
+
+#include <cstddef>
+#include <vector>
+#include "FFTPlan.h"
+
+namespace minni {
+namespace signal {
+
+/**
+ * FIR filtering by uniformly partitioned overlap-save convolution.
+ * The taps are split into partitions of block_size() samples whose spectra are
+ * precomputed; each input block costs one real FFT, one inverse real FFT of
+ * 2 * block_size() points and a complex multiply-accumulate per partition, i.e.
+ * O(log B) work per sample instead of O(taps) for direct convolution.
+ *
+ * State (input history) is kept between process_block() calls, so a signal can
+ * be streamed block by block. No allocations after construction.
+ */
+class PartitionedConvolver {
+public:
+    /**
+     * @param taps Filter coefficients (copied).
+     * @param taps_size Number of coefficients.
+     * @param block_size Partition / block length (rounded up to a power of 2;
+     *                   0 = pick from the filter length).
+     */
+    PartitionedConvolver(const float* taps, size_t taps_size, size_t block_size = 0);
+    ~PartitionedConvolver();
+
+    size_t block_size() const;
+    size_t num_partitions() const;
+
+    /**
+     * Clear the input history (as if all previous input were zero).
+     */
+    void reset();
+
+    /**
+     * Filter exactly block_size() samples, continuing from the previous block.
+     * input and output may alias.
+     */
+    void process_block(const float* input, float* output);
+
+    /**
+     * Filter a whole signal with zero initial history (same result as
+     * DSPKernel::fir_filter). Calls reset() first; the last block is zero padded.
+     */
+    void process(const float* input, size_t size, float* output);
+
+private:
+    size_t block_size_;
+    size_t num_partitions_;
+    RealFFTPlan plan_;                    // 2 * block_size points
+
+    std::vector<float> filter_r_;         // num_partitions x bins spectra of the tap partitions
+    std::vector<float> filter_i_;
+    std::vector<float> history_r_;        // Frequency-domain delay line (ring of num_partitions)
+    std::vector<float> history_i_;
+    size_t head_;                         // Ring slot of the newest input spectrum
+
+    std::vector<float> window_;           // [previous block | current block]
+    std::vector<float> acc_r_;            // Accumulated output spectrum
+    std::vector<float> acc_i_;
+    std::vector<float> time_;             // Inverse FFT output (2 * block_size)
+    std::vector<float> pad_;              // Zero-padded final block for process()
+};
+
+} // namespace signal
+} // namespace minni
+
+#endif // MINNI_CORE_SIGNAL_PARTITIONED_CONVOLVER_H_
@@ -0,0 +1,478 @@
+#ifndef MINNI_CORE_SIGNAL_SENSOR_FUSION_H_
+#define MINNI_CORE_SIGNAL_SENSOR_FUSION_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace minni {
+namespace signal {
+
+/**
+ * Fixed-size row-major float matrix for small state-space models.
+ * All sizes are compile-time constants, so the loops below are fully unrolled by
+ * the compiler for the typical 2..9 dimensional filters and nothing allocates.
+ */
+template <size_t R, size_t C>
+struct Matrix {
+    float m[R * C];
+
+    float& operator()(size_t r, size_t c) { return m[r * C + c]; }
+    float operator()(size_t r, size_t c) const { return m[r * C + c]; }
+    float& operator[](size_t i) { return m[i]; }
+    float operator[](size_t i) const { return m[i]; }
+
+    static Matrix zeros() {
+        Matrix out;
+        for (size_t i = 0; i < R * C; ++i) out.m[i] = 0.0f;
+        return out;
+    }
+
+    static Matrix identity() {
+        Matrix out = zeros();
+        for (size_t i = 0; i < R && i < C; ++i) out(i, i) = 1.0f;
+        return out;
+    }
+
+    Matrix<C, R> transpose() const {
+        Matrix<C, R> out;
+        for (size_t r = 0; r < R; ++r)
+            for (size_t c = 0; c < C; ++c) out(c, r) = (*this)(r, c);
+        return out;
+    }
+};
+
+template <size_t N>
+using Vector = Matrix<N, 1>;
+
+template <size_t R, size_t C>
+inline Matrix<R, C> operator+(const Matrix<R, C>& a, const Matrix<R, C>& b) {
+    Matrix<R, C> out;
+    for (size_t i = 0; i < R * C; ++i) out.m[i] = a.m[i] + b.m[i];
+    return out;
+}
+
+template <size_t R, size_t C>
+inline Matrix<R, C> operator-(const Matrix<R, C>& a, const Matrix<R, C>& b) {
+    Matrix<R, C> out;
+    for (size_t i = 0; i < R * C; ++i) out.m[i] = a.m[i] - b.m[i];
+    return out;
+}
+
+template <size_t R, size_t K, size_t C>
+inline Matrix<R, C> operator*(const Matrix<R, K>& a, const Matrix<K, C>& b) {
+    Matrix<R, C> out;
+    for (size_t r = 0; r < R; ++r) {
+        for (size_t c = 0; c < C; ++c) {
+            float acc = 0.0f;
+            for (size_t k = 0; k < K; ++k) acc += a(r, k) * b(k, c);
+            out(r, c) = acc;
+        }
+    }
+    return out;
+}
+
+/**
+ * Solve A * X = B in place (B becomes X) for symmetric positive definite A,
+ * by Cholesky decomposition. Returns false if A is not positive definite.
+ */
+template <size_t M, size_t K>
+inline bool solve_spd(Matrix<M, M> a, Matrix<M, K>& b) {
+    // A = L * L^T, L stored in the lower triangle of a
+    for (size_t j = 0; j < M; ++j) {
+        float d = a(j, j);
+        for (size_t k = 0; k < j; ++k) d -= a(j, k) * a(j, k);
+        if (!(d > 0.0f)) return false;
+        d = std::sqrt(d);
+        a(j, j) = d;
+        for (size_t i = j + 1; i < M; ++i) {
+            float v = a(i, j);
+            for (size_t k = 0; k < j; ++k) v -= a(i, k) * a(j, k);
+            a(i, j) = v / d;
+        }
+    }
+    for (size_t c = 0; c < K; ++c) {
+        // L * u = b
+        for (size_t i = 0; i < M; ++i) {
+            float v = b(i, c);
+            for (size_t k = 0; k < i; ++k) v -= a(i, k) * b(k, c);
+            b(i, c) = v / a(i, i);
+        }
+        // L^T * x = u
+        for (size_t ii = M; ii-- > 0;) {
+            float v = b(ii, c);
+            for (size_t k = ii + 1; k < M; ++k) v -= a(k, ii) * b(k, c);
+            b(ii, c) = v / a(ii, ii);
+        }
+    }
+    return true;
+}
+
+/**
+ * State estimate (x, P) shared by the linear and extended filters, with the
+ * measurement correction step for any measurement size K.
+ */
+template <size_t N>
+class KalmanState {
+public:
+    KalmanState() : x_(Vector<N>::zeros()), P_(Matrix<N, N>::identity()) {}
+
+    void set_state(const Vector<N>& x, const Matrix<N, N>& P) {
+        x_ = x;
+        P_ = P;
+    }
+
+    const Vector<N>& state() const { return x_; }
+    const Matrix<N, N>& covariance() const { return P_; }
+
+protected:
+    Vector<N> x_;
+    Matrix<N, N> P_;
+
+    /**
+     * x += K * y, P = (I - K H) P (I - K H)^T + K R K^T (Joseph form, keeps P
+     * symmetric positive semi-definite in float precision).
+     */
+    template <size_t K>
+    bool correct(const Vector<K>& y, const Matrix<K, N>& H, const Matrix<K, K>& R) {
+        const Matrix<N, K> PHt = P_ * H.transpose();
+        const Matrix<K, K> S = H * PHt + R;
+
+        // K = P H^T S^-1  <=>  S K^T = H P (S and P symmetric)
+        Matrix<K, N> Kt = PHt.transpose();
+        if (!solve_spd(S, Kt)) return false;
+        const Matrix<N, K> gain = Kt.transpose();
+
+        x_ = x_ + gain * y;
+        const Matrix<N, N> IKH = Matrix<N, N>::identity() - gain * H;
+        P_ = IKH * P_ * IKH.transpose() + gain * R * Kt;
+        return true;
+    }
+};
+
+/**
+ * Linear Kalman filter with state size N and default measurement size M:
+ * x' = F x (+ B u), P' = F P F^T + Q; z = H x + v, v ~ N(0, R).
+ * Other sensors can be fused into the same state with update<K>(z, H, R),
+ * e.g. RTT ranges and IMU readings of different sizes on one position state.
+ */
+template <size_t N, size_t M>
+class LinearKalmanFilter : public KalmanState<N> {
+public:
+    LinearKalmanFilter()
+        : F_(Matrix<N, N>::identity()),
+          Q_(Matrix<N, N>::zeros()),
+          H_(Matrix<M, N>::zeros()),
+          R_(Matrix<M, M>::identity()) {}
+
+    void set_transition(const Matrix<N, N>& F) { F_ = F; }
+    void set_process_noise(const Matrix<N, N>& Q) { Q_ = Q; }
+    void set_observation(const Matrix<M, N>& H) { H_ = H; }
+    void set_measurement_noise(const Matrix<M, M>& R) { R_ = R; }
+
+    const Matrix<N, N>& transition() const { return F_; }
+
+    void predict() {
+        this->x_ = F_ * this->x_;
+        this->P_ = F_ * this->P_ * F_.transpose() + Q_;
+    }
+
+    /**
+     * Predict with a control input: x' = F x + B u.
+     */
+    template <size_t U>
+    void predict(const Matrix<N, U>& B, const Vector<U>& u) {
+        this->x_ = F_ * this->x_ + B * u;
+        this->P_ = F_ * this->P_ * F_.transpose() + Q_;
+    }
+
+    /**
+     * Correct with a measurement of the default model (H, R).
+     * @return false if the innovation covariance is singular (state unchanged).
+     */
+    bool update(const Vector<M>& z) {
+        return update(z, H_, R_);
+    }
+
+    /**
+     * Correct with a measurement of another sensor: z = H x + v, v ~ N(0, R).
+     */
+    template <size_t K>
+    bool update(const Vector<K>& z, const Matrix<K, N>& H, const Matrix<K, K>& R) {
+        return this->correct(z - H * this->x_, H, R);
+    }
+
+private:
+    Matrix<N, N> F_;
+    Matrix<N, N> Q_;
+    Matrix<M, N> H_;
+    Matrix<M, M> R_;
+};
+
+/**
+ * Extended Kalman filter: nonlinear models linearized at the current estimate.
+ * Models are passed as callables, so they inline into predict() / update():
+ *   f(x) -> Vector<N>,  F(x) -> Matrix<N, N>  (transition and its Jacobian)
+ *   h(x) -> Vector<K>,  H(x) -> Matrix<K, N>  (measurement and its Jacobian)
+ */
+template <size_t N>
+class ExtendedKalmanFilter : public KalmanState<N> {
+public:
+    template <typename Transition, typename Jacobian>
+    void predict(Transition f, Jacobian jacobian, const Matrix<N, N>& Q) {
+        const Matrix<N, N> F = jacobian(this->x_);
+        this->x_ = f(this->x_);
+        this->P_ = F * this->P_ * F.transpose() + Q;
+    }
+
+    template <size_t K, typename Measurement, typename Jacobian>
+    bool update(const Vector<K>& z, Measurement h, Jacobian jacobian, const Matrix<K, K>& R) {
+        const Matrix<K, N> H = jacobian(this->x_);
+        return this->correct(z - h(this->x_), H, R);
+    }
+};
+
+/**
+ * Many independent tracks sharing one linear model (F, Q, H, R), stored
+ * structure-of-arrays: element i of every track is contiguous
+ * (state(i)[t], covariance(i, j)[t]). Each step of the filter is a loop over
+ * tracks with no dependencies, which the compiler vectorizes.
+ * Memory is allocated in the constructor only.
+ */
+template <size_t N, size_t M>
+class KalmanTrackBatch {
+public:
+    explicit KalmanTrackBatch(size_t tracks)
+        : tracks_(tracks),
+          F_(Matrix<N, N>::identity()),
+          Q_(Matrix<N, N>::zeros()),
+          H_(Matrix<M, N>::zeros()),
+          R_(Matrix<M, M>::identity()),
+          x_(N * tracks, 0.0f),
+          P_(N * N * tracks, 0.0f),
+          tmp_(N * (N > M ? N : M) * tracks, 0.0f),
+          pht_(N * M * tracks, 0.0f),
+          s_(M * M * tracks, 0.0f),
+          y_(M * tracks, 0.0f) {
+        for (size_t i = 0; i < N; ++i) fill(cov(i, i), 1.0f);
+    }
+
+    size_t tracks() const { return tracks_; }
+
+    void set_transition(const Matrix<N, N>& F) { F_ = F; }
+    void set_process_noise(const Matrix<N, N>& Q) { Q_ = Q; }
+    void set_observation(const Matrix<M, N>& H) { H_ = H; }
+    void set_measurement_noise(const Matrix<M, M>& R) { R_ = R; }
+
+    // SoA views: tracks() values each
+    float* state(size_t i) { return x_.data() + i * tracks_; }
+    const float* state(size_t i) const { return x_.data() + i * tracks_; }
+    float* covariance(size_t i, size_t j) { return cov(i, j); }
+    const float* covariance(size_t i, size_t j) const { return P_.data() + (i * N + j) * tracks_; }
+
+    /**
+     * Set one track's estimate.
+     */
+    void set_track(size_t t, const Vector<N>& x, const Matrix<N, N>& P) {
+        for (size_t i = 0; i < N; ++i) {
+            state(i)[t] = x[i];
+            for (size_t j = 0; j < N; ++j) cov(i, j)[t] = P(i, j);
+        }
+    }
+
+    void predict() {
+        const size_t T = tracks_;
+        // x = F x (via tmp_ rows 0..N-1)
+        for (size_t i = 0; i < N; ++i) {
+            float* out = tmp_.data() + i * T;
+            fill(out, 0.0f);
+            for (size_t k = 0; k < N; ++k) {
+                const float f = F_(i, k);
+                if (f == 0.0f) continue;
+                const float* xk = state(k);
+                for (size_t t = 0; t < T; ++t) out[t] += f * xk[t];
+            }
+        }
+        std::copy(tmp_.begin(), tmp_.begin() + N * T, x_.begin());
+
+        // tmp = F P
+        for (size_t i = 0; i < N; ++i) {
+            for (size_t j = 0; j < N; ++j) {
+                float* out = tmp_.data() + (i * N + j) * T;
+                fill(out, 0.0f);
+                for (size_t k = 0; k < N; ++k) {
+                    const float f = F_(i, k);
+                    if (f == 0.0f) continue;
+                    const float* pk = cov(k, j);
+                    for (size_t t = 0; t < T; ++t) out[t] += f * pk[t];
+                }
+            }
+        }
+        // P = tmp F^T + Q
+        for (size_t i = 0; i < N; ++i) {
+            for (size_t j = 0; j < N; ++j) {
+                float* out = cov(i, j);
+                fill(out, Q_(i, j));
+                for (size_t k = 0; k < N; ++k) {
+                    const float f = F_(j, k);
+                    if (f == 0.0f) continue;
+                    const float* a = tmp_.data() + (i * N + k) * T;
+                    for (size_t t = 0; t < T; ++t) out[t] += a[t] * f;
+                }
+            }
+        }
+    }
+
+    /**
+     * Correct every track with its measurement.
+     * @param z SoA measurements: z[k * tracks() + t].
+     * @param weight Optional per-track weight, 1 = update, 0 = no measurement this
+     *               step (track left unchanged). nullptr = update all.
+     */
+    void update(const float* z, const float* weight = nullptr) {
+        const size_t T = tracks_;
+
+        // y = z - H x
+        for (size_t k = 0; k < M; ++k) {
+            float* y = y_.data() + k * T;
+            const float* zk = z + k * T;
+            for (size_t t = 0; t < T; ++t) y[t] = zk[t];
+            for (size_t j = 0; j < N; ++j) {
+                const float h = H_(k, j);
+                if (h == 0.0f) continue;
+                const float* xj = state(j);
+                for (size_t t = 0; t < T; ++t) y[t] -= h * xj[t];
+            }
+        }
+
+        // PHt = P H^T (N x M)
+        for (size_t i = 0; i < N; ++i) {
+            for (size_t k = 0; k < M; ++k) {
+                float* out = pht(i, k);
+                fill(out, 0.0f);
+                for (size_t j = 0; j < N; ++j) {
+                    const float h = H_(k, j);
+                    if (h == 0.0f) continue;
+                    const float* p = cov(i, j);
+                    for (size_t t = 0; t < T; ++t) out[t] += p[t] * h;
+                }
+            }
+        }
+
+        // S = H PHt + R (M x M)
+        for (size_t k = 0; k < M; ++k) {
+            for (size_t l = 0; l < M; ++l) {
+                float* out = s(k, l);
+                fill(out, R_(k, l));
+                for (size_t i = 0; i < N; ++i) {
+                    const float h = H_(k, i);
+                    if (h == 0.0f) continue;
+                    const float* a = pht(i, l);
+                    for (size_t t = 0; t < T; ++t) out[t] += h * a[t];
+                }
+            }
+        }
+
+        // Cholesky of S in place (lower triangle); diagonal stores 1 / L(j, j)
+        for (size_t j = 0; j < M; ++j) {
+            float* djj = s(j, j);
+            for (size_t k = 0; k < j; ++k) {
+                const float* ljk = s(j, k);
+                for (size_t t = 0; t < T; ++t) djj[t] -= ljk[t] * ljk[t];
+            }
+            for (size_t t = 0; t < T; ++t) djj[t] = 1.0f / std::sqrt(djj[t]);
+            for (size_t i = j + 1; i < M; ++i) {
+                float* lij = s(i, j);
+                for (size_t k = 0; k < j; ++k) {
+                    const float* lik = s(i, k);
+                    const float* ljk = s(j, k);
+                    for (size_t t = 0; t < T; ++t) lij[t] -= lik[t] * ljk[t];
+                }
+                for (size_t t = 0; t < T; ++t) lij[t] *= djj[t];
+            }
+        }
+
+        // Gain rows: K(i, :) solves S k = PHt(i, :); stored over tmp_ (N x M)
+        for (size_t i = 0; i < N; ++i) {
+            for (size_t k = 0; k < M; ++k) {
+                float* g = gain(i, k);
+                const float* b = pht(i, k);
+                for (size_t t = 0; t < T; ++t) g[t] = b[t];
+                for (size_t l = 0; l < k; ++l) {
+                    const float* lkl = s(k, l);
+                    const float* gl = gain(i, l);
+                    for (size_t t = 0; t < T; ++t) g[t] -= lkl[t] * gl[t];
+                }
+                const float* inv = s(k, k);
+                for (size_t t = 0; t < T; ++t) g[t] *= inv[t];
+            }
+            for (size_t k = M; k-- > 0;) {
+                float* g = gain(i, k);
+                for (size_t l = k + 1; l < M; ++l) {
+                    const float* llk = s(l, k);
+                    const float* gl = gain(i, l);
+                    for (size_t t = 0; t < T; ++t) g[t] -= llk[t] * gl[t];
+                }
+                const float* inv = s(k, k);
+                for (size_t t = 0; t < T; ++t) g[t] *= inv[t];
+            }
+            if (weight) {
+                for (size_t k = 0; k < M; ++k) {
+                    float* g = gain(i, k);
+                    for (size_t t = 0; t < T; ++t) g[t] *= weight[t];
+                }
+            }
+        }
+
+        // x += K y
+        for (size_t i = 0; i < N; ++i) {
+            float* xi = state(i);
+            for (size_t k = 0; k < M; ++k) {
+                const float* g = gain(i, k);
+                const float* y = y_.data() + k * T;
+                for (size_t t = 0; t < T; ++t) xi[t] += g[t] * y[t];
+            }
+        }
+
+        // P -= K PHt^T (symmetric: K PHt^T = PHt S^-1 PHt^T)
+        for (size_t i = 0; i < N; ++i) {
+            for (size_t j = 0; j < N; ++j) {
+                float* p = cov(i, j);
+                for (size_t k = 0; k < M; ++k) {
+                    const float* g = gain(i, k);
+                    const float* b = pht(j, k);
+                    for (size_t t = 0; t < T; ++t) p[t] -= g[t] * b[t];
+                }
+            }
+        }
+    }
+
+private:
+    size_t tracks_;
+    Matrix<N, N> F_;
+    Matrix<N, N> Q_;
+    Matrix<M, N> H_;
+    Matrix<M, M> R_;
+
+    std::vector<float> x_;    // N x tracks
+    std::vector<float> P_;    // N x N x tracks
+    std::vector<float> tmp_;  // N x max(N, M) x tracks (F P during predict, gain during update)
+    std::vector<float> pht_;  // N x M x tracks
+    std::vector<float> s_;    // M x M x tracks
+    std::vector<float> y_;    // M x tracks
+
+    float* cov(size_t i, size_t j) { return P_.data() + (i * N + j) * tracks_; }
+    float* pht(size_t i, size_t k) { return pht_.data() + (i * M + k) * tracks_; }
+    float* s(size_t k, size_t l) { return s_.data() + (k * M + l) * tracks_; }
+    float* gain(size_t i, size_t k) { return tmp_.data() + (i * M + k) * tracks_; }
+
+    void fill(float* row, float v) {
+        for (size_t t = 0; t < tracks_; ++t) row[t] = v;
+    }
+};
+
+} // namespace signal
+} // namespace minni
+
+#endif // MINNI_CORE_SIGNAL_SENSOR_FUSION_H_
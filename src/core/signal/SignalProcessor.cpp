@@ -1,64 +1,153 @@
 #include "SignalProcessor.h"
 #include "DSPKernel.h"
+#include "FFTPlan.h"
 #include <algorithm>
+#include <cstring>
 
 namespace minni {
 namespace signal {
 
-SignalProcessor::SignalProcessor() = default;
+SignalProcessor::SignalProcessor()
+    : real_(nullptr), imag_(nullptr), size_(0), capacity_(0) {}
+
 SignalProcessor::~SignalProcessor() = default;
 
+void SignalProcessor::reserve(size_t capacity) {
+    if (owned_real_.size() >= capacity) return;
+
+    // Growing may move the owned buffers: re-point whichever of them are in use
+    const bool owned_real = (real_ == nullptr || real_ == owned_real_.data());
+    const bool owned_imag = (imag_ == nullptr || imag_ == owned_imag_.data());
+    owned_real_.resize(capacity);
+    owned_imag_.resize(std::max(capacity, owned_imag_.size()));
+    if (owned_real) {
+        real_ = owned_real_.data();
+        capacity_ = owned_real_.size();
+    }
+    if (owned_imag) {
+        imag_ = owned_imag_.data();
+    }
+}
+
+void SignalProcessor::use_owned(size_t size) {
+    // Grow only: steady-state frames of the same size never reallocate
+    if (owned_real_.size() < size) {
+        owned_real_.resize(size);
+    }
+    if (owned_imag_.size() < size) {
+        owned_imag_.resize(size);
+    }
+    real_ = owned_real_.data();
+    imag_ = owned_imag_.data();
+    capacity_ = owned_real_.size();
+    size_ = size;
+}
+
 void SignalProcessor::load(const std::vector<float>& data) {
-    real_ = data;
-    imag_.assign(data.size(), 0.0f);
+    load(data.data(), data.size());
+}
+
+void SignalProcessor::load(const float* data, size_t size) {
+    use_owned(size);
+    if (size > 0) {
+        std::memcpy(real_, data, size * sizeof(float));
+        std::fill(imag_, imag_ + size, 0.0f);
+    }
+}
+
+void SignalProcessor::bind(float* real, float* imag, size_t size) {
+    real_ = real;
+    size_ = size;
+    capacity_ = size;
+    if (imag) {
+        imag_ = imag;
+    } else {
+        if (owned_imag_.size() < size) {
+            owned_imag_.resize(size);
+        }
+        imag_ = owned_imag_.data();
+        std::fill(imag_, imag_ + size, 0.0f);
+    }
 }
 
 void SignalProcessor::apply_window(const std::vector<float>& window) {
-    if (window.size() != real_.size()) return;
+    apply_window(window.data(), window.size());
+}
 
-    // Use DSPKernel for optimized processing
-    // Since DSPKernel writes to an output buffer, we can do in-place if supported
-    // But our DSPKernel signature is (in, win, out).
-    // Let's create a temporary or modify DSPKernel to allow in-place?
-    // DSPKernel::apply_window is safe for in-place if in == out.
+void SignalProcessor::apply_window(const float* window, size_t size) {
+    if (size != size_ || size_ == 0) return;
 
-    DSPKernel::apply_window(real_.data(), window.data(), real_.data(), real_.size());
+    // DSPKernel::apply_window is safe in place (in == out)
+    DSPKernel::apply_window(real_, window, real_, size_);
 }
 
 void SignalProcessor::fft(bool inverse) {
-    if (real_.empty()) return;
+    if (size_ == 0) return;
 
-    // Ensure size is power of 2
-    size_t n = real_.size();
-    if ((n & (n - 1)) != 0) return; // Not power of 2
+    if (!plan_ || plan_->size() != size_) {
+        plan_.reset(new FFTPlan(size_));
+    }
+    plan_->execute(real_, imag_, inverse);
+}
 
-    DSPKernel::fft(real_.data(), imag_.data(), n, inverse);
+void SignalProcessor::rfft() {
+    size_t n = size_;
+    if (n < 2 || n % 2 != 0) return; // Needs an even length
+
+    if (!real_plan_ || real_plan_->size() != n) {
+        real_plan_.reset(new RealFFTPlan(n));
+    }
+    // In place: the N samples become N/2 + 1 bins (fits, as N >= 2)
+    real_plan_->forward(real_, real_, imag_);
+    size_ = real_plan_->bins();
 }
 
-void SignalProcessor::magnitude() {
-    if (real_.empty()) return;
+void SignalProcessor::irfft() {
+    size_t bins = size_;
+    if (bins < 2) return;
+
+    size_t n = (bins - 1) * 2;
+    if (n > capacity_) return;
+    if (!real_plan_ || real_plan_->size() != n) {
+        real_plan_.reset(new RealFFTPlan(n));
+    }
+    real_plan_->inverse(real_, imag_, real_);
+    size_ = n;
+    std::fill(imag_, imag_ + n, 0.0f);
+}
 
-    // Writes result to real_, effectively destroying the complex info
-    // But DSPKernel::complex_magnitude takes (real, imag, out)
-    // Overlapping buffers might be risky depending on implementation,
-    // but element-wise magnitude is usually safe if loop order is correct.
-    // However, let's use a temp buffer or trust the kernel.
-    // Actually, our kernel implementation loops i=0..size. If out==real,
-    // output[i] depends on real[i] and imag[i]. Once output[i] is written,
-    // real[i] is overwritten. Since we don't look ahead, this IS safe.
+void SignalProcessor::magnitude() {
+    if (size_ == 0) return;
 
-    DSPKernel::complex_magnitude(real_.data(), imag_.data(), real_.data(), real_.size());
+    // Element-wise, so writing the result over the real input is safe
+    DSPKernel::complex_magnitude(real_, imag_, real_, size_);
 
     // Clear imaginary part as it's no longer valid/needed
-    std::fill(imag_.begin(), imag_.end(), 0.0f);
+    std::fill(imag_, imag_ + size_, 0.0f);
 }
 
 std::vector<float> SignalProcessor::get_output() const {
+    return std::vector<float>(real_, real_ + size_);
+}
+
+size_t SignalProcessor::copy_output(float* out, size_t capacity) const {
+    size_t count = std::min(size_, capacity);
+    if (count > 0) {
+        std::memcpy(out, real_, count * sizeof(float));
+    }
+    return count;
+}
+
+const float* SignalProcessor::real_data() const {
     return real_;
 }
 
+const float* SignalProcessor::imag_data() const {
+    return imag_;
+}
+
 size_t SignalProcessor::size() const {
-    return real_.size();
+    return size_;
 }
 
 } // namespace signal
@@ -3,40 +3,88 @@
 
 #include <vector>
 #include <cstddef>
+#include <memory>
 
 namespace minni {
 namespace signal {
 
+class FFTPlan;
+class RealFFTPlan;
+
 /**
  * High-level processor for chaining DSP operations.
- * Maintains state (real/imaginary buffers) to avoid repeated allocations.
+ * Works either on its own buffers (load()) or in place on caller memory (bind()).
+ * Owned buffers only ever grow and FFT plans are cached per size, so once a frame
+ * size has been seen, load / window / fft / magnitude / copy_output perform no heap
+ * allocations. Only get_output() (which returns a fresh vector) allocates.
  */
 class SignalProcessor {
 public:
     SignalProcessor();
     ~SignalProcessor();
 
+    /**
+     * Preallocate owned buffers for frames of up to `capacity` samples.
+     */
+    void reserve(size_t capacity);
+
     // Load data into the real buffer, clears imaginary buffer
     void load(const std::vector<float>& data);
+    void load(const float* data, size_t size);
+
+    /**
+     * Process caller memory in place instead of the owned buffers (until the next load()).
+     * @param real `size` samples; receives every result.
+     * @param imag `size` floats of imaginary part (nullptr = internal, zeroed).
+     * @param size Number of samples.
+     */
+    void bind(float* real, float* imag, size_t size);
 
     // Apply window function (e.g., Hanning) to current real buffer
     void apply_window(const std::vector<float>& window);
+    void apply_window(const float* window, size_t size);
 
-    // Perform in-place FFT on current buffers
+    // Perform in-place FFT on current buffers, any length (plan is built once per size and reused)
     void fft(bool inverse = false);
 
+    // Real-input FFT of the loaded samples (N, even): buffers shrink to the
+    // N/2 + 1 bins (DC .. Nyquist). Ignores the imaginary buffer.
+    void rfft();
+
+    // Inverse of rfft(): N/2 + 1 bins back to N real samples (imag becomes 0)
+    void irfft();
+
     // Compute magnitude and store in real buffer (imag becomes 0)
     void magnitude();
 
-    // Get the current real buffer (output)
+    // Get a copy of the current real buffer (output). Allocates; see copy_output().
     std::vector<float> get_output() const;
 
+    /**
+     * Copy the current real buffer into caller memory.
+     * @return Number of values copied (min(size(), capacity)).
+     */
+    size_t copy_output(float* out, size_t capacity) const;
+
+    // Current real / imaginary buffers (size() values)
+    const float* real_data() const;
+    const float* imag_data() const;
+
     // Get current size
     size_t size() const;
 
 private:
-    std::vector<float> real_;
-    std::vector<float> imag_;
+    std::vector<float> owned_real_;
+    std::vector<float> owned_imag_;
+    float* real_;
+    float* imag_;
+    size_t size_;
+    size_t capacity_;     // Values real_ / imag_ can hold (irfft grows size_ back up to it)
+
+    std::unique_ptr<FFTPlan> plan_;
+    std::unique_ptr<RealFFTPlan> real_plan_;
+
+    void use_owned(size_t size);
 };
 
 } // namespace signal
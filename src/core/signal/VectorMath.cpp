@@ -0,0 +1,503 @@
+#include "VectorMath.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+// Check for NEON support
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #include <arm_neon.h>
+    #define HAS_NEON
+#elif defined(__AVX2__)
+    #include <immintrin.h>
+#endif
+
+namespace minni {
+namespace signal {
+
+namespace {
+
+// log: x = m * 2^e with m in [sqrt(1/2), sqrt(2)), log(x) = log1p(m - 1) + e * ln2
+const float kSqrtHalf = 0.707106781186547524f;
+const float kLogP[9] = {
+    7.0376836292e-2f, -1.1514610310e-1f, 1.1676998740e-1f,
+    -1.2420140846e-1f, 1.4249322787e-1f, -1.6668057665e-1f,
+    2.0000714765e-1f, -2.4999993993e-1f, 3.3333331174e-1f
+};
+const float kLn2Hi = 0.693359375f;       // ln2 split so that e * kLn2Hi is exact
+const float kLn2Lo = -2.12194440e-4f;
+
+// exp: x = n * ln2 + r, |r| <= ln2 / 2, exp(x) = 2^n * exp(r)
+const float kLog2e = 1.44269504088896341f;
+const float kExpP[6] = {
+    1.9875691500e-4f, 1.3981999507e-3f, 8.3334519073e-3f,
+    4.1665795894e-2f, 1.6666665459e-1f, 5.0000001201e-1f
+};
+const float kExpHi = 88.7228394f;        // ln(FLT_MAX)
+const float kExpLo = -103.972084f;       // Below: 0 (past the smallest subnormal)
+
+// sin / cos: reduce by multiples of pi/4 (pi/4 split in three for exact products)
+const float kFourOverPi = 1.27323954473516f;
+const float kPiQuarter1 = 0.78515625f;
+const float kPiQuarter2 = 2.4187564849853515625e-4f;
+const float kPiQuarter3 = 3.77489497744594108e-8f;
+const float kSinP[3] = {-1.9515295891e-4f, 8.3321608736e-3f, -1.6666654611e-1f};
+const float kCosP[3] = {2.443315711809948e-5f, -1.388731625493765e-3f, 4.166664568298827e-2f};
+const float kTrigMax = 8192.0f;
+
+inline uint32_t as_bits(float x) {
+    uint32_t b;
+    std::memcpy(&b, &x, sizeof(b));
+    return b;
+}
+
+inline float as_float(uint32_t b) {
+    float x;
+    std::memcpy(&x, &b, sizeof(x));
+    return x;
+}
+
+// ---------------------------------------------------------------------------
+// Scalar versions (same algorithm as the vector paths; used for the tails)
+// ---------------------------------------------------------------------------
+
+// Fused wherever the AVX2 path's madd() is, so tails round like the vector lanes
+inline float madd_scalar(float a, float b, float c) {
+#if defined(__FMA__) && !defined(HAS_NEON)
+    return std::fma(a, b, c);
+#else
+    return a * b + c;
+#endif
+}
+
+float log_scalar(float x) {
+    if (!(x > 0.0f)) {
+        return x == 0.0f ? -std::numeric_limits<float>::infinity()
+                         : std::numeric_limits<float>::quiet_NaN();
+    }
+    if (x == std::numeric_limits<float>::infinity()) return x;
+
+    int e_adjust = 0;
+    if (x < std::numeric_limits<float>::min()) { // Subnormal: normalize first
+        x *= 8388608.0f;                          // 2^23
+        e_adjust = -23;
+    }
+    uint32_t bits = as_bits(x);
+    float e = static_cast<float>(static_cast<int>(bits >> 23) - 126 + e_adjust);
+    float m = as_float((bits & 0x807fffffu) | 0x3f000000u); // [0.5, 1)
+    if (m < kSqrtHalf) {
+        e -= 1.0f;
+        m = m + m - 1.0f;
+    } else {
+        m = m - 1.0f;
+    }
+
+    float z = m * m;
+    float y = kLogP[0];
+    for (int i = 1; i < 9; ++i) y = madd_scalar(y, m, kLogP[i]);
+    y = y * m * z;
+    y = madd_scalar(e, kLn2Lo, y);
+    y = madd_scalar(z, -0.5f, y);
+    return madd_scalar(e, kLn2Hi, m + y);
+}
+
+float exp_scalar(float x) {
+    if (x != x) return x;
+    if (x > kExpHi) return std::numeric_limits<float>::infinity();
+    if (x < kExpLo) x = kExpLo;
+
+    float n = std::floor(madd_scalar(x, kLog2e, 0.5f));
+    x = x - n * kLn2Hi;
+    x = x - n * kLn2Lo;
+    float z = x * x;
+    float y = kExpP[0];
+    for (int i = 1; i < 6; ++i) y = madd_scalar(y, x, kExpP[i]);
+    y = madd_scalar(y, z, x) + 1.0f;
+
+    // 2^n in two halves so that every factor stays a normal float
+    int ni = static_cast<int>(n);
+    int n1 = ni >> 1;
+    int n2 = ni - n1;
+    y *= as_float(static_cast<uint32_t>(n1 + 127) << 23);
+    return y * as_float(static_cast<uint32_t>(n2 + 127) << 23);
+}
+
+void sincos_scalar(float x, float* s, float* c) {
+    float ax = std::fabs(x);
+    if (!(ax <= kTrigMax)) { // Large or NaN
+        if (s) *s = std::sin(x);
+        if (c) *c = std::cos(x);
+        return;
+    }
+
+    int j = static_cast<int>(ax * kFourOverPi);
+    j = (j + 1) & ~1;
+    float y = static_cast<float>(j);
+    float r = ((ax - y * kPiQuarter1) - y * kPiQuarter2) - y * kPiQuarter3;
+
+    float z = r * r;
+    float pc = madd_scalar(madd_scalar(kCosP[0], z, kCosP[1]), z, kCosP[2]) * z * z - 0.5f * z + 1.0f;
+    float ps = madd_scalar(madd_scalar(madd_scalar(kSinP[0], z, kSinP[1]), z, kSinP[2]) * z, r, r);
+
+    if (s) {
+        float v = (j & 2) ? pc : ps;
+        bool negative = ((j & 4) != 0) != std::signbit(x);
+        *s = negative ? -v : v;
+    }
+    if (c) {
+        int jc = j - 2;
+        float v = (jc & 2) ? pc : ps;
+        *c = (jc & 4) ? v : -v;
+    }
+}
+
+float rsqrt_scalar(float x) {
+    return 1.0f / std::sqrt(x);
+}
+
+// ---------------------------------------------------------------------------
+// NEON
+// ---------------------------------------------------------------------------
+#ifdef HAS_NEON
+
+inline float32x4_t poly_neon(float32x4_t x, const float* c, int count) {
+    float32x4_t y = vdupq_n_f32(c[0]);
+    for (int i = 1; i < count; ++i) y = vmlaq_f32(vdupq_n_f32(c[i]), y, x);
+    return y;
+}
+
+inline float32x4_t floor_neon(float32x4_t x) {
+    float32x4_t t = vcvtq_f32_s32(vcvtq_s32_f32(x)); // Truncate
+    uint32x4_t greater = vcgtq_f32(t, x);
+    return vsubq_f32(t, vreinterpretq_f32_u32(vandq_u32(greater, vreinterpretq_u32_f32(vdupq_n_f32(1.0f)))));
+}
+
+float32x4_t log_neon(float32x4_t x) {
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    uint32x4_t invalid = vmvnq_u32(vcgtq_f32(x, vdupq_n_f32(0.0f))); // x <= 0 or NaN
+    uint32x4_t zero = vceqq_f32(x, vdupq_n_f32(0.0f));
+    uint32x4_t inf = vceqq_f32(x, vdupq_n_f32(std::numeric_limits<float>::infinity()));
+
+    // Subnormals: scale by 2^23
+    uint32x4_t sub = vcltq_f32(x, vdupq_n_f32(std::numeric_limits<float>::min()));
+    x = vbslq_f32(sub, vmulq_f32(x, vdupq_n_f32(8388608.0f)), x);
+    float32x4_t e_adjust = vbslq_f32(sub, vdupq_n_f32(-23.0f), vdupq_n_f32(0.0f));
+
+    uint32x4_t bits = vreinterpretq_u32_f32(x);
+    int32x4_t exponent = vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(bits, 23)), vdupq_n_s32(126));
+    float32x4_t e = vaddq_f32(vcvtq_f32_s32(exponent), e_adjust);
+    float32x4_t m = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(bits, vdupq_n_u32(0x807fffffu)),
+                                                    vdupq_n_u32(0x3f000000u)));
+
+    uint32x4_t small = vcltq_f32(m, vdupq_n_f32(kSqrtHalf));
+    e = vsubq_f32(e, vbslq_f32(small, one, vdupq_n_f32(0.0f)));
+    m = vsubq_f32(vaddq_f32(m, vbslq_f32(small, m, vdupq_n_f32(0.0f))), one);
+
+    float32x4_t z = vmulq_f32(m, m);
+    float32x4_t y = vmulq_f32(vmulq_f32(poly_neon(m, kLogP, 9), m), z);
+    y = vmlaq_f32(y, e, vdupq_n_f32(kLn2Lo));
+    y = vmlaq_f32(y, z, vdupq_n_f32(-0.5f));
+    float32x4_t r = vmlaq_f32(vaddq_f32(m, y), e, vdupq_n_f32(kLn2Hi));
+
+    r = vbslq_f32(invalid, vdupq_n_f32(std::numeric_limits<float>::quiet_NaN()), r);
+    r = vbslq_f32(zero, vdupq_n_f32(-std::numeric_limits<float>::infinity()), r);
+    return vbslq_f32(inf, x, r);
+}
+
+float32x4_t exp_neon(float32x4_t x) {
+    uint32x4_t nan = vmvnq_u32(vceqq_f32(x, x));
+    uint32x4_t over = vcgtq_f32(x, vdupq_n_f32(kExpHi));
+    float32x4_t input = x;
+    x = vmaxq_f32(vminq_f32(x, vdupq_n_f32(kExpHi)), vdupq_n_f32(kExpLo));
+
+    float32x4_t n = floor_neon(vmlaq_f32(vdupq_n_f32(0.5f), x, vdupq_n_f32(kLog2e)));
+    x = vmlsq_f32(x, n, vdupq_n_f32(kLn2Hi));
+    x = vmlsq_f32(x, n, vdupq_n_f32(kLn2Lo));
+    float32x4_t z = vmulq_f32(x, x);
+    float32x4_t y = vaddq_f32(vmlaq_f32(x, poly_neon(x, kExpP, 6), z), vdupq_n_f32(1.0f));
+
+    int32x4_t ni = vcvtq_s32_f32(n);
+    int32x4_t n1 = vshrq_n_s32(ni, 1);
+    int32x4_t n2 = vsubq_s32(ni, n1);
+    y = vmulq_f32(y, vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(n1, vdupq_n_s32(127)), 23)));
+    y = vmulq_f32(y, vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(n2, vdupq_n_s32(127)), 23)));
+
+    y = vbslq_f32(over, vdupq_n_f32(std::numeric_limits<float>::infinity()), y);
+    return vbslq_f32(nan, input, y);
+}
+
+// Returns false if a lane needs the scalar fallback (|x| > kTrigMax or NaN)
+bool sincos_neon(float32x4_t x, float32x4_t* s, float32x4_t* c) {
+    float32x4_t ax = vabsq_f32(x);
+    uint32x4_t in_range = vcleq_f32(ax, vdupq_n_f32(kTrigMax));
+
+    uint32x4_t j = vcvtq_u32_f32(vmulq_f32(ax, vdupq_n_f32(kFourOverPi)));
+    j = vandq_u32(vaddq_u32(j, vdupq_n_u32(1)), vdupq_n_u32(~1u));
+    float32x4_t y = vcvtq_f32_u32(j);
+    float32x4_t r = vmlsq_f32(ax, y, vdupq_n_f32(kPiQuarter1));
+    r = vmlsq_f32(r, y, vdupq_n_f32(kPiQuarter2));
+    r = vmlsq_f32(r, y, vdupq_n_f32(kPiQuarter3));
+
+    float32x4_t z = vmulq_f32(r, r);
+    float32x4_t pc = vmulq_f32(vmulq_f32(poly_neon(z, kCosP, 3), z), z);
+    pc = vaddq_f32(vmlsq_f32(pc, z, vdupq_n_f32(0.5f)), vdupq_n_f32(1.0f));
+    float32x4_t ps = vmlaq_f32(r, vmulq_f32(poly_neon(z, kSinP, 3), z), r);
+
+    if (s) {
+        uint32x4_t use_cos = vtstq_u32(j, vdupq_n_u32(2));
+        float32x4_t v = vbslq_f32(use_cos, pc, ps);
+        uint32x4_t sign = veorq_u32(vshlq_n_u32(vandq_u32(j, vdupq_n_u32(4)), 29),
+                                    vandq_u32(vreinterpretq_u32_f32(x), vdupq_n_u32(0x80000000u)));
+        *s = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(v), sign));
+    }
+    if (c) {
+        uint32x4_t jc = vsubq_u32(j, vdupq_n_u32(2));
+        uint32x4_t use_cos = vtstq_u32(jc, vdupq_n_u32(2));
+        float32x4_t v = vbslq_f32(use_cos, pc, ps);
+        uint32x4_t sign = vshlq_n_u32(vandq_u32(vmvnq_u32(jc), vdupq_n_u32(4)), 29);
+        *c = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(v), sign));
+    }
+
+    uint32x2_t folded = vand_u32(vget_low_u32(in_range), vget_high_u32(in_range));
+    return (vget_lane_u32(folded, 0) & vget_lane_u32(folded, 1)) != 0;
+}
+
+#endif // HAS_NEON
+
+// ---------------------------------------------------------------------------
+// AVX2
+// ---------------------------------------------------------------------------
+#if defined(__AVX2__) && !defined(HAS_NEON)
+
+inline __m256 madd(__m256 a, __m256 b, __m256 c) {
+#ifdef __FMA__
+    return _mm256_fmadd_ps(a, b, c);
+#else
+    return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+}
+
+inline __m256 poly_avx(__m256 x, const float* c, int count) {
+    __m256 y = _mm256_set1_ps(c[0]);
+    for (int i = 1; i < count; ++i) y = madd(y, x, _mm256_set1_ps(c[i]));
+    return y;
+}
+
+__m256 log_avx(__m256 x) {
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 zero_v = _mm256_setzero_ps();
+    __m256 invalid = _mm256_cmp_ps(x, zero_v, _CMP_NGT_UQ);  // x <= 0 or NaN
+    __m256 zero = _mm256_cmp_ps(x, zero_v, _CMP_EQ_OQ);
+    __m256 inf = _mm256_cmp_ps(x, _mm256_set1_ps(std::numeric_limits<float>::infinity()), _CMP_EQ_OQ);
+
+    __m256 sub = _mm256_cmp_ps(x, _mm256_set1_ps(std::numeric_limits<float>::min()), _CMP_LT_OQ);
+    x = _mm256_blendv_ps(x, _mm256_mul_ps(x, _mm256_set1_ps(8388608.0f)), sub);
+    __m256 e_adjust = _mm256_and_ps(sub, _mm256_set1_ps(-23.0f));
+
+    __m256i bits = _mm256_castps_si256(x);
+    __m256i exponent = _mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(126));
+    __m256 e = _mm256_add_ps(_mm256_cvtepi32_ps(exponent), e_adjust);
+    __m256 m = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x807fffff)),
+                                                   _mm256_set1_epi32(0x3f000000)));
+
+    __m256 small = _mm256_cmp_ps(m, _mm256_set1_ps(kSqrtHalf), _CMP_LT_OQ);
+    e = _mm256_sub_ps(e, _mm256_and_ps(small, one));
+    m = _mm256_sub_ps(_mm256_add_ps(m, _mm256_and_ps(small, m)), one);
+
+    __m256 z = _mm256_mul_ps(m, m);
+    __m256 y = _mm256_mul_ps(_mm256_mul_ps(poly_avx(m, kLogP, 9), m), z);
+    y = madd(e, _mm256_set1_ps(kLn2Lo), y);
+    y = madd(z, _mm256_set1_ps(-0.5f), y);
+    __m256 r = madd(e, _mm256_set1_ps(kLn2Hi), _mm256_add_ps(m, y));
+
+    r = _mm256_blendv_ps(r, _mm256_set1_ps(std::numeric_limits<float>::quiet_NaN()), invalid);
+    r = _mm256_blendv_ps(r, _mm256_set1_ps(-std::numeric_limits<float>::infinity()), zero);
+    return _mm256_blendv_ps(r, x, inf);
+}
+
+__m256 exp_avx(__m256 x) {
+    __m256 nan = _mm256_cmp_ps(x, x, _CMP_UNORD_Q);
+    __m256 over = _mm256_cmp_ps(x, _mm256_set1_ps(kExpHi), _CMP_GT_OQ);
+    __m256 input = x;
+    x = _mm256_max_ps(_mm256_min_ps(x, _mm256_set1_ps(kExpHi)), _mm256_set1_ps(kExpLo));
+
+    __m256 n = _mm256_floor_ps(madd(x, _mm256_set1_ps(kLog2e), _mm256_set1_ps(0.5f)));
+    x = _mm256_sub_ps(x, _mm256_mul_ps(n, _mm256_set1_ps(kLn2Hi)));
+    x = _mm256_sub_ps(x, _mm256_mul_ps(n, _mm256_set1_ps(kLn2Lo)));
+    __m256 z = _mm256_mul_ps(x, x);
+    __m256 y = _mm256_add_ps(madd(poly_avx(x, kExpP, 6), z, x), _mm256_set1_ps(1.0f));
+
+    __m256i ni = _mm256_cvtps_epi32(n);
+    __m256i n1 = _mm256_srai_epi32(ni, 1);
+    __m256i n2 = _mm256_sub_epi32(ni, n1);
+    const __m256i bias = _mm256_set1_epi32(127);
+    y = _mm256_mul_ps(y, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(n1, bias), 23)));
+    y = _mm256_mul_ps(y, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(n2, bias), 23)));
+
+    y = _mm256_blendv_ps(y, _mm256_set1_ps(std::numeric_limits<float>::infinity()), over);
+    return _mm256_blendv_ps(y, input, nan);
+}
+
+// Returns false if a lane needs the scalar fallback (|x| > kTrigMax or NaN)
+bool sincos_avx(__m256 x, __m256* s, __m256* c) {
+    const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+    __m256 ax = _mm256_andnot_ps(sign_mask, x);
+    __m256 in_range = _mm256_cmp_ps(ax, _mm256_set1_ps(kTrigMax), _CMP_LE_OQ);
+    ax = _mm256_and_ps(ax, in_range); // Keep the conversion below in int range
+
+    __m256i j = _mm256_cvttps_epi32(_mm256_mul_ps(ax, _mm256_set1_ps(kFourOverPi)));
+    j = _mm256_and_si256(_mm256_add_epi32(j, _mm256_set1_epi32(1)), _mm256_set1_epi32(~1));
+    __m256 y = _mm256_cvtepi32_ps(j);
+    __m256 r = _mm256_sub_ps(ax, _mm256_mul_ps(y, _mm256_set1_ps(kPiQuarter1)));
+    r = _mm256_sub_ps(r, _mm256_mul_ps(y, _mm256_set1_ps(kPiQuarter2)));
+    r = _mm256_sub_ps(r, _mm256_mul_ps(y, _mm256_set1_ps(kPiQuarter3)));
+
+    __m256 z = _mm256_mul_ps(r, r);
+    __m256 pc = _mm256_mul_ps(_mm256_mul_ps(poly_avx(z, kCosP, 3), z), z);
+    pc = _mm256_add_ps(_mm256_sub_ps(pc, _mm256_mul_ps(z, _mm256_set1_ps(0.5f))), _mm256_set1_ps(1.0f));
+    __m256 ps = madd(_mm256_mul_ps(poly_avx(z, kSinP, 3), z), r, r);
+
+    const __m256i two = _mm256_set1_epi32(2);
+    const __m256i four = _mm256_set1_epi32(4);
+    if (s) {
+        __m256 use_cos = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(j, two), two));
+        __m256 v = _mm256_blendv_ps(ps, pc, use_cos);
+        __m256 sign = _mm256_xor_ps(_mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(j, four), 29)),
+                                    _mm256_and_ps(x, sign_mask));
+        *s = _mm256_xor_ps(v, sign);
+    }
+    if (c) {
+        __m256i jc = _mm256_sub_epi32(j, two);
+        __m256 use_cos = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(jc, two), two));
+        __m256 v = _mm256_blendv_ps(ps, pc, use_cos);
+        __m256 sign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_andnot_si256(jc, four), 29));
+        *c = _mm256_xor_ps(v, sign);
+    }
+    return _mm256_movemask_ps(in_range) == 0xff;
+}
+
+#endif // __AVX2__
+
+} // namespace
+
+void VectorMath::log(const float* input, float* output, size_t size) {
+    size_t i = 0;
+#ifdef HAS_NEON
+    for (; i + 3 < size; i += 4) {
+        vst1q_f32(output + i, log_neon(vld1q_f32(input + i)));
+    }
+#elif defined(__AVX2__)
+    for (; i + 7 < size; i += 8) {
+        _mm256_storeu_ps(output + i, log_avx(_mm256_loadu_ps(input + i)));
+    }
+#endif
+    for (; i < size; ++i) {
+        output[i] = log_scalar(input[i]);
+    }
+}
+
+void VectorMath::exp(const float* input, float* output, size_t size) {
+    size_t i = 0;
+#ifdef HAS_NEON
+    for (; i + 3 < size; i += 4) {
+        vst1q_f32(output + i, exp_neon(vld1q_f32(input + i)));
+    }
+#elif defined(__AVX2__)
+    for (; i + 7 < size; i += 8) {
+        _mm256_storeu_ps(output + i, exp_avx(_mm256_loadu_ps(input + i)));
+    }
+#endif
+    for (; i < size; ++i) {
+        output[i] = exp_scalar(input[i]);
+    }
+}
+
+void VectorMath::sincos(const float* input, float* sin_out, float* cos_out, size_t size) {
+    size_t i = 0;
+#ifdef HAS_NEON
+    for (; i + 3 < size; i += 4) {
+        float32x4_t x = vld1q_f32(input + i);
+        float32x4_t s, c;
+        bool ok = sincos_neon(x, sin_out ? &s : nullptr, cos_out ? &c : nullptr);
+        if (ok) {
+            if (sin_out) vst1q_f32(sin_out + i, s);
+            if (cos_out) vst1q_f32(cos_out + i, c);
+        } else {
+            float lanes[4];
+            vst1q_f32(lanes, x);
+            for (size_t k = 0; k < 4; ++k) {
+                sincos_scalar(lanes[k], sin_out ? sin_out + i + k : nullptr, cos_out ? cos_out + i + k : nullptr);
+            }
+        }
+    }
+#elif defined(__AVX2__)
+    for (; i + 7 < size; i += 8) {
+        __m256 x = _mm256_loadu_ps(input + i);
+        __m256 s, c;
+        bool ok = sincos_avx(x, sin_out ? &s : nullptr, cos_out ? &c : nullptr);
+        if (ok) {
+            if (sin_out) _mm256_storeu_ps(sin_out + i, s);
+            if (cos_out) _mm256_storeu_ps(cos_out + i, c);
+        } else {
+            float lanes[8];
+            _mm256_storeu_ps(lanes, x);
+            for (size_t k = 0; k < 8; ++k) {
+                sincos_scalar(lanes[k], sin_out ? sin_out + i + k : nullptr, cos_out ? cos_out + i + k : nullptr);
+            }
+        }
+    }
+#endif
+    for (; i < size; ++i) {
+        // Copy first: sin_out may alias input
+        float x = input[i];
+        sincos_scalar(x, sin_out ? sin_out + i : nullptr, cos_out ? cos_out + i : nullptr);
+    }
+}
+
+void VectorMath::sin(const float* input, float* output, size_t size) {
+    sincos(input, output, nullptr, size);
+}
+
+void VectorMath::cos(const float* input, float* output, size_t size) {
+    sincos(input, nullptr, output, size);
+}
+
+void VectorMath::sqrt(const float* input, float* output, size_t size) {
+    size_t i = 0;
+#if defined(HAS_NEON) && defined(__aarch64__)
+    for (; i + 3 < size; i += 4) {
+        vst1q_f32(output + i, vsqrtq_f32(vld1q_f32(input + i)));
+    }
+#elif defined(__AVX2__)
+    for (; i + 7 < size; i += 8) {
+        _mm256_storeu_ps(output + i, _mm256_sqrt_ps(_mm256_loadu_ps(input + i)));
+    }
+#endif
+    for (; i < size; ++i) {
+        output[i] = std::sqrt(input[i]);
+    }
+}
+
+void VectorMath::rsqrt(const float* input, float* output, size_t size) {
+    // A correctly rounded sqrt followed by a correctly rounded divide gives the same
+    // bits as the scalar tail, including 0, inf and subnormals. The estimate +
+    // Newton-Raphson route is faster but turns 0 and inf into 0 * inf = NaN.
+    size_t i = 0;
+#if defined(HAS_NEON) && defined(__aarch64__)
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    for (; i + 3 < size; i += 4) {
+        vst1q_f32(output + i, vdivq_f32(one, vsqrtq_f32(vld1q_f32(input + i))));
+    }
+#elif defined(__AVX2__)
+    const __m256 one = _mm256_set1_ps(1.0f);
+    for (; i + 7 < size; i += 8) {
+        _mm256_storeu_ps(output + i, _mm256_div_ps(one, _mm256_sqrt_ps(_mm256_loadu_ps(input + i))));
+    }
+#endif
+    for (; i < size; ++i) {
+        output[i] = rsqrt_scalar(input[i]);
+    }
+}
+
+} // namespace signal
+} // namespace minni
@@ -0,0 +1,51 @@
+#ifndef MINNI_CORE_SIGNAL_VECTOR_MATH_H_
+#define MINNI_CORE_SIGNAL_VECTOR_MATH_H_
+
+#include <cstddef>
+
+namespace minni {
+namespace signal {
+
+/**
+ * Vectorized float transcendentals over arrays (NEON on ARM, AVX2 on x86).
+ * Cephes-style range reduction + minimax polynomials; the scalar tail runs the
+ * same algorithm with the same roundings (fused multiply-add where the vector
+ * path fuses), so results do not depend on the array length or alignment.
+ * All functions accept output == input (in place).
+ *
+ * Maximum error against correctly rounded results, measured over the stated
+ * domain (see test_vector_math.cpp):
+ *   log    <= 1 ulp   x > 0 (incl. subnormals); log(0) = -inf, log(x < 0) = NaN
+ *   exp    <= 2 ulp   |x| <= 87.3; gradual underflow below, +inf above 88.72
+ *   sin    <= 2 ulp, or 2e-7 absolute near the zeros of sin, |x| <= 8192
+ *   cos    same as sin; |x| > 8192 falls back to std::sin / std::cos per element
+ *   sqrt   correctly rounded (hardware)
+ *   rsqrt  <= 1.5 ulp x >= 0 (1 / sqrt, two roundings); 0 -> +inf, inf -> 0
+ */
+class VectorMath {
+public:
+    static void log(const float* input, float* output, size_t size);
+
+    static void exp(const float* input, float* output, size_t size);
+
+    static void sin(const float* input, float* output, size_t size);
+
+    static void cos(const float* input, float* output, size_t size);
+
+    /**
+     * sin and cos of the same arguments in one pass (shared range reduction).
+     */
+    static void sincos(const float* input, float* sin_out, float* cos_out, size_t size);
+
+    static void sqrt(const float* input, float* output, size_t size);
+
+    /**
+     * 1 / sqrt(x).
+     */
+    static void rsqrt(const float* input, float* output, size_t size);
+};
+
+} // namespace signal
+} // namespace minni
+
+#endif // MINNI_CORE_SIGNAL_VECTOR_MATH_H_
@@ -0,0 +1,62 @@
+#ifndef MINNI_TESTING_UNIT_CORE_LOGIC_CNF_FIXTURES_H_
+#define MINNI_TESTING_UNIT_CORE_LOGIC_CNF_FIXTURES_H_
+
+#include "../../../../src/core/logic/CdclSolver.h"
+#include <vector>
+
+/**
+ * CNF instances shared by the SAT solver tests.
+ */
+
+using Cnf = std::vector<std::vector<minni::logic::Lit>>;
+
+// Deterministic generator
+struct Rng {
+    unsigned state;
+    unsigned next(unsigned bound) {
+        state = state * 1103515245u + 12345u;
+        return ((state >> 8) & 0xffffff) % bound;
+    }
+};
+
+// Random 3-SAT; with a planted assignment every clause is made to hold under it
+inline Cnf random_3sat(unsigned vars, unsigned clauses, unsigned seed,
+                       const std::vector<bool>* planted = nullptr) {
+    Rng rng{seed};
+    Cnf cnf;
+    while (cnf.size() < clauses) {
+        std::vector<minni::logic::Lit> c;
+        bool sat = false;
+        for (int k = 0; k < 3; ++k) {
+            unsigned v = rng.next(vars);
+            bool neg = rng.next(2) != 0;
+            c.push_back(minni::logic::make_lit(v, neg));
+            if (planted && (*planted)[v] != neg) sat = true;
+        }
+        if (planted && !sat) continue;
+        cnf.push_back(c);
+    }
+    return cnf;
+}
+
+// Pigeonhole principle: pigeons > holes is UNSAT and exponential for resolution
+inline Cnf pigeonhole(unsigned pigeons, unsigned holes) {
+    using minni::logic::make_lit;
+    Cnf cnf;
+    auto var = [&](unsigned p, unsigned h) { return p * holes + h; };
+    for (unsigned p = 0; p < pigeons; ++p) {
+        std::vector<minni::logic::Lit> c;
+        for (unsigned h = 0; h < holes; ++h) c.push_back(make_lit(var(p, h)));
+        cnf.push_back(c);
+    }
+    for (unsigned h = 0; h < holes; ++h) {
+        for (unsigned p = 0; p < pigeons; ++p) {
+            for (unsigned q = p + 1; q < pigeons; ++q) {
+                cnf.push_back({make_lit(var(p, h), true), make_lit(var(q, h), true)});
+            }
+        }
+    }
+    return cnf;
+}
+
+#endif // MINNI_TESTING_UNIT_CORE_LOGIC_CNF_FIXTURES_H_
@@ -0,0 +1,129 @@
+#include "../../../../src/core/logic/DimacsReader.h"
+#include "../../../../src/core/logic/SatSolver.h"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace minni::logic;
+
+using Cnf = std::vector<std::vector<Lit>>;
+
+static DimacsReader::ClauseHandler collect(Cnf& out) {
+    return [&out](const Lit* lits, size_t size) { out.emplace_back(lits, lits + size); };
+}
+
+void test_dimacs_parse() {
+    std::cout << "Running DIMACS Parse Test..." << std::endl;
+    const std::string text =
+        "c example\n"
+        "p cnf 4 3\n"
+        "1 -2 0\n"
+        "c comment between clauses\n"
+        "  -3 4\n"
+        "   2 0 -1\r\n"
+        "-4\n"
+        "%\n"
+        "0\n";
+
+    // Whole buffer and one byte at a time give the same clauses
+    Cnf whole, bytes;
+    DimacsReader a(collect(whole));
+    assert(a.read(text.data(), text.size()));
+    DimacsReader b(collect(bytes));
+    for (char ch : text) assert(b.feed(&ch, 1));
+    assert(b.finish());
+    assert(whole == bytes);
+
+    assert(a.header_vars() == 4 && a.header_clauses() == 3);
+    assert(a.num_clauses() == 3 && a.num_vars() == 4);
+    assert(whole[0] == (std::vector<Lit>{make_lit(0), make_lit(1, true)}));
+    assert(whole[1] == (std::vector<Lit>{make_lit(2, true), make_lit(3), make_lit(1)}));
+    assert(whole[2] == (std::vector<Lit>{make_lit(0, true), make_lit(3, true)})); // No final 0
+
+    // Errors carry the line number
+    Cnf ignored;
+    DimacsReader bad(collect(ignored));
+    const std::string broken = "p cnf 2 1\n1 x 0\n";
+    assert(!bad.read(broken.data(), broken.size()));
+    assert(bad.error().find("line 2") == 0);
+    DimacsReader bad_header(collect(ignored));
+    const std::string header = "p dnf 2 1\n1 0\n";
+    assert(!bad_header.read(header.data(), header.size()));
+    std::cout << "DIMACS Parse Test Passed!" << std::endl;
+}
+
+void test_dimacs_file() {
+    std::cout << "Running DIMACS File Test..." << std::endl;
+    // ~10 MB random 3-CNF
+    const std::string path = "test_dimacs.cnf";
+    const unsigned vars = 100000, clauses = 700000;
+    std::FILE* f = std::fopen(path.c_str(), "wb");
+    assert(f);
+    std::fprintf(f, "c generated\np cnf %u %u\n", vars, clauses);
+    unsigned state = 1;
+    for (unsigned c = 0; c < clauses; ++c) {
+        for (int k = 0; k < 3; ++k) {
+            state = state * 1103515245u + 12345u;
+            unsigned v = 1 + (state >> 8) % vars;
+            std::fprintf(f, "%s%u ", (state & 0x10000) ? "-" : "", v);
+        }
+        std::fprintf(f, "0\n");
+    }
+    long bytes = std::ftell(f);
+    std::fclose(f);
+
+    size_t count = 0, literals = 0;
+    DimacsReader reader([&](const Lit*, size_t size) { ++count; literals += size; });
+    auto start = std::chrono::high_resolution_clock::now();
+    assert(reader.read_file(path));
+    auto end = std::chrono::high_resolution_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(end - start).count();
+    std::cout << "  " << bytes / 1e6 << " MB in " << ms << " ms ("
+              << bytes / 1e3 / ms << " MB/s)" << std::endl;
+    assert(count == clauses && literals == 3u * clauses);
+    assert(reader.num_vars() == vars);
+    std::remove(path.c_str());
+
+    DimacsReader missing(nullptr);
+    assert(!missing.read_file("does_not_exist.cnf"));
+    assert(!missing.error().empty());
+    std::cout << "DIMACS File Test Passed!" << std::endl;
+}
+
+void test_sat_solver_front_ends() {
+    std::cout << "Running SatSolver Front End Test..." << std::endl;
+    for (const char* mode : {"cdcl", "dpll"}) {
+        SatSolver solver;
+        solver.set_param("mode", mode);
+
+        // Symbolic names with parentheses and double negation
+        assert(solver.check("(door_open | !!alarm) & (!door_open) & (alarm | light)") ==
+               SolverStatus::SATISFIABLE);
+        auto model = solver.get_model();
+        assert(model.size() == 3);
+        assert(model["door_open"] == "false");
+        assert(model["alarm"] == "true");
+        assert(solver.variable_id("door_open") == 0);
+        assert(solver.variable_id("light") == 2);
+        assert(solver.variable_id("missing") == -1);
+
+        // DIMACS text: variables reported by number
+        assert(solver.check("c x\np cnf 3 3\n1 2 0\n-1 0\n-2 3 0\n") == SolverStatus::SATISFIABLE);
+        model = solver.get_model();
+        assert(model["1"] == "false" && model["2"] == "true" && model["3"] == "true");
+        assert(solver.check("p cnf 1 2\n1 0\n-1 0\n") == SolverStatus::UNSATISFIABLE);
+        assert(solver.get_model().empty());
+        assert(solver.check("p cnf 1 1\n1 q 0\n") == SolverStatus::UNKNOWN);
+    }
+    std::cout << "SatSolver Front End Test Passed!" << std::endl;
+}
+
+int main() {
+    test_dimacs_parse();
+    test_dimacs_file();
+    test_sat_solver_front_ends();
+    return 0;
+}
@@ -0,0 +1,349 @@
+#include "../../../../src/core/logic/SatSolver.h"
+#include "../../../../src/core/logic/CdclSolver.h"
+#include "../../../../src/core/logic/DratWriter.h"
+#include "cnf_fixtures.h"
+#include <iostream>
+#include <cassert>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using minni::logic::CdclSolver;
+using minni::logic::DratWriter;
+using minni::logic::Lit;
+using minni::logic::make_lit;
+using minni::logic::lit_var;
+using minni::logic::lit_negated;
+using minni::logic::SatSolver;
+using minni::logic::SolverStatus;
+
+struct Step {
+    bool deletion;
+    std::vector<Lit> lits;
+};
+
+static std::string to_dimacs(const Cnf& cnf, unsigned vars) {
+    std::string text = "p cnf " + std::to_string(vars) + " " + std::to_string(cnf.size()) + "\n";
+    for (const auto& c : cnf) {
+        for (Lit l : c) text += (lit_negated(l) ? "-" : "") + std::to_string(lit_var(l) + 1) + " ";
+        text += "0\n";
+    }
+    return text;
+}
+
+static Lit from_dimacs(long n) {
+    return make_lit(static_cast<uint32_t>(std::labs(n) - 1), n < 0);
+}
+
+static std::vector<Step> read_text_proof(const std::string& path) {
+    std::vector<Step> steps;
+    std::ifstream in(path);
+    std::string line;
+    while (std::getline(in, line)) {
+        std::istringstream tokens(line);
+        Step step{false, {}};
+        std::string token;
+        while (tokens >> token) {
+            if (token == "d") {
+                step.deletion = true;
+                continue;
+            }
+            const long n = std::stol(token);
+            if (n == 0) break;
+            step.lits.push_back(from_dimacs(n));
+        }
+        steps.push_back(step);
+    }
+    return steps;
+}
+
+static std::vector<Step> read_binary_proof(const std::string& path) {
+    std::vector<Step> steps;
+    std::ifstream in(path, std::ios::binary);
+    int tag;
+    while ((tag = in.get()) != EOF) {
+        assert(tag == 'a' || tag == 'd');
+        Step step{tag == 'd', {}};
+        for (;;) {
+            uint32_t code = 0;
+            int shift = 0, byte;
+            do {
+                byte = in.get();
+                assert(byte != EOF);
+                code |= static_cast<uint32_t>(byte & 0x7f) << shift;
+                shift += 7;
+            } while (byte & 0x80);
+            if (code == 0) break;
+            step.lits.push_back(make_lit(code / 2 - 1, (code & 1) != 0));
+        }
+        steps.push_back(step);
+    }
+    return steps;
+}
+
+// Unit propagation over the whole database after assigning the negation of `clause`
+static bool implied_by_propagation(const Cnf& db, const std::vector<Lit>& clause, uint32_t vars) {
+    std::vector<int8_t> value(vars, 0);   // +1 true, -1 false
+    auto val = [&value](Lit l) -> int {
+        const int v = value[lit_var(l)];
+        return lit_negated(l) ? -v : v;
+    };
+    for (Lit l : clause) {
+        if (val(l) > 0) return true;   // Tautology
+        value[lit_var(l)] = lit_negated(l) ? 1 : -1;
+    }
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (const auto& c : db) {
+            size_t unassigned = 0;
+            Lit last = 0;
+            bool sat = false;
+            for (Lit l : c) {
+                if (val(l) > 0) { sat = true; break; }
+                if (val(l) == 0) { ++unassigned; last = l; }
+            }
+            if (sat) continue;
+            if (unassigned == 0) return true;
+            if (unassigned == 1) {
+                value[lit_var(last)] = lit_negated(last) ? -1 : 1;
+                changed = true;
+            }
+        }
+    }
+    return false;
+}
+
+// Naive DRUP check: every addition is implied by unit propagation, deletions remove a
+// matching clause, and the empty clause is derived
+static bool check_proof(Cnf db, const std::vector<Step>& steps, uint32_t vars) {
+    for (auto& c : db) {   // Repeated literals would hide units from the propagation above
+        std::sort(c.begin(), c.end());
+        c.erase(std::unique(c.begin(), c.end()), c.end());
+    }
+    for (const Step& step : steps) {
+        for (Lit l : step.lits) vars = std::max(vars, lit_var(l) + 1);
+    }
+    for (const Step& step : steps) {
+        std::vector<Lit> sorted = step.lits;
+        std::sort(sorted.begin(), sorted.end());
+        if (step.deletion) {
+            auto it = std::find_if(db.begin(), db.end(), [&sorted](std::vector<Lit> c) {
+                std::sort(c.begin(), c.end());
+                return c == sorted;
+            });
+            if (it == db.end()) return false;
+            db.erase(it);
+            continue;
+        }
+        if (!implied_by_propagation(db, step.lits, vars)) return false;
+        if (step.lits.empty()) return true;
+        db.push_back(step.lits);
+    }
+    return false;
+}
+
+void test_drat_writer() {
+    std::cout << "Running DRAT Writer Test..." << std::endl;
+    const std::string text_path = "test_drat_writer.drat";
+    const std::string binary_path = "test_drat_writer.bin";
+
+    const Lit clause[] = {make_lit(0), make_lit(1, true), make_lit(199)};
+    DratWriter text;
+    assert(text.open(text_path, DratWriter::Format::TEXT));
+    text.add(clause, 3);
+    text.remove(clause, 2);
+    text.add(nullptr, 0);
+    assert(text.close());
+    std::ifstream in(text_path);
+    std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    assert(content == "1 -2 200 0\nd 1 -2 0\n0\n");
+    assert(text.bytes_written() == content.size());
+
+    // Binary: 200 = 2 * 200 needs two varint bytes; more than one buffer's worth of data
+    DratWriter binary;
+    assert(binary.open(binary_path, DratWriter::Format::BINARY));
+    for (int i = 0; i < 20000; ++i) binary.add(clause, 3);
+    binary.remove(clause, 3);
+    assert(binary.close());
+    assert(binary.bytes_written() == 20001u * 6);
+    const std::vector<Step> steps = read_binary_proof(binary_path);
+    assert(steps.size() == 20001);
+    assert(!steps[0].deletion && steps.back().deletion);
+    assert(steps[0].lits == std::vector<Lit>(clause, clause + 3));
+
+    DratWriter unwritable;
+    assert(!unwritable.open("no_such_directory/proof.drat", DratWriter::Format::TEXT));
+    unwritable.add(clause, 3);   // Ignored while closed
+    assert(unwritable.close());
+
+    std::remove(text_path.c_str());
+    std::remove(binary_path.c_str());
+    std::cout << "DRAT Writer Test Passed!" << std::endl;
+}
+
+void test_proof_verifies() {
+    std::cout << "Running DRAT Proof Verification Test..." << std::endl;
+    const std::string path = "test_proof.drat";
+
+    // Pigeonhole: UNSAT needs learning; small reduction intervals make deletions appear
+    const Cnf php = pigeonhole(6, 5);
+    {
+        SatSolver solver;
+        solver.set_param("proof", path);
+        solver.set_param("proof_format", "text");
+        assert(solver.check(to_dimacs(php, 30)) == SolverStatus::UNSATISFIABLE);
+        const std::vector<Step> steps = read_text_proof(path);
+        assert(!steps.empty() && steps.back().lits.empty());
+        assert(check_proof(php, steps, 30));
+        assert(std::stoull(solver.get_stats()["proof_bytes"]) > 0);
+    }
+
+    // Random 3-SAT well above the threshold, straight on the engine with deletions
+    size_t verified = 0;
+    for (unsigned seed = 1; seed <= 6; ++seed) {
+        const Cnf cnf = random_3sat(40, 240, seed);
+        CdclSolver::Options options;
+        options.reduce_first = 20;
+        options.reduce_increment = 10;
+        CdclSolver engine(options);
+        DratWriter proof;
+        assert(proof.open(path, DratWriter::Format::TEXT));
+        engine.set_proof(&proof);
+        for (unsigned v = 0; v < 40; ++v) engine.new_var();
+        for (const auto& c : cnf) engine.add_clause(c);
+        const SolverStatus status = engine.solve();
+        assert(proof.close());
+        if (status != SolverStatus::UNSATISFIABLE) continue;
+        const std::vector<Step> steps = read_text_proof(path);
+        assert(check_proof(cnf, steps, 40));
+        if (engine.stats().deleted > 0) {
+            assert(std::any_of(steps.begin(), steps.end(), [](const Step& s) { return s.deletion; }));
+        }
+        ++verified;
+    }
+    assert(verified > 0);
+
+    // Clauses shortened by level-0 facts and a unit conflict while adding
+    {
+        SatSolver solver;
+        solver.set_param("proof", path);
+        solver.set_param("proof_format", "text");
+        assert(solver.check("a & (!a | b) & (!b | c | !a) & (!c | !b)") == SolverStatus::UNSATISFIABLE);
+        const Cnf input = {{make_lit(0)},
+                           {make_lit(0, true), make_lit(1)},
+                           {make_lit(1, true), make_lit(2), make_lit(0, true)},
+                           {make_lit(2, true), make_lit(1, true)}};
+        assert(check_proof(input, read_text_proof(path), 3));
+    }
+
+    // Binary output is the same proof
+    {
+        SatSolver solver;
+        solver.set_param("proof", path);
+        solver.set_param("proof_format", "text");
+        assert(solver.check(to_dimacs(php, 30)) == SolverStatus::UNSATISFIABLE);
+        const std::vector<Step> text = read_text_proof(path);
+        solver.set_param("proof_format", "binary");
+        assert(solver.check(to_dimacs(php, 30)) == SolverStatus::UNSATISFIABLE);
+        const std::vector<Step> binary = read_binary_proof(path);
+        assert(text.size() == binary.size());
+        for (size_t i = 0; i < text.size(); ++i) {
+            assert(text[i].deletion == binary[i].deletion && text[i].lits == binary[i].lits);
+        }
+        // SAT answers still come with a model; the file holds whatever was learned
+        assert(solver.check("(x | y) & (!x | y)") == SolverStatus::SATISFIABLE);
+        assert(solver.get_model()["y"] == "true");
+    }
+
+    // A proof that cannot be written makes the answer unusable
+    {
+        SatSolver solver;
+        solver.set_param("proof", "no_such_directory/proof.drat");
+        assert(solver.check(to_dimacs(php, 30)) == SolverStatus::UNKNOWN);
+        solver.set_param("proof", "");
+        assert(solver.check(to_dimacs(php, 30)) == SolverStatus::UNSATISFIABLE);
+    }
+
+    std::remove(path.c_str());
+    std::cout << "DRAT Proof Verification Test Passed!" << std::endl;
+}
+
+void test_solver_stats() {
+    std::cout << "Running Solver Statistics Test..." << std::endl;
+    const Cnf php = pigeonhole(7, 6);
+
+    CdclSolver::Options options;
+    options.reduce_first = 100;
+    options.reduce_increment = 50;
+    options.timing = true;
+    CdclSolver engine(options);
+    for (const auto& c : php) engine.add_clause(c);
+    assert(engine.solve() == SolverStatus::UNSATISFIABLE);
+    const CdclSolver::Stats& s = engine.stats();
+    assert(s.conflicts == engine.num_conflicts() && s.decisions == engine.num_decisions());
+    assert(s.learned > 0 && s.learned <= s.conflicts);
+    assert(s.learned_literals >= s.learned && s.learned_max * s.learned >= s.learned_literals);
+    assert(s.restarts > 0 && s.reductions > 0 && s.deleted > 0);
+    assert(s.solve_ms > 0 && s.propagate_ms > 0 && s.analyze_ms > 0);
+    assert(s.propagate_ms + s.analyze_ms + s.reduce_ms <= s.solve_ms * 1.01);
+
+    CdclSolver::Stats twice = s;
+    twice += s;
+    assert(twice.conflicts == 2 * s.conflicts && twice.learned_max == s.learned_max);
+    assert((twice - s).conflicts == s.conflicts);
+
+    // Timing off: counters only
+    options.timing = false;
+    CdclSolver quiet(options);
+    for (const auto& c : php) quiet.add_clause(c);
+    assert(quiet.solve() == SolverStatus::UNSATISFIABLE);
+    assert(quiet.stats().conflicts == s.conflicts);   // Same search either way
+    assert(quiet.stats().propagate_ms == 0 && quiet.stats().analyze_ms == 0);
+
+    // Through SatSolver, check() starts the count over and incremental calls accumulate
+    CdclSolver plain;
+    for (const auto& c : php) plain.add_clause(c);
+    assert(plain.solve() == SolverStatus::UNSATISFIABLE);
+    SatSolver solver;
+    solver.set_param("stats", "true");
+    solver.set_param("preprocess", "false");
+    assert(solver.check(to_dimacs(php, 42)) == SolverStatus::UNSATISFIABLE);
+    auto stats = solver.get_stats();
+    assert(std::stoull(stats["conflicts"]) == plain.stats().conflicts);
+    assert(std::stoull(stats["learned_clauses"]) == plain.stats().learned);
+    assert(std::stod(stats["learned_size_avg"]) >= 1.0);
+    assert(std::stod(stats["conflicts_per_sec"]) > 0 && std::stod(stats["propagations_per_sec"]) > 0);
+    assert(std::stod(stats["propagate_ms"]) > 0 && std::stod(stats["parse_ms"]) >= 0);
+    assert(stats["proof_bytes"] == "0");
+    for (const char* key : {"decisions", "restarts", "learned_size_max", "minimized_literals", "deleted_clauses",
+                            "reductions", "garbage_collections", "imported_clauses", "preprocess_ms", "solve_ms",
+                            "analyze_ms", "reduce_ms", "decisions_per_sec"}) {
+        assert(stats.count(key) == 1);
+    }
+
+    solver.reset();
+    assert(solver.get_stats()["conflicts"] == "0");
+    solver.add("(a | b) & (!a | b) & (a | !b)");
+    assert(solver.solve({"!b"}) == SolverStatus::UNSATISFIABLE);
+    assert(solver.solve({}) == SolverStatus::SATISFIABLE);
+    const uint64_t decisions = std::stoull(solver.get_stats()["decisions"]);
+    assert(solver.solve({"a"}) == SolverStatus::SATISFIABLE);
+    assert(std::stoull(solver.get_stats()["decisions"]) >= decisions);
+
+    // Preprocessing time is reported for one-shot queries
+    solver.set_param("preprocess", "true");
+    assert(solver.check(to_dimacs(pigeonhole(5, 4), 20)) == SolverStatus::UNSATISFIABLE);
+    assert(std::stod(solver.get_stats()["preprocess_ms"]) > 0);
+    std::cout << "Solver Statistics Test Passed!" << std::endl;
+}
+
+int main() {
+    test_drat_writer();
+    test_proof_verifies();
+    test_solver_stats();
+    return 0;
+}
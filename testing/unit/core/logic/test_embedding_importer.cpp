@@ -0,0 +1,139 @@
+#include "../../../../src/core/logic/EmbeddingImporter.h"
+#include "../../../../src/core/logic/VectorStore.h"
+#include "../../../../src/core/logic/FlatVectorStore.h"
+#include "../../../../src/core/optimization/Quantizer.h"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <cstdio> // for remove()
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Write a (rows, cols) array the way numpy.save() does (format 1.0)
+void write_npy(const std::string& path, const std::vector<float>& data, size_t rows, size_t cols, bool fp16) {
+    std::string header = "{'descr': '" + std::string(fp16 ? "<f2" : "<f4") +
+                         "', 'fortran_order': False, 'shape': (" +
+                         std::to_string(rows) + ", " + std::to_string(cols) + "), }";
+    // Pad with spaces so the data starts on a 64-byte boundary, ending in '\n'
+    size_t total = 10 + header.size() + 1;
+    header.append((64 - total % 64) % 64, ' ');
+    header.push_back('\n');
+
+    std::ofstream out(path, std::ios::binary);
+    out.write("\x93NUMPY\x01\x00", 8);
+    uint16_t len = static_cast<uint16_t>(header.size());
+    out.write(reinterpret_cast<const char*>(&len), 2);
+    out.write(header.data(), header.size());
+    if (fp16) {
+        for (float v : data) {
+            uint16_t h = minni::optimization::Quantizer::float_to_half(v);
+            out.write(reinterpret_cast<const char*>(&h), 2);
+        }
+    } else {
+        out.write(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(float));
+    }
+}
+
+void write_ids(const std::string& path, size_t rows) {
+    std::ofstream out(path, std::ios::binary);
+    for (size_t i = 0; i < rows; ++i) {
+        out << "doc_" << i << (i % 2 ? "\r\n" : "\n"); // Tolerate Windows line endings
+    }
+}
+
+void test_npy_header() {
+    std::cout << "Running NPY Header Test..." << std::endl;
+    const std::string filename = "test_header.npy";
+    write_npy(filename, std::vector<float>(12, 1.0f), 3, 4, true);
+
+    std::ifstream in(filename, std::ios::binary);
+    std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    minni::logic::EmbeddingImporter::NpyInfo info;
+    assert(minni::logic::EmbeddingImporter::parse_npy_header(bytes.data(), bytes.size(), info));
+    assert(info.is_float16 && info.rows == 3 && info.cols == 4);
+    assert(info.data_offset % 64 == 0);
+
+    // Truncated data and bad magic are rejected
+    assert(!minni::logic::EmbeddingImporter::parse_npy_header(bytes.data(), bytes.size() - 1, info));
+    bytes[1] = 'X';
+    assert(!minni::logic::EmbeddingImporter::parse_npy_header(bytes.data(), bytes.size(), info));
+
+    std::remove(filename.c_str());
+    std::cout << "NPY Header Test Passed!" << std::endl;
+}
+
+void test_import_to_store_and_flat() {
+    std::cout << "Running Embedding Import Test..." << std::endl;
+    const std::string npy32 = "test_emb32.npy";
+    const std::string npy16 = "test_emb16.npy";
+    const std::string ids = "test_emb_ids.txt";
+    const std::string flat = "test_emb_flat.bin";
+    const size_t rows = 1000;
+    const size_t dim = 32;
+
+    std::mt19937 gen(5);
+    std::normal_distribution<float> dis(0.0f, 1.0f);
+    std::vector<float> data(rows * dim);
+    for (auto& x : data) x = dis(gen);
+
+    write_npy(npy32, data, rows, dim, false);
+    write_npy(npy16, data, rows, dim, true);
+    write_ids(ids, rows);
+
+    minni::logic::EmbeddingImporter::Options options;
+    options.chunk_size = 300; // Exercise partial last chunk
+    options.num_threads = 2;
+
+    std::vector<float> query(data.begin() + 123 * dim, data.begin() + 124 * dim);
+
+    // 1. float32 -> float store
+    {
+        minni::logic::VectorStore db(false);
+        assert(minni::logic::EmbeddingImporter::import_to_store(npy32, ids, db, options) == rows);
+        assert(db.size() == rows && db.dimension() == dim);
+        auto results = db.search(query, 1);
+        assert(results[0].first == "doc_123");
+        assert(std::abs(results[0].second - 1.0f) < 1e-5f);
+    }
+
+    // 2. float16 -> quantized store
+    {
+        minni::logic::VectorStore db(true);
+        assert(minni::logic::EmbeddingImporter::import_to_store(npy16, ids, db, options) == rows);
+        auto results = db.search(query, 1);
+        assert(results[0].first == "doc_123");
+        assert(results[0].second > 0.98f);
+    }
+
+    // 3. Straight to flat file, both encodings
+    for (bool quantize : {false, true}) {
+        assert(minni::logic::EmbeddingImporter::import_to_flat(npy16, ids, flat, quantize, options));
+        minni::logic::FlatVectorStore flat_db;
+        assert(flat_db.load(flat));
+        assert(flat_db.size() == rows);
+        auto results = flat_db.search(query, 1);
+        assert(results[0].first == "doc_123");
+        assert(results[0].second > 0.98f);
+        flat_db.close();
+    }
+
+    // 4. Missing IDs: nothing imported into the flat file
+    write_ids(ids, rows - 1);
+    assert(!minni::logic::EmbeddingImporter::import_to_flat(npy32, ids, flat, false, options));
+
+    std::remove(npy32.c_str());
+    std::remove(npy16.c_str());
+    std::remove(ids.c_str());
+    std::remove(flat.c_str());
+    std::cout << "Embedding Import Test Passed!" << std::endl;
+}
+
+int main() {
+    test_npy_header();
+    test_import_to_store_and_flat();
+    return 0;
+}
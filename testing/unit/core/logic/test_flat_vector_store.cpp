@@ -5,6 +5,8 @@
 #include <vector>
 #include <cmath>
 #include <cstdio> // for remove()
+#include <random>
+#include <string>
 
 void test_flat_vector_store() {
     std::cout << "Running FlatVectorStore Test..." << std::endl;
@@ -55,7 +57,95 @@ void test_flat_vector_store() {
     std::cout << "FlatVectorStore Test Passed!" << std::endl;
 }
 
+void test_tiered_two_stage_search() {
+    std::cout << "Running Tiered FlatVectorStore Test..." << std::endl;
+    const std::string filename = "test_flat_tiered.bin";
+    const size_t num_vectors = 500;
+    const size_t dim = 64;
+
+    std::mt19937 gen(7);
+    std::normal_distribution<float> dis(0.0f, 1.0f);
+    auto random_vector = [&]() {
+        std::vector<float> v(dim);
+        for (auto& x : v) x = dis(gen);
+        return v;
+    };
+
+    minni::logic::VectorStore db(false);
+    std::vector<float> target;
+    for (size_t i = 0; i < num_vectors; ++i) {
+        auto v = random_vector();
+        if (i == 123) target = v;
+        db.add_vector("vec_" + std::to_string(i), v);
+    }
+
+    std::vector<std::vector<float>> queries;
+    for (int q = 0; q < 20; ++q) queries.push_back(random_vector());
+
+    // Quantized stores have no floats for the cold section
+    minni::logic::VectorStore quantized_db(true);
+    quantized_db.add_vector("A", {1.0f, 0.0f});
+    assert(!quantized_db.save_flat_tiered(filename, minni::logic::flat::CodeType::INT8));
+
+    // Prefix codes need a configured prefix dimension
+    assert(!db.save_flat_tiered(filename, minni::logic::flat::CodeType::PREFIX));
+    assert(db.set_prefix_dim(16));
+
+    const minni::logic::flat::CodeType code_types[] = {
+        minni::logic::flat::CodeType::INT8,
+        minni::logic::flat::CodeType::BINARY,
+        minni::logic::flat::CodeType::PREFIX
+    };
+    for (auto code_type : code_types) {
+        assert(db.save_flat_tiered(filename, code_type));
+
+        minni::logic::FlatVectorStore flat_db;
+        assert(flat_db.load(filename));
+        assert(flat_db.is_tiered());
+        assert(flat_db.size() == num_vectors);
+
+        // Reranked scores are exact, so the stored vector must come back with score ~1
+        auto results = flat_db.search(target, 5, 8);
+        assert(!results.empty());
+        assert(results[0].first == "vec_123");
+        assert(std::abs(results[0].second - 1.0f) < 1e-4f);
+
+        // Recall improves (or stays) with more oversampling and is perfect when scanning everything
+        float recall_low = flat_db.measure_recall(queries, 10, 1);
+        float recall_high = flat_db.measure_recall(queries, 10, num_vectors);
+        std::cout << "  code_type=" << static_cast<int>(code_type)
+                  << " recall@10 (x1): " << recall_low << " (full): " << recall_high << std::endl;
+        assert(recall_high > 0.999f);
+        assert(recall_low <= recall_high);
+
+        flat_db.close();
+    }
+
+    // A cold section that starts inside (or before) the hot codes is rejected
+    minni::logic::flat::Header header;
+    std::FILE* f = std::fopen(filename.c_str(), "r+b");
+    assert(f);
+    assert(std::fread(&header, sizeof(header), 1, f) == 1);
+    // The last file written holds 16-float prefix codes
+    const uint64_t hot_end = header.vector_offset + num_vectors * 16 * sizeof(float);
+    const uint64_t bad_cold_offsets[] = {hot_end - 1, header.vector_offset - 1};
+    for (uint64_t bad_cold_offset : bad_cold_offsets) {
+        header.cold_offset = bad_cold_offset;
+        std::fseek(f, 0, SEEK_SET);
+        assert(std::fwrite(&header, sizeof(header), 1, f) == 1);
+        std::fflush(f);
+
+        minni::logic::FlatVectorStore corrupt_db;
+        assert(!corrupt_db.load(filename));
+    }
+    std::fclose(f);
+
+    std::remove(filename.c_str());
+    std::cout << "Tiered FlatVectorStore Test Passed!" << std::endl;
+}
+
 int main() {
     test_flat_vector_store();
+    test_tiered_two_stage_search();
     return 0;
 }
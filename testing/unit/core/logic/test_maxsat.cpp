@@ -0,0 +1,377 @@
+#include "../../../../src/core/logic/PbEncoder.h"
+#include "../../../../src/core/logic/MaxSatSolver.h"
+#include "../../../../src/core/logic/SatSolver.h"
+#include "../../../../src/core/logic/CdclSolver.h"
+#include <iostream>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace minni::logic;
+
+struct Rng {
+    unsigned state;
+    unsigned next(unsigned bound) {
+        state = state * 1103515245u + 12345u;
+        return ((state >> 8) & 0xffffff) % bound;
+    }
+};
+
+static CnfSink sink_for(CdclSolver& solver) {
+    CnfSink sink;
+    sink.new_var = [&solver]() { return solver.new_var(); };
+    sink.add_clause = [&solver](const Lit* lits, size_t size) { solver.add_clause(lits, size); };
+    return sink;
+}
+
+static bool holds(int64_t sum, Compare compare, int64_t bound) {
+    if (compare == Compare::AT_MOST) return sum <= bound;
+    if (compare == Compare::AT_LEAST) return sum >= bound;
+    return sum == bound;
+}
+
+// The encoding must accept exactly the input assignments that satisfy the constraint
+static void check_encoding(unsigned n, const std::vector<Lit>& lits, const std::vector<int64_t>& weights,
+                           Compare compare, int64_t bound, bool cardinality) {
+    CdclSolver solver;
+    for (unsigned v = 0; v < n; ++v) solver.new_var();
+    if (cardinality) PbEncoder::cardinality(sink_for(solver), lits, compare, static_cast<size_t>(bound));
+    else PbEncoder::pseudo_boolean(sink_for(solver), lits, weights, compare, bound);
+
+    for (unsigned mask = 0; mask < (1u << n); ++mask) {
+        std::vector<Lit> assumptions;
+        for (unsigned v = 0; v < n; ++v) assumptions.push_back(make_lit(v, !((mask >> v) & 1)));
+        int64_t sum = 0;
+        for (size_t i = 0; i < lits.size(); ++i) {
+            const bool value = ((mask >> lit_var(lits[i])) & 1) != lit_negated(lits[i]);
+            if (value) sum += weights[i];
+        }
+        const bool expected = holds(sum, compare, bound);
+        assert((solver.solve(assumptions) == SolverStatus::SATISFIABLE) == expected);
+    }
+}
+
+void test_cardinality_encoding() {
+    std::cout << "Running Cardinality Encoding Test..." << std::endl;
+    Rng rng{5};
+    for (unsigned n = 1; n <= 8; ++n) {
+        std::vector<Lit> lits;
+        for (unsigned v = 0; v < n; ++v) lits.push_back(make_lit(v, rng.next(2) != 0));
+        const std::vector<int64_t> ones(n, 1);
+        for (Compare compare : {Compare::AT_MOST, Compare::AT_LEAST, Compare::EXACTLY}) {
+            for (unsigned k = 0; k <= n + 1; ++k) check_encoding(n, lits, ones, compare, k, true);
+        }
+    }
+
+    // Totalizer outputs: one encoding, any bound through assumptions
+    CdclSolver solver;
+    std::vector<Lit> inputs;
+    for (int v = 0; v < 10; ++v) inputs.push_back(make_lit(solver.new_var()));
+    Totalizer counter(sink_for(solver), inputs);
+    assert(counter.outputs().size() == 10 && counter.num_inputs() == 10);
+    for (size_t k = 0; k < 10; ++k) {
+        std::vector<Lit> assumptions = {counter.at_most(k)};
+        for (size_t i = 0; i <= k; ++i) assumptions.push_back(inputs[i]);
+        assert(solver.solve(assumptions) == SolverStatus::UNSATISFIABLE);   // k + 1 true
+        assumptions.pop_back();
+        assert(solver.solve(assumptions) == SolverStatus::SATISFIABLE);
+    }
+
+    // k-simplified: at most 3 of 200 stays small
+    CdclSolver big;
+    std::vector<Lit> many;
+    for (int v = 0; v < 200; ++v) many.push_back(make_lit(big.new_var()));
+    assert(PbEncoder::cardinality(sink_for(big), many, Compare::AT_MOST, 3));
+    assert(big.num_vars() < 200 + 200 * 4);
+    std::cout << "Cardinality Encoding Test Passed!" << std::endl;
+}
+
+void test_pseudo_boolean_encoding() {
+    std::cout << "Running Pseudo-Boolean Encoding Test..." << std::endl;
+    Rng rng{11};
+    for (int round = 0; round < 40; ++round) {
+        const unsigned n = 2 + rng.next(7);
+        std::vector<Lit> lits;
+        std::vector<int64_t> weights;
+        int64_t total = 0;
+        for (unsigned i = 0; i < n; ++i) {
+            lits.push_back(make_lit(rng.next(n), rng.next(2) != 0));   // Repeats allowed
+            weights.push_back(static_cast<int64_t>(rng.next(19)) - 6);  // Some negative, some zero
+            total += weights.back() < 0 ? -weights.back() : weights.back();
+        }
+        const int64_t bound = static_cast<int64_t>(rng.next(static_cast<unsigned>(total) + 1)) - total / 3;
+        for (Compare compare : {Compare::AT_MOST, Compare::AT_LEAST, Compare::EXACTLY}) {
+            check_encoding(n, lits, weights, compare, bound, false);
+        }
+    }
+
+    // Infeasible bounds are reported and make the formula unsatisfiable
+    CdclSolver solver;
+    const std::vector<Lit> ab = {make_lit(solver.new_var()), make_lit(solver.new_var())};
+    assert(!PbEncoder::pseudo_boolean(sink_for(solver), ab, {3, 4}, Compare::AT_LEAST, 8));
+    assert(solver.solve() == SolverStatus::UNSATISFIABLE);
+
+    // Interval sharing keeps large bounds cheap: 60 terms, bound 10^12
+    CdclSolver large;
+    std::vector<Lit> terms;
+    std::vector<int64_t> weights;
+    for (int i = 0; i < 60; ++i) {
+        terms.push_back(make_lit(large.new_var()));
+        weights.push_back(i % 2 ? 100000000000LL : 300000000000LL);
+    }
+    assert(PbEncoder::pseudo_boolean(sink_for(large), terms, weights, Compare::AT_MOST, 1000000000000LL));
+    std::cout << "  60-term PB with bound 1e12: " << large.num_vars() - 60 << " auxiliary variables" << std::endl;
+    assert(large.num_vars() < 60 + 60 * 12);
+    assert(large.solve() == SolverStatus::SATISFIABLE);
+    int64_t sum = 0;
+    for (int i = 0; i < 60; ++i) sum += large.model_value(lit_var(terms[i])) ? weights[i] : 0;
+    assert(sum <= 1000000000000LL);
+    std::cout << "Pseudo-Boolean Encoding Test Passed!" << std::endl;
+}
+
+void test_sat_solver_constraints() {
+    std::cout << "Running SatSolver Constraints Test..." << std::endl;
+    SatSolver solver;
+    const std::vector<std::string> shifts = {"alice", "bob", "carol", "dave"};
+    assert(solver.add_cardinality(shifts, Compare::EXACTLY, 2));
+    assert(solver.add("!alice | !bob"));
+    assert(solver.add_pseudo_boolean({"alice", "bob", "carol", "dave"}, {5, 3, 4, 2}, Compare::AT_MOST, 7));
+    assert(solver.solve({}) == SolverStatus::SATISFIABLE);
+    auto model = solver.get_model();
+    assert(model.size() == 4);   // Auxiliary variables are hidden
+    int on = 0, cost = 0;
+    const int price[] = {5, 3, 4, 2};
+    for (size_t i = 0; i < shifts.size(); ++i) {
+        if (model[shifts[i]] == "true") {
+            ++on;
+            cost += price[i];
+        }
+    }
+    assert(on == 2 && cost <= 7 && !(model["alice"] == "true" && model["bob"] == "true"));
+
+    // Scoped like any other assertion
+    solver.push();
+    assert(solver.add_cardinality({"dave"}, Compare::AT_MOST, 0));
+    assert(solver.solve({}) == SolverStatus::SATISFIABLE);   // Only bob + carol is left
+    model = solver.get_model();
+    assert(model["bob"] == "true" && model["carol"] == "true");
+    solver.push();
+    assert(solver.add_cardinality({"bob"}, Compare::AT_MOST, 0));
+    assert(solver.solve({}) == SolverStatus::UNSATISFIABLE);
+    assert(solver.pop());
+    assert(solver.pop());
+    assert(solver.solve({"!alice", "!bob"}) == SolverStatus::SATISFIABLE);
+    assert(!solver.add_cardinality({"a", ""}, Compare::AT_MOST, 1));
+    assert(!solver.add_pseudo_boolean({"a"}, {1, 2}, Compare::AT_MOST, 1));
+    std::cout << "SatSolver Constraints Test Passed!" << std::endl;
+}
+
+// Brute-force optimum of hard clauses + weighted soft clauses over n variables
+using Clauses = std::vector<std::vector<int>>;   // +v / -v, 1-based
+
+static bool clause_true(const std::vector<int>& c, unsigned mask) {
+    for (int l : c) {
+        if (((mask >> ((l > 0 ? l : -l) - 1)) & 1) == (l > 0 ? 1u : 0u)) return true;
+    }
+    return false;
+}
+
+static int64_t brute_force(unsigned n, const Clauses& hard, const Clauses& soft, const std::vector<uint64_t>& w) {
+    int64_t best = -1;
+    for (unsigned mask = 0; mask < (1u << n); ++mask) {
+        bool ok = true;
+        for (const auto& c : hard) ok = ok && clause_true(c, mask);
+        if (!ok) continue;
+        int64_t cost = 0;
+        for (size_t i = 0; i < soft.size(); ++i) cost += clause_true(soft[i], mask) ? 0 : static_cast<int64_t>(w[i]);
+        if (best < 0 || cost < best) best = cost;
+    }
+    return best;
+}
+
+static std::string to_text(const std::vector<int>& c) {
+    std::string s = "(";
+    for (size_t i = 0; i < c.size(); ++i) {
+        if (i) s += " | ";
+        s += (c[i] < 0 ? "!x" : "x") + std::to_string(c[i] < 0 ? -c[i] : c[i]);
+    }
+    return s + ")";
+}
+
+void test_maxsat_random() {
+    std::cout << "Running MaxSAT Random Test..." << std::endl;
+    Rng rng{23};
+    int unsat = 0;
+    for (int round = 0; round < 60; ++round) {
+        const unsigned n = 4 + rng.next(7);
+        Clauses hard, soft;
+        std::vector<uint64_t> weights;
+        auto random_clause = [&](unsigned size) {
+            std::vector<int> c;
+            for (unsigned k = 0; k < size; ++k) {
+                const int v = 1 + static_cast<int>(rng.next(n));
+                c.push_back(rng.next(2) ? v : -v);
+            }
+            return c;
+        };
+        const unsigned hard_count = rng.next(2 * n);
+        for (unsigned i = 0; i < hard_count; ++i) hard.push_back(random_clause(2 + rng.next(2)));
+        const unsigned soft_count = 3 + rng.next(3 * n);
+        const bool weighted = round % 2 == 0;
+        for (unsigned i = 0; i < soft_count; ++i) {
+            soft.push_back(random_clause(1 + rng.next(3)));
+            weights.push_back(weighted ? 1 + rng.next(9) : 1);
+        }
+        const int64_t expected = brute_force(n, hard, soft, weights);
+
+        MaxSatSolver solver;
+        if (round % 3 == 1) solver.set_param("stratify", "false");
+        if (round % 5 == 2) solver.set_param("threads", "2");
+        std::string hard_text;
+        for (const auto& c : hard) hard_text += (hard_text.empty() ? "" : " & ") + to_text(c);
+        for (size_t i = 0; i < soft.size(); ++i) {
+            const std::string text = soft[i].size() == 1 ? to_text(soft[i]).substr(1, to_text(soft[i]).size() - 2)
+                                                         : to_text(soft[i]);
+            assert(solver.add_soft(text, weights[i]));
+        }
+        const SolverStatus status = solver.check(hard_text);
+        if (expected < 0) {
+            assert(status == SolverStatus::UNSATISFIABLE);
+            ++unsat;
+            continue;
+        }
+        assert(status == SolverStatus::SATISFIABLE);
+        assert(static_cast<int64_t>(solver.cost()) == expected);
+        assert(solver.lower_bound() == solver.cost());
+
+        // The model itself is feasible and has that cost
+        auto model = solver.get_model();
+        unsigned mask = 0;
+        for (unsigned v = 1; v <= n; ++v) {
+            if (model["x" + std::to_string(v)] == "true") mask |= 1u << (v - 1);
+        }
+        for (const auto& c : hard) assert(clause_true(c, mask));
+        int64_t cost = 0;
+        for (size_t i = 0; i < soft.size(); ++i) cost += clause_true(soft[i], mask) ? 0 : static_cast<int64_t>(weights[i]);
+        assert(cost == expected);
+    }
+    assert(unsat > 0 && unsat < 60);
+    std::cout << "MaxSAT Random Test Passed!" << std::endl;
+}
+
+void test_maxsat_scheduling() {
+    std::cout << "Running MaxSAT Scheduling Test..." << std::endl;
+    // 12 tasks, 4 slots, each task in exactly one slot, at most 3 tasks per slot;
+    // conflicting task pairs must not share a slot; task t prefers slot t % 4
+    auto var = [](int t, int s) { return "t" + std::to_string(t) + "s" + std::to_string(s); };
+    auto add_rules = [&var](auto& solver) {
+        for (int t = 0; t < 12; ++t) {
+            std::vector<std::string> slots;
+            for (int s = 0; s < 4; ++s) slots.push_back(var(t, s));
+            assert(solver.add_cardinality(slots, Compare::EXACTLY, 1));
+        }
+        for (int s = 0; s < 4; ++s) {
+            std::vector<std::string> tasks;
+            for (int t = 0; t < 12; ++t) tasks.push_back(var(t, s));
+            assert(solver.add_cardinality(tasks, Compare::AT_MOST, 3));
+        }
+        for (int t = 0; t + 4 < 12; t += 2) {
+            for (int s = 0; s < 4; ++s) assert(solver.add("!" + var(t, s) + " | !" + var(t + 4, s)));
+        }
+    };
+    MaxSatSolver solver;
+    add_rules(solver);
+    for (int t = 0; t < 12; ++t) assert(solver.add_soft(var(t, t % 4), 1 + t % 3));
+    assert(solver.optimize() == SolverStatus::SATISFIABLE);
+
+    auto model = solver.get_model();
+    uint64_t cost = 0;
+    for (int t = 0; t < 12; ++t) {
+        int placed = 0;
+        for (int s = 0; s < 4; ++s) placed += model[var(t, s)] == "true";
+        assert(placed == 1);
+        if (model[var(t, t % 4)] != "true") cost += 1 + t % 3;
+    }
+    for (int t = 0; t + 4 < 12; t += 2) {
+        for (int s = 0; s < 4; ++s) assert(!(model[var(t, s)] == "true" && model[var(t + 4, s)] == "true"));
+    }
+    std::cout << "  optimum " << solver.cost() << std::endl;
+    assert(cost == solver.cost() && solver.cost() > 0);
+
+    // Optimal: no schedule satisfies a pseudo-Boolean bound one below it
+    SatSolver check;
+    add_rules(check);
+    std::vector<std::string> missed;
+    std::vector<int64_t> weights;
+    for (int t = 0; t < 12; ++t) {
+        missed.push_back("!" + var(t, t % 4));
+        weights.push_back(1 + t % 3);
+    }
+    assert(check.add_pseudo_boolean(missed, weights, Compare::AT_MOST, static_cast<int64_t>(solver.cost())));
+    assert(check.solve({}) == SolverStatus::SATISFIABLE);
+    check.push();
+    assert(check.add_pseudo_boolean(missed, weights, Compare::AT_MOST, static_cast<int64_t>(solver.cost()) - 1));
+    assert(check.solve({}) == SolverStatus::UNSATISFIABLE);
+    check.pop();
+
+    // Hard constraints that conflict
+    MaxSatSolver infeasible;
+    infeasible.add_soft("a", 1);
+    assert(infeasible.check("(a | b) & !a & !b") == SolverStatus::UNSATISFIABLE);
+    std::cout << "MaxSAT Scheduling Test Passed!" << std::endl;
+}
+
+void test_maxsat_wcnf() {
+    std::cout << "Running MaxSAT WCNF Test..." << std::endl;
+    const std::string wcnf =
+        "c tiny instance\n"
+        "p wcnf 3 6 100\n"
+        "100 1 2 0\n"
+        "100 -1 -2 0\n"
+        "h 2 3 0\n"
+        "4 1 0\n"
+        "3 2 0\n"
+        "5 -3 0\n";
+    MaxSatSolver solver;
+    assert(solver.check(wcnf) == SolverStatus::SATISFIABLE);
+    // x1 true forces x2 false, then x3 true (cost 5 + 3); x2 true costs 4 -> 4
+    assert(solver.cost() == 4);
+    auto model = solver.get_model();
+    assert(model["1"] == "false" && model["2"] == "true" && model["3"] == "false");
+
+    MaxSatSolver bad;
+    assert(bad.check("p wcnf 2 1\n3 1 x 0\n") == SolverStatus::UNKNOWN);
+    assert(bad.check("p wcnf 2 1\n3 1 2\n") == SolverStatus::UNKNOWN);
+
+    // Many heavy, conflicting soft constraints with a tight timeout: no proof of optimality
+    MaxSatSolver hard;
+    hard.set_param("timeout", "50");
+    for (int p = 0; p < 14; ++p) {
+        for (int h = 0; h < 13; ++h) hard.add_soft("p" + std::to_string(p) + "h" + std::to_string(h), 1);
+    }
+    for (int h = 0; h < 13; ++h) {
+        std::vector<std::string> pigeons;
+        for (int p = 0; p < 14; ++p) pigeons.push_back("p" + std::to_string(p) + "h" + std::to_string(h));
+        hard.add_cardinality(pigeons, Compare::AT_MOST, 1);
+    }
+    for (int p = 0; p < 14; ++p) {
+        std::vector<std::string> holes;
+        for (int h = 0; h < 13; ++h) holes.push_back("p" + std::to_string(p) + "h" + std::to_string(h));
+        hard.add_cardinality(holes, Compare::AT_LEAST, 1);
+    }
+    const SolverStatus status = hard.optimize();
+    assert(status == SolverStatus::TIMEOUT || status == SolverStatus::UNSATISFIABLE);
+    std::cout << "MaxSAT WCNF Test Passed!" << std::endl;
+}
+
+int main() {
+    test_cardinality_encoding();
+    test_pseudo_boolean_encoding();
+    test_sat_solver_constraints();
+    test_maxsat_random();
+    test_maxsat_scheduling();
+    test_maxsat_wcnf();
+    return 0;
+}
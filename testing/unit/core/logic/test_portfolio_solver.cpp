@@ -0,0 +1,242 @@
+#include "../../../../src/core/logic/PortfolioSolver.h"
+#include "../../../../src/core/logic/ClauseExchange.h"
+#include "../../../../src/core/logic/SatSolver.h"
+#include "cnf_fixtures.h"
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace minni::logic;
+
+static bool model_satisfies(const PortfolioSolver& solver, const Cnf& cnf) {
+    for (const auto& c : cnf) {
+        bool sat = false;
+        for (Lit l : c) sat = sat || (solver.model_value(lit_var(l)) != lit_negated(l));
+        if (!sat) return false;
+    }
+    return true;
+}
+
+void test_clause_exchange() {
+    std::cout << "Running Clause Exchange Test..." << std::endl;
+    ClauseExchange exchange(8);
+    assert(exchange.capacity() == 8);
+
+    std::vector<std::vector<Lit>> got;
+    auto collect = [&got](const Lit* lits, size_t size) { got.emplace_back(lits, lits + size); };
+
+    const Lit a[] = {2, 5}, b[] = {7}, longer[ClauseExchange::kMaxSize + 1] = {0};
+    assert(exchange.publish(0, a, 2));
+    assert(exchange.publish(1, b, 1));
+    assert(!exchange.publish(1, longer, ClauseExchange::kMaxSize + 1));
+    assert(!exchange.publish(1, a, 0));
+
+    // Readers skip their own clauses and see each clause once
+    uint64_t cursor0 = 0, cursor1 = 0;
+    assert(exchange.fetch(0, cursor0, collect) == 1 && got.back() == std::vector<Lit>{7});
+    assert(exchange.fetch(0, cursor0, collect) == 0);
+    assert(exchange.fetch(1, cursor1, collect) == 1 && got.back() == (std::vector<Lit>{2, 5}));
+
+    // A reader more than a lap behind only sees the last `capacity` clauses
+    for (Lit i = 0; i < 20; ++i) exchange.publish(2, &i, 1);
+    got.clear();
+    assert(exchange.fetch(0, cursor0, collect) == 8);
+    assert(got.front()[0] == 12 && got.back()[0] == 19);
+
+    // Concurrent producers and consumers: every delivered clause is intact
+    ClauseExchange shared(256);
+    const unsigned producers = 4, per_producer = 50000;
+    std::atomic<bool> done(false);
+    std::atomic<size_t> delivered(0), corrupt(0);
+    auto consumer = [&](uint32_t id) {
+        uint64_t cursor = 0;
+        auto check = [&](const Lit* lits, size_t size) {
+            // Producer p writes size = 1 + n % 8 copies of (p << 24 | n)
+            const uint32_t n = lits[0] & 0xffffff;
+            bool ok = size == 1 + n % 8 && (lits[0] >> 24) != id;
+            for (size_t i = 1; i < size; ++i) ok = ok && lits[i] == lits[0];
+            if (!ok) ++corrupt;
+            ++delivered;
+        };
+        while (!done.load()) shared.fetch(id, cursor, check);
+        shared.fetch(id, cursor, check);
+    };
+    std::vector<std::thread> pool;
+    for (uint32_t p = 0; p < producers; ++p) {
+        pool.emplace_back([&shared, p] {
+            Lit lits[ClauseExchange::kMaxSize];
+            for (uint32_t n = 0; n < per_producer; ++n) {
+                for (size_t i = 0; i < ClauseExchange::kMaxSize; ++i) lits[i] = (p << 24) | n;
+                shared.publish(p, lits, 1 + n % 8);
+            }
+        });
+    }
+    std::thread reader_a(consumer, 0), reader_b(consumer, 99);
+    for (auto& th : pool) th.join();
+    done = true;
+    reader_a.join();
+    reader_b.join();
+    std::cout << "  delivered " << delivered.load() << " clauses under contention" << std::endl;
+    assert(corrupt.load() == 0);
+    assert(delivered.load() > 0);
+    std::cout << "Clause Exchange Test Passed!" << std::endl;
+}
+
+void test_portfolio_answers() {
+    std::cout << "Running Portfolio Answers Test..." << std::endl;
+    // Diversified options
+    CdclSolver::Options base;
+    assert(PortfolioSolver::diversify(base, 0).seed == 0);
+    assert(PortfolioSolver::diversify(base, 1).restart != base.restart);
+    assert(PortfolioSolver::diversify(base, 2).initial_phase != base.initial_phase);
+    assert(PortfolioSolver::diversify(base, 5).random_branch > 0.0);
+
+    // UNSAT: pigeonhole 8 / 7
+    {
+        PortfolioSolver solver(4);
+        assert(solver.num_workers() == 4);
+        for (const auto& c : pigeonhole(8, 7)) solver.add_clause(c);
+        auto start = std::chrono::high_resolution_clock::now();
+        assert(solver.solve() == SolverStatus::UNSATISFIABLE);
+        auto end = std::chrono::high_resolution_clock::now();
+        uint64_t imported = 0;
+        for (size_t i = 0; i < solver.num_workers(); ++i) imported += solver.worker(i).num_imported();
+        std::cout << "  pigeonhole 8/7, 4 workers: "
+                  << std::chrono::duration<double, std::milli>(end - start).count() << " ms, winner "
+                  << solver.winner() << ", " << imported << " clauses imported" << std::endl;
+        assert(imported > 0);
+    }
+
+    // SAT with a planted model
+    {
+        const unsigned vars = 5000;
+        std::vector<bool> planted(vars);
+        Rng rng{3};
+        for (unsigned v = 0; v < vars; ++v) planted[v] = rng.next(2) != 0;
+        Cnf cnf = random_3sat(vars, 16000, 9, &planted);
+        PortfolioSolver solver(4);
+        for (const auto& c : cnf) solver.add_clause(c);
+        assert(solver.solve() == SolverStatus::SATISFIABLE);
+        assert(model_satisfies(solver, cnf));
+    }
+
+    // Near-threshold instances agree with a single engine
+    for (unsigned seed = 1; seed <= 8; ++seed) {
+        Cnf cnf = random_3sat(120, 511, seed, nullptr);
+        PortfolioSolver portfolio(3);
+        CdclSolver single;
+        for (const auto& c : cnf) {
+            portfolio.add_clause(c);
+            single.add_clause(c);
+        }
+        SolverStatus status = portfolio.solve();
+        assert(status == single.solve());
+        if (status == SolverStatus::SATISFIABLE) assert(model_satisfies(portfolio, cnf));
+    }
+    std::cout << "Portfolio Answers Test Passed!" << std::endl;
+}
+
+void test_portfolio_incremental() {
+    std::cout << "Running Portfolio Incremental Test..." << std::endl;
+    PortfolioSolver solver(4);
+    const Lit a = make_lit(0), b = make_lit(1), c = make_lit(2);
+    solver.add_clause({make_lit(0, true), make_lit(1, true)});   // !a | !b
+    solver.add_clause({make_lit(1, true), c});                   // !b | c
+    assert(solver.solve({a, c}) == SolverStatus::SATISFIABLE);
+    assert(solver.model_value(0) && solver.model_value(2));
+    assert(solver.solve({a, b}) == SolverStatus::UNSATISFIABLE);
+    assert(solver.core().size() == 2);
+
+    solver.push();
+    solver.add_clause({make_lit(2, true)});
+    assert(solver.scope_depth() == 1);
+    assert(solver.solve({b}) == SolverStatus::UNSATISFIABLE);
+    assert(solver.pop());
+    assert(!solver.pop());
+    assert(solver.solve({b}) == SolverStatus::SATISFIABLE);
+
+    // Scopes closed after clause sharing stay closed when their selectors are reused
+    {
+        Cnf base = random_3sat(100, 380, 21, nullptr);
+        PortfolioSolver scoped(4);
+        for (const auto& cl : base) scoped.add_clause(cl);
+        scoped.push();
+        assert(scoped.pop());
+        const uint32_t vars = scoped.num_vars();
+        for (unsigned round = 0; round < 30; ++round) {
+            Cnf extra = random_3sat(100, 60, 500 + round, nullptr);
+            scoped.push();
+            for (const auto& cl : extra) scoped.add_clause(cl);
+            SolverStatus got = scoped.solve();
+            assert(scoped.pop());
+            assert(scoped.num_vars() == vars);
+
+            CdclSolver fresh;
+            for (const auto& cl : base) fresh.add_clause(cl);
+            for (const auto& cl : extra) fresh.add_clause(cl);
+            assert(got == fresh.solve());
+            if (got == SolverStatus::SATISFIABLE) {
+                Cnf all = base;
+                all.insert(all.end(), extra.begin(), extra.end());
+                assert(model_satisfies(scoped, all));
+            }
+        }
+        CdclSolver fresh;
+        for (const auto& cl : base) fresh.add_clause(cl);
+        assert(scoped.solve() == fresh.solve());
+    }
+
+    // Limits and interrupt reach every worker
+    PortfolioSolver hard(4);
+    for (const auto& cl : pigeonhole(12, 11)) hard.add_clause(cl);
+    CdclSolver::Limits limits;
+    limits.timeout_ms = 100;
+    hard.set_limits(limits);
+    auto start = std::chrono::steady_clock::now();
+    assert(hard.solve() == SolverStatus::TIMEOUT);
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    assert(ms < 1000);
+
+    hard.set_limits(CdclSolver::Limits());
+    std::thread canceller([&hard] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        hard.interrupt();
+    });
+    assert(hard.solve() == SolverStatus::UNKNOWN);
+    canceller.join();
+    hard.clear_interrupt();
+    std::cout << "Portfolio Incremental Test Passed!" << std::endl;
+}
+
+void test_sat_solver_threads() {
+    std::cout << "Running SatSolver Threads Test..." << std::endl;
+    SatSolver solver;
+    solver.set_param("threads", "4");
+    assert(solver.add("!rain | umbrella"));
+    assert(solver.add("!umbrella | !sunglasses"));
+    assert(solver.solve({"rain"}) == SolverStatus::SATISFIABLE);
+    assert(solver.get_model()["umbrella"] == "true");
+    assert(solver.solve({"rain", "sunglasses"}) == SolverStatus::UNSATISFIABLE);
+    assert(solver.get_unsat_core().size() == 2);
+
+    // Changing the thread count rebuilds the engine from the stored clauses
+    solver.set_param("threads", "1");
+    assert(solver.solve({"rain", "sunglasses"}) == SolverStatus::UNSATISFIABLE);
+    solver.set_param("threads", "0");
+    assert(solver.solve({"sunglasses"}) == SolverStatus::SATISFIABLE);
+    assert(solver.get_model()["rain"] == "false");
+    assert(solver.check("(x | y) & (!x | y) & (x | !y) & (!x | !y)") == SolverStatus::UNSATISFIABLE);
+    std::cout << "SatSolver Threads Test Passed!" << std::endl;
+}
+
+int main() {
+    test_clause_exchange();
+    test_portfolio_answers();
+    test_portfolio_incremental();
+    test_sat_solver_threads();
+    return 0;
+}
@@ -0,0 +1,239 @@
+#include "../../../../src/core/logic/Preprocessor.h"
+#include "../../../../src/core/logic/CdclSolver.h"
+#include "../../../../src/core/logic/SatSolver.h"
+#include "cnf_fixtures.h"
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <string>
+#include <vector>
+
+using namespace minni::logic;
+
+// Tseitin encoding of a random AND/OR circuit whose output is asserted, plus
+// duplicated and subsumed constraints: the shape our rule compiler produces
+static Cnf circuit(unsigned inputs, unsigned gates, unsigned seed, unsigned& num_vars) {
+    Rng rng{seed};
+    Cnf cnf;
+    unsigned next = inputs;
+    for (unsigned g = 0; g < gates; ++g, ++next) {
+        const Lit a = make_lit(rng.next(next), rng.next(2) != 0);
+        const Lit b = make_lit(rng.next(next), rng.next(2) != 0);
+        const Lit y = make_lit(next);
+        if (lit_var(a) == lit_var(b)) {
+            cnf.push_back({lit_neg(y), a});                     // y <-> a
+            cnf.push_back({y, lit_neg(a)});
+        } else if (rng.next(2)) {
+            cnf.push_back({lit_neg(y), a});                     // y <-> a & b
+            cnf.push_back({lit_neg(y), b});
+            cnf.push_back({y, lit_neg(a), lit_neg(b)});
+            cnf.push_back({lit_neg(y), a, b});                  // Redundant: subsumed
+        } else {
+            cnf.push_back({y, lit_neg(a)});                     // y <-> a | b
+            cnf.push_back({y, lit_neg(b)});
+            cnf.push_back({lit_neg(y), a, b});
+            cnf.push_back({lit_neg(y), a, b});                  // Duplicate
+        }
+    }
+    cnf.push_back({make_lit(next - 1)});                        // Output is true
+    num_vars = next;
+    return cnf;
+}
+
+static bool satisfies(const std::vector<int8_t>& model, const Cnf& cnf) {
+    for (const auto& c : cnf) {
+        bool sat = false;
+        for (Lit l : c) sat = sat || ((model[lit_var(l)] > 0) != lit_negated(l));
+        if (!sat) return false;
+    }
+    return true;
+}
+
+// Preprocess, solve the rest with CDCL, extend the model
+static SolverStatus solve_simplified(const Cnf& cnf, unsigned vars, std::vector<int8_t>& model,
+                                     Preprocessor::Stats* stats = nullptr) {
+    Preprocessor pre;
+    for (const auto& c : cnf) pre.add_clause(c);
+    const bool ok = pre.run();
+    if (stats) *stats = pre.stats();
+    if (!ok) return SolverStatus::UNSATISFIABLE;
+    CdclSolver solver;
+    while (solver.num_vars() < vars) solver.new_var();
+    pre.for_each_clause([&solver](const Lit* lits, size_t n) { solver.add_clause(lits, n); });
+    const SolverStatus status = solver.solve();
+    if (status == SolverStatus::SATISFIABLE) {
+        model.assign(vars, 0);
+        for (uint32_t v = 0; v < vars; ++v) model[v] = solver.model_value(v) ? 1 : -1;
+        pre.extend_model(model);
+    }
+    return status;
+}
+
+void test_preprocessor_techniques() {
+    std::cout << "Running Preprocessor Techniques Test..." << std::endl;
+    const Lit a = make_lit(0), b = make_lit(1), c = make_lit(2), d = make_lit(3);
+
+    {
+        // Units propagate; (a) strengthens (!a | b) to (b)
+        Preprocessor pre;
+        pre.add_clause({a});
+        pre.add_clause({lit_neg(a), b});
+        pre.add_clause({lit_neg(b), c, d});
+        pre.add_clause({lit_neg(c), lit_neg(d)});
+        assert(pre.run());
+        assert(pre.stats().fixed >= 2 && pre.is_removed(0) && pre.is_removed(1));
+        std::vector<int8_t> model(4, 0);
+        pre.extend_model(model);
+        assert(model[0] > 0 && model[1] > 0);
+    }
+    {
+        // Subsumption and self-subsuming resolution (elimination off to observe them)
+        Preprocessor::Options options;
+        options.elimination = false;
+        options.pure_literals = false;
+        options.probing = false;
+        Preprocessor pre(options);
+        pre.add_clause({a, b});
+        pre.add_clause({a, b, c});             // Subsumed by (a | b)
+        pre.add_clause({lit_neg(a), b, d});    // (a | b) strengthens it to (b | d)
+        pre.add_clause({lit_neg(b), lit_neg(d)});
+        assert(pre.run());
+        assert(pre.stats().subsumed >= 1 && pre.stats().strengthened >= 1);
+        assert(pre.num_clauses() == 3);
+    }
+    {
+        // Pure literal: c only occurs positively
+        Preprocessor::Options options;
+        options.elimination = false;
+        Preprocessor pre(options);
+        pre.add_clause({a, c});
+        pre.add_clause({lit_neg(a), b, c});
+        pre.add_clause({lit_neg(b), a});
+        pre.freeze(0);
+        assert(pre.run());
+        assert(pre.stats().pure >= 1 && pre.is_removed(2));
+        assert(!pre.is_removed(0));             // Frozen
+    }
+    {
+        // Failed literal: a -> b, a -> !b, so !a (subsumption would find it too)
+        Preprocessor::Options options;
+        options.elimination = false;
+        options.pure_literals = false;
+        options.subsumption = false;
+        Preprocessor pre(options);
+        pre.add_clause({lit_neg(a), b});
+        pre.add_clause({lit_neg(a), lit_neg(b)});
+        pre.add_clause({a, c, d});
+        pre.add_clause({lit_neg(c), lit_neg(d)});
+        assert(pre.run());
+        assert(pre.stats().failed == 1 && pre.is_removed(0));
+    }
+    {
+        // Elimination: b occurs in few clauses and resolves away
+        Preprocessor pre;
+        pre.add_clause({a, b});
+        pre.add_clause({lit_neg(b), c});
+        pre.add_clause({lit_neg(a), lit_neg(c), d});
+        pre.add_clause({lit_neg(d), a});
+        pre.freeze(0);
+        pre.freeze(2);
+        pre.freeze(3);
+        assert(pre.run());
+        assert(pre.stats().eliminated == 1 && pre.is_removed(1));
+    }
+    {
+        Preprocessor pre;
+        pre.add_clause({a, b});
+        pre.add_clause({a, lit_neg(b)});
+        pre.add_clause({lit_neg(a), b});
+        pre.add_clause({lit_neg(a), lit_neg(b)});
+        assert(!pre.run());
+    }
+    std::cout << "Preprocessor Techniques Test Passed!" << std::endl;
+}
+
+void test_preprocessor_random() {
+    std::cout << "Running Preprocessor Random Test..." << std::endl;
+    // Near the threshold: same answer as plain CDCL, extended models satisfy the original
+    unsigned sat = 0;
+    for (unsigned seed = 1; seed <= 60; ++seed) {
+        const unsigned vars = 40 + seed % 20;
+        Cnf cnf = random_3sat(vars, static_cast<unsigned>(vars * 4.26), seed);
+        if (seed % 3 == 0) cnf.push_back({make_lit(seed % vars)});   // Some units too
+
+        CdclSolver plain;
+        while (plain.num_vars() < vars) plain.new_var();
+        for (const auto& c : cnf) plain.add_clause(c);
+        const SolverStatus expected = plain.solve();
+
+        std::vector<int8_t> model;
+        const SolverStatus got = solve_simplified(cnf, vars, model);
+        assert(got == expected);
+        if (got == SolverStatus::SATISFIABLE) {
+            ++sat;
+            assert(satisfies(model, cnf));
+        }
+    }
+    assert(sat > 0 && sat < 60);
+    std::cout << "Preprocessor Random Test Passed!" << std::endl;
+}
+
+void test_preprocessor_circuit() {
+    std::cout << "Running Preprocessor Circuit Test..." << std::endl;
+    unsigned vars = 0;
+    Cnf cnf = circuit(300, 20000, 17, vars);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    CdclSolver plain;
+    for (const auto& c : cnf) plain.add_clause(c);
+    const SolverStatus expected = plain.solve();
+    auto mid = std::chrono::high_resolution_clock::now();
+
+    std::vector<int8_t> model;
+    Preprocessor::Stats stats;
+    const SolverStatus got = solve_simplified(cnf, vars, model, &stats);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::cout << "  " << stats.clauses_before << " -> " << stats.clauses_after << " clauses, "
+              << stats.eliminated << " eliminated, " << stats.pure << " pure, " << stats.fixed
+              << " fixed, " << stats.subsumed << " subsumed, " << stats.strengthened << " strengthened"
+              << std::endl;
+    std::cout << "  plain " << std::chrono::duration<double, std::milli>(mid - start).count()
+              << " ms, preprocessed " << std::chrono::duration<double, std::milli>(end - mid).count()
+              << " ms" << std::endl;
+    assert(got == expected);
+    assert(stats.clauses_after * 2 < stats.clauses_before);
+    if (got == SolverStatus::SATISFIABLE) assert(satisfies(model, cnf));
+    std::cout << "Preprocessor Circuit Test Passed!" << std::endl;
+}
+
+void test_sat_solver_preprocess() {
+    std::cout << "Running SatSolver Preprocess Test..." << std::endl;
+    for (const char* mode : {"cdcl", "dpll"}) {
+        for (const char* pre : {"true", "false"}) {
+            SatSolver solver;
+            solver.set_param("mode", mode);
+            solver.set_param("preprocess", pre);
+            assert(solver.check("(a | b) & (!a | c) & (!b | c) & (!c | d) & (e | !d) & (!e | !a)") ==
+                   SolverStatus::SATISFIABLE);
+            auto m = solver.get_model();
+            auto t = [&m](const char* v) { return m[v] == "true"; };
+            assert(t("a") || t("b"));
+            assert(!t("a") || t("c"));
+            assert(!t("b") || t("c"));
+            assert(!t("c") || t("d"));
+            assert(t("e") || !t("d"));
+            assert(!t("e") || !t("a"));
+            assert(solver.check("(x | y) & (!x | y) & (x | !y) & (!x | !y)") == SolverStatus::UNSATISFIABLE);
+        }
+    }
+    std::cout << "SatSolver Preprocess Test Passed!" << std::endl;
+}
+
+int main() {
+    test_preprocessor_techniques();
+    test_preprocessor_random();
+    test_preprocessor_circuit();
+    test_sat_solver_preprocess();
+    return 0;
+}
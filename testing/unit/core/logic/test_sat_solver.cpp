@@ -1,11 +1,52 @@
 #include "../../../../src/core/logic/SatSolver.h"
+#include "../../../../src/core/logic/CdclSolver.h"
+#include "../../../../src/core/logic/ClauseArena.h"
+#include "cnf_fixtures.h"
 #include <iostream>
 #include <cassert>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using minni::logic::CdclSolver;
+using minni::logic::ClauseArena;
+using minni::logic::CRef;
+using minni::logic::Lit;
+using minni::logic::make_lit;
+using minni::logic::lit_var;
+using minni::logic::lit_negated;
+using minni::logic::SolverStatus;
+
+static bool model_satisfies(const CdclSolver& solver, const Cnf& cnf) {
+    for (const auto& c : cnf) {
+        bool sat = false;
+        for (Lit l : c) sat = sat || (solver.model_value(lit_var(l)) != lit_negated(l));
+        if (!sat) return false;
+    }
+    return true;
+}
+
+static std::string to_formula(const Cnf& cnf) {
+    std::string f;
+    for (size_t i = 0; i < cnf.size(); ++i) {
+        if (i) f += " & ";
+        for (size_t k = 0; k < cnf[i].size(); ++k) {
+            if (k) f += " | ";
+            if (lit_negated(cnf[i][k])) f += "!";
+            f += "x" + std::to_string(lit_var(cnf[i][k]));
+        }
+    }
+    return f;
+}
 
 void test_sat_solver_simple() {
     std::cout << "Running SAT Solver Simple Test..." << std::endl;
 
+    for (const char* mode : {"cdcl", "dpll"}) {
     minni::logic::SatSolver solver;
+    solver.set_param("mode", mode);
 
     // (A or B) AND (Not A) -> Must be B=True, A=False
     std::string formula = "A | B & !A";
@@ -16,6 +57,7 @@ void test_sat_solver_simple() {
 
     assert(model["A"] == "false");
     assert(model["B"] == "true");
+    }
 
     std::cout << "SAT Solver Simple Test Passed!" << std::endl;
 }
@@ -23,19 +65,364 @@ void test_sat_solver_simple() {
 void test_sat_solver_unsat() {
     std::cout << "Running SAT Solver UNSAT Test..." << std::endl;
 
+    for (const char* mode : {"cdcl", "dpll"}) {
     minni::logic::SatSolver solver;
+    solver.set_param("mode", mode);
 
     // A AND Not A -> Impossible
     std::string formula = "A & !A";
     auto status = solver.check(formula);
 
     assert(status == minni::logic::SolverStatus::UNSATISFIABLE);
+    }
 
     std::cout << "SAT Solver UNSAT Test Passed!" << std::endl;
 }
 
+void test_cdcl_matches_dpll() {
+    std::cout << "Running CDCL vs DPLL Test..." << std::endl;
+    // Small instances around the phase transition: both modes must agree
+    int sat_count = 0;
+    for (unsigned seed = 1; seed <= 30; ++seed) {
+        std::string formula = to_formula(random_3sat(20, 85, seed, nullptr));
+        minni::logic::SatSolver cdcl, dpll;
+        dpll.set_param("mode", "dpll");
+        cdcl.set_param("restart", seed % 2 ? "luby" : "glucose");
+        SolverStatus a = cdcl.check(formula);
+        SolverStatus b = dpll.check(formula);
+        assert(a == b);
+        if (a == SolverStatus::SATISFIABLE) ++sat_count;
+    }
+    assert(sat_count > 0 && sat_count < 30);
+    std::cout << "CDCL vs DPLL Test Passed!" << std::endl;
+}
+
+void test_clause_arena() {
+    std::cout << "Running Clause Arena Test..." << std::endl;
+    ClauseArena arena;
+    const uint32_t a[] = {2, 5, 9}, b[] = {4, 7}, c[] = {1, 3, 6, 8};
+    const CRef ca = arena.alloc(a, 3, false);
+    const CRef cb = arena.alloc(b, 2, true);
+    const CRef cc = arena.alloc(c, 4, true);
+    assert(arena.clause_size(ca) == 3 && !arena.learnt(ca) && arena.lits(ca)[2] == 9);
+    assert(arena.learnt(cb) && arena.lbd(cb) == 2);
+    arena.set_lbd(cc, 3);
+    arena.set_activity(cc, 1.5f);
+    assert(arena.lbd(cc) == 3 && arena.activity(cc) == 1.5f && arena.lits(cc)[3] == 8);
+    assert(arena.size() == (1 + 3) + (1 + 2 + 2) + (1 + 4 + 2));
+
+    arena.free(cb);
+    arena.free(cb);   // Idempotent
+    assert(arena.deleted(cb) && arena.wasted() == 5);
+
+    // Compaction: live clauses move, repeated references follow the forwarding entry
+    ClauseArena to;
+    CRef refs[] = {cc, ca, cc};
+    for (CRef& r : refs) arena.move_to(to, r);
+    assert(refs[0] == refs[2] && refs[0] == 0);
+    assert(to.size() == 7 + 4 && to.wasted() == 0);
+    assert(to.lbd(refs[0]) == 3 && to.activity(refs[0]) == 1.5f && to.lits(refs[0])[0] == 1);
+    assert(to.clause_size(refs[1]) == 3 && to.lits(refs[1])[1] == 5);
+
+    // Frequent reductions force many compactions mid-search; answers stay right
+    CdclSolver::Options options;
+    options.reduce_first = 50;
+    options.reduce_increment = 10;
+    CdclSolver solver(options);
+    for (const auto& cl : pigeonhole(8, 7)) solver.add_clause(cl);
+    assert(solver.solve() == SolverStatus::UNSATISFIABLE);
+    for (unsigned seed = 1; seed <= 10; ++seed) {
+        Cnf cnf = random_3sat(150, 639, seed, nullptr);
+        CdclSolver churn(options), plain;
+        for (const auto& cl : cnf) {
+            churn.add_clause(cl);
+            plain.add_clause(cl);
+        }
+        const SolverStatus status = churn.solve();
+        assert(status == plain.solve());
+        if (status == SolverStatus::SATISFIABLE) assert(model_satisfies(churn, cnf));
+    }
+    std::cout << "Clause Arena Test Passed!" << std::endl;
+}
+
+void test_cdcl_pigeonhole() {
+    std::cout << "Running CDCL Pigeonhole Test..." << std::endl;
+    // 7 pigeons, 6 holes: UNSAT, needs real clause learning
+    for (auto restart : {CdclSolver::Restart::LUBY, CdclSolver::Restart::GLUCOSE}) {
+        CdclSolver::Options options;
+        options.restart = restart;
+        CdclSolver solver(options);
+        for (const auto& c : pigeonhole(7, 6)) solver.add_clause(c);
+        assert(solver.solve() == SolverStatus::UNSATISFIABLE);
+        assert(solver.num_conflicts() > 0);
+    }
+    std::cout << "CDCL Pigeonhole Test Passed!" << std::endl;
+}
+
+void test_cdcl_large() {
+    std::cout << "Running CDCL Large Instance Test..." << std::endl;
+    // 50k clauses over 15k variables with a planted solution
+    const unsigned vars = 15000, clauses = 50000;
+    std::vector<bool> planted(vars);
+    Rng rng{99};
+    for (unsigned v = 0; v < vars; ++v) planted[v] = rng.next(2) != 0;
+    Cnf cnf = random_3sat(vars, clauses, 5, &planted);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    CdclSolver solver;
+    for (const auto& c : cnf) solver.add_clause(c);
+    SolverStatus status = solver.solve();
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "  50k clauses: " << std::chrono::duration<double, std::milli>(end - start).count()
+              << " ms, " << solver.num_conflicts() << " conflicts" << std::endl;
+    assert(status == SolverStatus::SATISFIABLE);
+    assert(model_satisfies(solver, cnf));
+
+    // Random instances near the threshold: every SAT answer carries a valid model
+    for (unsigned seed = 1; seed <= 10; ++seed) {
+        Cnf hard = random_3sat(150, 639, seed, nullptr);
+        CdclSolver s;
+        for (const auto& c : hard) s.add_clause(c);
+        if (s.solve() == SolverStatus::SATISFIABLE) assert(model_satisfies(s, hard));
+    }
+    std::cout << "CDCL Large Instance Test Passed!" << std::endl;
+}
+
+void test_cdcl_incremental() {
+    std::cout << "Running CDCL Incremental Test..." << std::endl;
+    CdclSolver solver;
+    const Lit a = make_lit(0), b = make_lit(1), c = make_lit(2);
+    solver.add_clause({make_lit(0, true), make_lit(1, true)});   // !a | !b
+    solver.add_clause({make_lit(1, true), c});                   // !b | c
+
+    assert(solver.solve({a, c}) == SolverStatus::SATISFIABLE);
+    assert(solver.solve({a, b}) == SolverStatus::UNSATISFIABLE);
+    assert(solver.core().size() == 2);
+    assert(solver.solve({c, make_lit(2, true)}) == SolverStatus::UNSATISFIABLE);
+    assert(solver.core().size() == 2);
+    // Failed assumptions do not poison the solver
+    assert(solver.solve() == SolverStatus::SATISFIABLE);
+
+    // Scopes
+    solver.push();
+    solver.add_clause({make_lit(2, true)});                      // !c, scoped
+    assert(solver.solve({b}) == SolverStatus::UNSATISFIABLE);
+    assert(solver.core().size() == 1 && solver.core()[0] == b);
+    solver.push();
+    solver.add_clause({a});
+    assert(solver.solve() == SolverStatus::SATISFIABLE && solver.model_value(0));
+    assert(solver.pop());
+    assert(solver.pop());
+    assert(!solver.pop());
+    assert(solver.solve({b}) == SolverStatus::SATISFIABLE);
+    assert(solver.model_value(2));
+
+    // pop() deletes the scope and reuses its selector: repeated scopes do not grow the
+    // solver, and each one answers like a fresh solver with the same clauses
+    {
+        std::vector<bool> planted(60, true);
+        planted[0] = false;
+        Cnf base = random_3sat(60, 200, 77, &planted);
+        CdclSolver scoped;
+        for (const auto& cl : base) scoped.add_clause(cl);
+        scoped.push();
+        assert(scoped.pop());
+        const uint32_t vars = scoped.num_vars();
+        const size_t clauses = scoped.num_clauses();
+        for (unsigned round = 0; round < 200; ++round) {
+            Cnf extra = random_3sat(60, 60, 1000 + round, nullptr);
+            scoped.push();
+            for (const auto& cl : extra) scoped.add_clause(cl);
+            SolverStatus got = scoped.solve();
+            assert(scoped.pop());
+            assert(scoped.num_vars() == vars && scoped.num_clauses() == clauses);
+
+            CdclSolver fresh;
+            for (const auto& cl : base) fresh.add_clause(cl);
+            for (const auto& cl : extra) fresh.add_clause(cl);
+            assert(got == fresh.solve());
+        }
+        assert(scoped.solve() == SolverStatus::SATISFIABLE);
+        assert(model_satisfies(scoped, base));
+
+        // A scope that is inconsistent at level 0 is released as well
+        scoped.add_clause({make_lit(0, true)});
+        scoped.push();
+        scoped.add_clause({make_lit(0)});
+        assert(scoped.solve() == SolverStatus::UNSATISFIABLE && scoped.core().empty());
+        assert(scoped.pop());
+        assert(scoped.num_vars() == vars);
+        scoped.push();
+        scoped.add_clause({make_lit(1)});
+        assert(scoped.solve() == SolverStatus::SATISFIABLE && scoped.model_value(1));
+        assert(scoped.pop());
+        assert(scoped.solve({make_lit(1, true)}) == SolverStatus::SATISFIABLE);
+    }
+
+    // Random formulas: answers match a fresh solver with unit clauses, cores are UNSAT
+    Rng rng{11};
+    for (unsigned round = 0; round < 40; ++round) {
+        Cnf cnf = random_3sat(40, 150, 100 + round, nullptr);
+        CdclSolver inc;
+        for (const auto& cl : cnf) inc.add_clause(cl);
+        for (int query = 0; query < 5; ++query) {
+            std::vector<Lit> assumptions;
+            for (int k = 0; k < 6; ++k) assumptions.push_back(make_lit(rng.next(40), rng.next(2) != 0));
+            SolverStatus got = inc.solve(assumptions);
+
+            CdclSolver fresh;
+            for (const auto& cl : cnf) fresh.add_clause(cl);
+            for (Lit l : assumptions) fresh.add_clause({l});
+            assert(got == fresh.solve());
+            if (got == SolverStatus::SATISFIABLE) {
+                assert(model_satisfies(inc, cnf));
+                for (Lit l : assumptions) assert(inc.model_value(lit_var(l)) != lit_negated(l));
+            } else {
+                CdclSolver check;
+                for (const auto& cl : cnf) check.add_clause(cl);
+                for (Lit l : inc.core()) {
+                    assert(std::find(assumptions.begin(), assumptions.end(), l) != assumptions.end());
+                    check.add_clause({l});
+                }
+                assert(check.solve() == SolverStatus::UNSATISFIABLE);
+            }
+        }
+    }
+    std::cout << "CDCL Incremental Test Passed!" << std::endl;
+}
+
+void test_sat_solver_incremental() {
+    std::cout << "Running SatSolver Incremental Test..." << std::endl;
+    for (const char* mode : {"cdcl", "dpll"}) {
+        minni::logic::SatSolver solver;
+        solver.set_param("mode", mode);
+        assert(solver.add("!rain | umbrella"));
+        assert(solver.add("!umbrella | !sunglasses"));
+
+        assert(solver.solve({"rain"}) == SolverStatus::SATISFIABLE);
+        assert(solver.get_model()["umbrella"] == "true");
+        assert(solver.solve({"rain", "sunglasses", "!night"}) == SolverStatus::UNSATISFIABLE);
+        auto core = solver.get_unsat_core();
+        assert(std::find(core.begin(), core.end(), "rain") != core.end());
+        assert(std::find(core.begin(), core.end(), "sunglasses") != core.end());
+        if (std::string(mode) == "cdcl") assert(core.size() == 2);
+
+        solver.push();
+        assert(solver.add("!rain"));
+        assert(solver.solve({"rain"}) == SolverStatus::UNSATISFIABLE);
+        assert(solver.pop());
+        assert(!solver.pop());
+        assert(solver.solve({"rain"}) == SolverStatus::SATISFIABLE);
+        assert(solver.add("p cnf 1 1\nbad 0\n") == false);
+        assert(solver.solve({}) == SolverStatus::SATISFIABLE);
+
+        // check() is still a one-shot query
+        assert(solver.check("A & !A") == SolverStatus::UNSATISFIABLE);
+        assert(solver.check("A") == SolverStatus::SATISFIABLE);
+    }
+    std::cout << "SatSolver Incremental Test Passed!" << std::endl;
+}
+
+void test_cdcl_limits() {
+    std::cout << "Running CDCL Limits Test..." << std::endl;
+    // 12 pigeons / 11 holes runs far longer than any of the limits below
+    const Cnf hard = pigeonhole(12, 11);
+    using Clock = std::chrono::steady_clock;
+
+    {
+        CdclSolver solver;
+        for (const auto& c : hard) solver.add_clause(c);
+        CdclSolver::Limits limits;
+        limits.conflicts = 1000;
+        solver.set_limits(limits);
+        assert(solver.solve() == SolverStatus::UNKNOWN);
+        assert(solver.num_conflicts() == 1000);
+        // Budgets are per call
+        assert(solver.solve() == SolverStatus::UNKNOWN);
+        assert(solver.num_conflicts() == 2000);
+
+        limits = CdclSolver::Limits();
+        limits.propagations = 50000;
+        solver.set_limits(limits);
+        const uint64_t before = solver.num_propagations();
+        assert(solver.solve() == SolverStatus::UNKNOWN);
+        assert(solver.num_propagations() - before < 60000);
+    }
+    {
+        CdclSolver solver;
+        for (const auto& c : hard) solver.add_clause(c);
+        CdclSolver::Limits limits;
+        limits.timeout_ms = 100;
+        solver.set_limits(limits);
+        auto start = Clock::now();
+        assert(solver.solve() == SolverStatus::TIMEOUT);
+        double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        std::cout << "  timeout 100 ms -> returned after " << ms << " ms" << std::endl;
+        assert(ms >= 100 && ms < 1000);
+    }
+    {
+        // interrupt() from another thread
+        CdclSolver solver;
+        for (const auto& c : hard) solver.add_clause(c);
+        auto start = Clock::now();
+        std::thread canceller([&solver] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            solver.interrupt();
+        });
+        assert(solver.solve() == SolverStatus::UNKNOWN);
+        canceller.join();
+        double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        assert(ms < 1000);
+        // Pending until cleared; the solver stays usable afterwards
+        assert(solver.solve() == SolverStatus::UNKNOWN);
+        solver.clear_interrupt();
+        assert(solver.solve({make_lit(0, true), make_lit(0)}) == SolverStatus::UNSATISFIABLE);
+    }
+    std::cout << "CDCL Limits Test Passed!" << std::endl;
+}
+
+void test_sat_solver_limits() {
+    std::cout << "Running SatSolver Limits Test..." << std::endl;
+    const std::string hard = to_formula(pigeonhole(12, 11));
+    for (const char* mode : {"cdcl", "dpll"}) {
+        minni::logic::SatSolver solver;
+        solver.set_param("mode", mode);
+        solver.set_param("timeout", "80");
+        solver.set_param("timeout", "-5");   // Ignored
+        assert(solver.check(hard) == SolverStatus::TIMEOUT);
+        assert(solver.get_model().empty());
+        assert(solver.check("A & (!A | B)") == SolverStatus::SATISFIABLE);
+
+        solver.set_param("timeout", "0");
+        std::thread canceller([&solver] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            solver.interrupt();
+        });
+        assert(solver.check(hard) == SolverStatus::UNKNOWN);
+        canceller.join();
+        // The cancel was consumed by the interrupted query
+        assert(solver.check("A & !A") == SolverStatus::UNSATISFIABLE);
+    }
+    minni::logic::SatSolver solver;
+    solver.set_param("max_conflicts", "500");
+    assert(solver.add(hard));
+    assert(solver.solve({}) == SolverStatus::UNKNOWN);
+    solver.set_param("max_conflicts", "0");
+    solver.set_param("max_propagations", "10000");
+    assert(solver.solve({}) == SolverStatus::UNKNOWN);
+    std::cout << "SatSolver Limits Test Passed!" << std::endl;
+}
+
 int main() {
     test_sat_solver_simple();
     test_sat_solver_unsat();
+    test_cdcl_matches_dpll();
+    test_clause_arena();
+    test_cdcl_pigeonhole();
+    test_cdcl_large();
+    test_cdcl_incremental();
+    test_sat_solver_incremental();
+    test_cdcl_limits();
+    test_sat_solver_limits();
     return 0;
 }
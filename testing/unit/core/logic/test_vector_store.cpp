@@ -3,6 +3,8 @@
 #include <cassert>
 #include <vector>
 #include <cmath>
+#include <random>
+#include <string>
 
 bool float_eq(float a, float b, float epsilon = 1e-4) {
     return std::abs(a - b) < epsilon;
@@ -62,8 +64,56 @@ void test_vector_store_empty() {
     std::cout << "VectorStore Empty/Mismatch Test Passed!" << std::endl;
 }
 
+void test_vector_store_prefix_search() {
+    std::cout << "Running VectorStore Prefix (Matryoshka) Search Test..." << std::endl;
+    const size_t dim = 64;
+
+    std::mt19937 gen(11);
+    std::normal_distribution<float> dis(0.0f, 1.0f);
+    std::vector<std::vector<float>> vectors;
+    for (int i = 0; i < 200; ++i) {
+        std::vector<float> v(dim);
+        for (auto& x : v) x = dis(gen);
+        vectors.push_back(v);
+    }
+
+    for (bool quantized : {false, true}) {
+        minni::logic::VectorStore db(quantized);
+        // Prefix must be shorter than the vectors
+        db.add_vector("v0", vectors[0]);
+        assert(!db.set_prefix_dim(dim));
+        assert(db.set_prefix_dim(16)); // Re-indexes existing vectors
+        for (size_t i = 1; i < vectors.size(); ++i) {
+            db.add_vector("v" + std::to_string(i), vectors[i]);
+        }
+        assert(db.prefix_dim() == 16);
+
+        // Querying a stored vector finds it with its full-dimension score
+        auto results = db.search_prefix(vectors[42], 5);
+        assert(results.size() == 5);
+        assert(results[0].first == "v42");
+        assert(results[0].second > 0.98f);
+
+        // Keeping every candidate reproduces the exhaustive ranking
+        auto exact = db.search(vectors[7], 10);
+        auto coarse = db.search_prefix(vectors[7], 10, vectors.size());
+        for (size_t i = 0; i < exact.size(); ++i) {
+            assert(exact[i].first == coarse[i].first);
+            assert(float_eq(exact[i].second, coarse[i].second));
+        }
+
+        // limit 0 returns nothing, like search()
+        assert(db.search(vectors[3], 0).empty());
+        assert(db.search_prefix(vectors[3], 0).empty());
+        assert(db.search_prefix(vectors[3], 0, vectors.size()).empty());
+    }
+
+    std::cout << "VectorStore Prefix Search Test Passed!" << std::endl;
+}
+
 int main() {
     test_vector_store_search();
     test_vector_store_empty();
+    test_vector_store_prefix_search();
     return 0;
 }
@@ -0,0 +1,117 @@
+#include "../../../../src/core/optimization/KMeansTrainer.h"
+#include "../../../../src/core/optimization/ProductQuantizer.h"
+#include "../../../../src/core/logic/VectorStore.h"
+#include <iostream>
+#include <cassert>
+#include <vector>
+#include <random>
+#include <string>
+#include <cstdio> // for remove()
+
+void test_kmeans_clusters() {
+    std::cout << "Running KMeans Trainer Test..." << std::endl;
+
+    // Three well separated blobs in 2D
+    const float centers[3][2] = {{0.0f, 0.0f}, {10.0f, 10.0f}, {-10.0f, 10.0f}};
+    std::mt19937 gen(1);
+    std::normal_distribution<float> noise(0.0f, 0.5f);
+
+    std::vector<float> data;
+    for (int i = 0; i < 300; ++i) {
+        data.push_back(centers[i % 3][0] + noise(gen));
+        data.push_back(centers[i % 3][1] + noise(gen));
+    }
+
+    minni::optimization::KMeansTrainer::Config config;
+    config.num_clusters = 3;
+    config.batch_size = 0; // Lloyd
+    config.num_threads = 2;
+
+    minni::optimization::KMeansTrainer trainer(config);
+    assert(trainer.train(data.data(), 300, 2));
+    assert(trainer.num_clusters() == 3);
+
+    // Points from the same blob share a cluster, different blobs do not
+    std::vector<uint32_t> labels(300);
+    trainer.assign_all(data.data(), 300, labels.data());
+    for (int i = 3; i < 300; ++i) {
+        assert(labels[i] == labels[i % 3]);
+    }
+    assert(labels[0] != labels[1] && labels[1] != labels[2] && labels[0] != labels[2]);
+
+    // Same seed -> same centroids, regardless of thread count
+    config.num_threads = 1;
+    minni::optimization::KMeansTrainer again(config);
+    again.train(data.data(), 300, 2);
+    assert(again.centroids() == trainer.centroids());
+
+    std::cout << "KMeans Trainer Test Passed!" << std::endl;
+}
+
+void test_product_quantizer_roundtrip() {
+    std::cout << "Running ProductQuantizer Test..." << std::endl;
+    const std::string filename = "test_pq.bin";
+    const size_t dim = 16;
+    const size_t n = 2000;
+
+    // Train from a VectorStore sample
+    minni::logic::VectorStore db(false);
+    std::mt19937 gen(3);
+    std::normal_distribution<float> dis(0.0f, 1.0f);
+    for (size_t i = 0; i < n; ++i) {
+        std::vector<float> v(dim);
+        for (auto& x : v) x = dis(gen);
+        db.add_vector("v" + std::to_string(i), v);
+    }
+    std::vector<float> sample = db.sample(1000, 9);
+    assert(sample.size() == 1000 * dim);
+    assert(db.sample(1000, 9) == sample);
+
+    minni::optimization::ProductQuantizer pq(dim, 4, 32);
+    assert(pq.train(sample.data(), 1000));
+    assert(pq.code_size() == 4);
+
+    // Reconstruction error must be well below the data variance (1 per dim)
+    std::vector<uint8_t> codes(1000 * pq.code_size());
+    pq.encode_batch(sample.data(), 1000, codes.data());
+    std::vector<float> table(pq.num_subspaces() * pq.num_centroids());
+    std::vector<float> recon(dim);
+    double mse = 0.0;
+    for (size_t i = 0; i < 1000; ++i) {
+        const float* vec = sample.data() + i * dim;
+        pq.decode(codes.data() + i * pq.code_size(), recon.data());
+        double err = 0.0;
+        for (size_t d = 0; d < dim; ++d) err += (vec[d] - recon[d]) * (vec[d] - recon[d]);
+        mse += err / dim;
+
+        // ADC distance to its own code equals the reconstruction error
+        pq.compute_distance_table(vec, table.data());
+        float adc = pq.distance_from_table(table.data(), codes.data() + i * pq.code_size());
+        assert(std::abs(adc - err) < 1e-3 * (1.0 + err));
+    }
+    mse /= 1000;
+    std::cout << "  PQ reconstruction MSE: " << mse << std::endl;
+    assert(mse < 0.5);
+
+    // Serialization round trip
+    assert(pq.save(filename));
+    minni::optimization::ProductQuantizer loaded;
+    assert(loaded.load(filename));
+    assert(loaded.dimension() == dim && loaded.num_subspaces() == 4 && loaded.num_centroids() == 32);
+    for (size_t m = 0; m < 4; ++m) {
+        assert(loaded.codebook(m) == pq.codebook(m));
+    }
+    std::vector<uint8_t> code_a(4), code_b(4);
+    pq.encode(sample.data(), code_a.data());
+    loaded.encode(sample.data(), code_b.data());
+    assert(code_a == code_b);
+
+    std::remove(filename.c_str());
+    std::cout << "ProductQuantizer Test Passed!" << std::endl;
+}
+
+int main() {
+    test_kmeans_clusters();
+    test_product_quantizer_roundtrip();
+    return 0;
+}
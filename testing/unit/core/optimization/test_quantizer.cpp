@@ -46,7 +46,34 @@ void test_quantization() {
     std::cout << "Quantizer Test Passed!" << std::endl;
 }
 
+void test_symmetric_and_int4() {
+    std::cout << "Running Symmetric/Int4 Quantizer Test..." << std::endl;
+    using minni::optimization::Quantizer;
+
+    std::vector<float> data = {-0.8f, -0.3f, 0.0f, 0.25f, 0.6f, 1.0f, -1.0f};
+
+    // Symmetric: zero maps exactly to zero
+    auto sym = Quantizer::calculate_symmetric_params(data.data(), data.size());
+    assert(sym.zero_point == 0);
+    assert(Quantizer::quantize_scalar(0.0f, sym) == 0);
+    assert(Quantizer::quantize_scalar(1.0f, sym) == 127);
+    assert(Quantizer::quantize_scalar(-1.0f, sym) == -127);
+
+    // Int4: packed two per byte, error within half a step
+    auto p4 = Quantizer::calculate_int4_params(data.data(), data.size());
+    std::vector<uint8_t> packed((data.size() + 1) / 2);
+    Quantizer::quantize_int4(data.data(), data.size(), p4, packed.data());
+    std::vector<float> restored(data.size());
+    Quantizer::dequantize_int4(packed.data(), data.size(), p4, restored.data());
+    for (size_t i = 0; i < data.size(); ++i) {
+        assert(std::abs(data[i] - restored[i]) <= p4.scale / 2.0f + 1e-5f);
+    }
+
+    std::cout << "Symmetric/Int4 Quantizer Test Passed!" << std::endl;
+}
+
 int main() {
     test_quantization();
+    test_symmetric_and_int4();
     return 0;
 }
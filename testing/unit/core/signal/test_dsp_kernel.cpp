@@ -1,7 +1,9 @@
 #include "../../../../src/core/signal/DSPKernel.h"
+#include "../../../../src/core/signal/PartitionedConvolver.h"
 #include <iostream>
 #include <cassert>
 #include <vector>
+#include <random>
 #include <cmath>
 
 bool approx_equal(float a, float b, float epsilon = 0.001f) {
@@ -58,8 +60,70 @@ void test_fir_filter() {
     std::cout << "FIR Filter Test Passed!" << std::endl;
 }
 
+// Reference causal convolution in double precision
+std::vector<float> reference_fir(const std::vector<float>& input, const std::vector<float>& taps) {
+    std::vector<float> out(input.size());
+    for (size_t i = 0; i < input.size(); ++i) {
+        double acc = 0.0;
+        for (size_t j = 0; j < taps.size() && j <= i; ++j) acc += double(input[i - j]) * taps[j];
+        out[i] = static_cast<float>(acc);
+    }
+    return out;
+}
+
+void test_fir_filter_paths() {
+    std::cout << "Running FIR Filter Paths Test..." << std::endl;
+    std::mt19937 gen(3);
+    std::uniform_real_distribution<float> dis(-1.0f, 1.0f);
+
+    std::vector<float> input(5003);
+    for (auto& x : input) x = dis(gen);
+
+    // Short (direct, SIMD body + scalar head/tail) and long (partitioned FFT) filters
+    for (size_t taps_size : {1, 3, 17, 63, 300, 1025}) {
+        std::vector<float> taps(taps_size);
+        for (auto& t : taps) t = dis(gen) / taps_size;
+        std::vector<float> expected = reference_fir(input, taps);
+
+        std::vector<float> output(input.size());
+        minni::signal::DSPKernel::fir_filter(input.data(), input.size(), taps.data(), taps_size, output.data());
+        for (size_t i = 0; i < input.size(); ++i) assert(approx_equal(output[i], expected[i]));
+
+        minni::signal::DSPKernel::fir_filter_direct(input.data(), input.size(), taps.data(), taps_size, output.data());
+        for (size_t i = 0; i < input.size(); ++i) assert(approx_equal(output[i], expected[i]));
+    }
+
+    // The cached convolver is rebuilt when the same tap buffer is overwritten
+    std::vector<float> reused(1025);
+    for (int round = 0; round < 3; ++round) {
+        for (auto& t : reused) t = dis(gen) / 1025.0f;
+        std::vector<float> expected = reference_fir(input, reused);
+        std::vector<float> output(input.size());
+        for (int call = 0; call < 2; ++call) {
+            minni::signal::DSPKernel::fir_filter(input.data(), input.size(), reused.data(), reused.size(), output.data());
+            for (size_t i = 0; i < input.size(); ++i) assert(approx_equal(output[i], expected[i]));
+        }
+    }
+
+    // Streaming with many small partitions matches the one-shot result
+    std::vector<float> taps(300);
+    for (auto& t : taps) t = dis(gen) / 300.0f;
+    std::vector<float> expected = reference_fir(input, taps);
+    minni::signal::PartitionedConvolver convolver(taps.data(), taps.size(), 32);
+    assert(convolver.block_size() == 32 && convolver.num_partitions() == 10);
+
+    std::vector<float> block(32);
+    for (size_t i = 0; i + 32 <= input.size(); i += 32) {
+        convolver.process_block(input.data() + i, block.data());
+        for (size_t k = 0; k < 32; ++k) assert(approx_equal(block[k], expected[i + k]));
+    }
+
+    std::cout << "FIR Filter Paths Test Passed!" << std::endl;
+}
+
 int main() {
     test_complex_magnitude();
     test_fir_filter();
+    test_fir_filter_paths();
     return 0;
 }
@@ -1,8 +1,10 @@
 #include "../../../../src/core/signal/DSPKernel.h"
+#include "../../../../src/core/signal/FFTPlan.h"
 #include <iostream>
 #include <vector>
 #include <cmath>
 #include <cassert>
+#include <random>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -72,9 +74,157 @@ void test_fft_sine() {
     std::cout << "FFT Sine Test Passed!" << std::endl;
 }
 
+void test_fft_plan_accuracy() {
+    std::cout << "Running FFT Plan Accuracy Test..." << std::endl;
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<float> dis(-1.0f, 1.0f);
+
+    // Covers odd/even stage counts and sizes above the cache block (global passes)
+    for (size_t size = 2; size <= 16384; size <<= 1) {
+        minni::signal::FFTPlan plan(size);
+        assert(plan.is_valid());
+
+        std::vector<float> in_r(size), in_i(size);
+        for (size_t i = 0; i < size; ++i) {
+            in_r[i] = dis(gen);
+            in_i[i] = dis(gen);
+        }
+        std::vector<float> real = in_r, imag = in_i;
+        plan.forward(real.data(), imag.data());
+
+        // Reference DFT in double on a few bins
+        double max_err = 0.0;
+        for (size_t k = 0; k < size; k += std::max<size_t>(1, size / 16)) {
+            double ref_r = 0.0, ref_i = 0.0;
+            for (size_t n = 0; n < size; ++n) {
+                double ang = -2.0 * M_PI * static_cast<double>((k * n) % size) / size;
+                ref_r += in_r[n] * std::cos(ang) - in_i[n] * std::sin(ang);
+                ref_i += in_r[n] * std::sin(ang) + in_i[n] * std::cos(ang);
+            }
+            max_err = std::max(max_err, std::abs(ref_r - real[k]) + std::abs(ref_i - imag[k]));
+        }
+        assert(max_err < 1e-5 * size);
+
+        // Round trip
+        plan.inverse(real.data(), imag.data());
+        for (size_t i = 0; i < size; ++i) {
+            assert(float_eq(real[i], in_r[i]) && float_eq(imag[i], in_i[i]));
+        }
+    }
+
+    // Sign convention: e^{+2*pi*i*n/N} lands in bin 1
+    size_t size = 64;
+    std::vector<float> real(size), imag(size);
+    for (size_t n = 0; n < size; ++n) {
+        real[n] = std::cos(2.0 * M_PI * n / size);
+        imag[n] = std::sin(2.0 * M_PI * n / size);
+    }
+    minni::signal::DSPKernel::fft(real.data(), imag.data(), size, false);
+    assert(float_eq(real[1], 64.0f, 1e-3f));
+    assert(float_eq(real[size - 1], 0.0f, 1e-3f));
+
+    std::cout << "FFT Plan Accuracy Test Passed!" << std::endl;
+}
+
+void test_rfft() {
+    std::cout << "Running RFFT Test..." << std::endl;
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<float> dis(-1.0f, 1.0f);
+
+    for (size_t size = 2; size <= 4096; size <<= 1) {
+        std::vector<float> input(size);
+        for (auto& x : input) x = dis(gen);
+
+        // Reference: complex FFT with zero imaginary part
+        std::vector<float> ref_r = input, ref_i(size, 0.0f);
+        minni::signal::DSPKernel::fft(ref_r.data(), ref_i.data(), size, false);
+
+        std::vector<float> real(size / 2 + 1), imag(size / 2 + 1);
+        minni::signal::DSPKernel::rfft(input.data(), real.data(), imag.data(), size);
+        for (size_t k = 0; k <= size / 2; ++k) {
+            assert(float_eq(real[k], ref_r[k], 1e-3f));
+            assert(float_eq(imag[k], ref_i[k], 1e-3f));
+        }
+
+        std::vector<float> output(size);
+        minni::signal::DSPKernel::irfft(real.data(), imag.data(), output.data(), size);
+        for (size_t i = 0; i < size; ++i) {
+            assert(float_eq(output[i], input[i]));
+        }
+    }
+
+    // In place: input aliases the real output
+    minni::signal::RealFFTPlan plan(8);
+    std::vector<float> buf = {1, 0, 0, 0, 0, 0, 0, 0, 0};
+    std::vector<float> imag(5);
+    plan.forward(buf.data(), buf.data(), imag.data());
+    for (size_t k = 0; k < plan.bins(); ++k) {
+        assert(float_eq(buf[k], 1.0f) && float_eq(imag[k], 0.0f));
+    }
+
+    std::cout << "RFFT Test Passed!" << std::endl;
+}
+
+void test_fft_arbitrary_size() {
+    std::cout << "Running FFT Arbitrary Size Test..." << std::endl;
+    using minni::signal::FFTPlan;
+    std::mt19937 gen(13);
+    std::uniform_real_distribution<float> dis(-1.0f, 1.0f);
+
+    // 400 = 25 ms @ 16 kHz: mixed radix, no padding
+    FFTPlan frame(400);
+    assert(frame.algorithm() == FFTPlan::Algorithm::MIXED_RADIX);
+    assert((frame.radices() == std::vector<size_t>{4, 4, 5, 5}));
+    assert(FFTPlan(401).algorithm() == FFTPlan::Algorithm::BLUESTEIN); // Prime
+
+    for (size_t size : {3, 5, 6, 12, 14, 49, 97, 100, 400, 401, 1000}) {
+        FFTPlan plan(size);
+        assert(plan.is_valid());
+
+        std::vector<float> in_r(size), in_i(size);
+        for (size_t i = 0; i < size; ++i) {
+            in_r[i] = dis(gen);
+            in_i[i] = dis(gen);
+        }
+        std::vector<float> real = in_r, imag = in_i;
+        plan.forward(real.data(), imag.data());
+
+        for (size_t k = 0; k < size; ++k) {
+            double ref_r = 0.0, ref_i = 0.0;
+            for (size_t n = 0; n < size; ++n) {
+                double ang = -2.0 * M_PI * static_cast<double>((k * n) % size) / size;
+                ref_r += in_r[n] * std::cos(ang) - in_i[n] * std::sin(ang);
+                ref_i += in_r[n] * std::sin(ang) + in_i[n] * std::cos(ang);
+            }
+            assert(std::abs(ref_r - real[k]) < 1e-4 * size && std::abs(ref_i - imag[k]) < 1e-4 * size);
+        }
+
+        plan.inverse(real.data(), imag.data());
+        for (size_t i = 0; i < size; ++i) {
+            assert(float_eq(real[i], in_r[i]) && float_eq(imag[i], in_i[i]));
+        }
+    }
+
+    // Real FFT on a 400-sample frame (200-point mixed radix inside)
+    std::vector<float> input(400);
+    for (auto& x : input) x = dis(gen);
+    std::vector<float> ref_r = input, ref_i(400, 0.0f);
+    minni::signal::DSPKernel::fft(ref_r.data(), ref_i.data(), 400, false);
+    std::vector<float> real(201), imag(201);
+    minni::signal::DSPKernel::rfft(input.data(), real.data(), imag.data(), 400);
+    for (size_t k = 0; k <= 200; ++k) {
+        assert(float_eq(real[k], ref_r[k], 1e-3f) && float_eq(imag[k], ref_i[k], 1e-3f));
+    }
+
+    std::cout << "FFT Arbitrary Size Test Passed!" << std::endl;
+}
+
 int main() {
     test_fft_impulse();
     test_ifft_impulse();
     test_fft_sine();
+    test_fft_plan_accuracy();
+    test_rfft();
+    test_fft_arbitrary_size();
     return 0;
 }
@@ -1,4 +1,5 @@
 #include "../../../../src/core/signal/KalmanFilter.h"
+#include "../../../../src/core/signal/KalmanFilterBank.h"
 #include <iostream>
 #include <vector>
 #include <cmath>
@@ -37,8 +38,64 @@ void test_kalman_convergence() {
     std::cout << "Kalman Convergence Test Passed!" << std::endl;
 }
 
+void test_kalman_bank() {
+    std::cout << "Running Kalman Bank Test..." << std::endl;
+    // The bank must behave exactly like independent KalmanFilter objects
+    const size_t tracks = 1000;
+    minni::signal::KalmanFilterBank bank(tracks, 2.0f, 1.0f, 0.05f);
+    std::vector<minni::signal::KalmanFilter> singles(tracks, minni::signal::KalmanFilter(2.0f, 1.0f, 0.05f));
+    bank.set_params(7, 0.5f, 3.0f, 0.2f);
+    singles[7] = minni::signal::KalmanFilter(0.5f, 3.0f, 0.2f);
+    for (size_t t = 0; t < tracks; ++t) {
+        bank.reset(t, static_cast<float>(t % 50));
+        singles[t].reset(static_cast<float>(t % 50));
+    }
+
+    unsigned state = 42;
+    auto next = [&state]() {
+        state = state * 1103515245u + 12345u;
+        return (state >> 16) & 0x7fff;
+    };
+
+    // Dense update of all tracks
+    std::vector<float> z(tracks), est(tracks);
+    for (size_t t = 0; t < tracks; ++t) {
+        z[t] = static_cast<float>(t % 50) + (next() / 32768.0f - 0.5f);
+        singles[t].update(z[t]);
+    }
+    bank.update_all(z.data(), est.data());
+
+    // Indexed updates: random tracks with repeats (both within a chunk and across
+    // chunks), plus invalid indices that must be skipped
+    for (int round = 0; round < 5; ++round) {
+        const size_t count = 700;
+        std::vector<int32_t> idx(count);
+        std::vector<float> meas(count), out(count, -1.0f), expected(count, -1.0f);
+        for (size_t i = 0; i < count; ++i) {
+            idx[i] = (i % 97 == 0) ? -1 : static_cast<int32_t>(next() % 300);
+            if (i % 10 == 1) idx[i] = idx[i - 1] < 0 ? 5 : idx[i - 1];
+            meas[i] = static_cast<float>(next() % 50);
+            if (idx[i] >= 0) expected[i] = singles[idx[i]].update(meas[i]);
+        }
+        size_t applied = bank.update(idx.data(), meas.data(), count, out.data());
+        size_t valid = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (idx[i] >= 0) ++valid;
+            assert(std::abs(out[i] - expected[i]) < 1e-4f);
+        }
+        assert(applied == valid);
+    }
+
+    for (size_t t = 0; t < tracks; ++t) {
+        assert(std::abs(bank.get_estimate(t) - singles[t].get_estimate()) < 1e-4f);
+        assert(std::abs(bank.get_error_estimate(t) - singles[t].get_error_estimate()) < 1e-4f);
+    }
+    std::cout << "Kalman Bank Test Passed!" << std::endl;
+}
+
 int main() {
     test_kalman_constant();
     test_kalman_convergence();
+    test_kalman_bank();
     return 0;
 }
@@ -0,0 +1,128 @@
+#include "../../../../src/core/signal/MelSpectrogram.h"
+#include "../../../../src/core/genai/ModelRunner.h"
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cassert>
+#include <chrono>
+#include <algorithm>
+
+using namespace minni::signal;
+
+static const float kPi = 3.14159265f;
+
+void test_mel_tone_peak() {
+    std::cout << "Running Mel Tone Peak Test..." << std::endl;
+    MelSpectrogram mel;
+    const size_t sr = 16000;
+    const size_t n = sr; // 1 s
+    std::vector<float> audio(n);
+    for (size_t i = 0; i < n; ++i) {
+        audio[i] = 0.5f * std::sin(2.0f * kPi * 1000.0f * i / sr);
+    }
+
+    const size_t frames = mel.num_frames(n);
+    assert(frames == 101);
+    std::vector<float> out(frames * 80);
+    assert(mel.compute(audio.data(), n, out.data(), frames) == frames);
+
+    // Every interior frame peaks in the band containing 1 kHz (Slaney scale: 15 mel,
+    // i.e. band index ~ 15 / (mel(8 kHz) / 81) - 1)
+    const float* row = out.data() + 50 * 80;
+    size_t best = 0;
+    for (size_t m = 1; m < 80; ++m) {
+        if (row[m] > row[best]) best = m;
+    }
+    assert(best >= 25 && best <= 30);
+    // A pure tone leaves far-away bands near the floor
+    assert(row[best] - row[79] > 4.0f);
+    std::cout << "Mel Tone Peak Test Passed!" << std::endl;
+}
+
+void test_mel_layout_and_streaming() {
+    std::cout << "Running Mel Layout/Streaming Test..." << std::endl;
+    MelSpectrogram::Config config;
+    config.n_fft = 256;
+    config.hop_length = 128;
+    config.n_mels = 40;
+    MelSpectrogram mel(config);
+
+    const size_t n = 4000;
+    std::vector<float> audio(n);
+    unsigned state = 7;
+    for (size_t i = 0; i < n; ++i) {
+        state = state * 1103515245u + 12345u;
+        audio[i] = static_cast<float>((state >> 16) & 0x7fff) / 16384.0f - 1.0f;
+    }
+
+    const size_t frames = mel.num_frames(n);
+    std::vector<float> frame_major(frames * 40), mel_major(frames * 40);
+    mel.compute(audio.data(), n, frame_major.data(), frames, MelSpectrogram::Layout::FRAME_MAJOR);
+    mel.compute(audio.data(), n, mel_major.data(), frames, MelSpectrogram::Layout::MEL_MAJOR);
+    for (size_t t = 0; t < frames; ++t) {
+        for (size_t m = 0; m < 40; ++m) {
+            assert(frame_major[t * 40 + m] == mel_major[m * frames + t]);
+        }
+    }
+
+    // Streaming frame k starts at sample k * hop == centered frame k + 1 (pad = n_fft / 2 = hop)
+    std::vector<float> streamed(frames * 40);
+    size_t written = 0;
+    const size_t chunks[] = {100, 37, 500, 1, 256};
+    size_t pos = 0, c = 0;
+    while (pos < n) {
+        size_t len = std::min(chunks[c++ % 5], n - pos);
+        size_t expect = mel.pending_frames(len);
+        size_t got = mel.process(audio.data() + pos, len, streamed.data() + written * 40);
+        assert(got == expect);
+        written += got;
+        pos += len;
+    }
+    assert(written == (n - 256) / 128 + 1);
+    for (size_t k = 0; k < written; ++k) {
+        for (size_t m = 0; m < 40; ++m) {
+            assert(std::abs(streamed[k * 40 + m] - frame_major[(k + 1) * 40 + m]) < 1e-4f);
+        }
+    }
+    std::cout << "Mel Layout/Streaming Test Passed!" << std::endl;
+}
+
+void test_mel_whisper_tensor() {
+    std::cout << "Running Mel Whisper Tensor Test..." << std::endl;
+    MelSpectrogram mel;
+    const size_t n = 30 * 16000;
+    std::vector<float> audio(n);
+    for (size_t i = 0; i < n; ++i) {
+        audio[i] = 0.3f * std::sin(2.0f * kPi * 440.0f * i / 16000.0f);
+    }
+
+    // Whisper input {1, 80, 3000}: the centered STFT has 3001 frames, the last is dropped
+    minni::genai::Tensor tensor;
+    tensor.name = "input_features";
+    tensor.shape = {1, 80, 3000};
+    tensor.data.resize(80 * 3000);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    size_t frames = mel.compute(audio.data(), n, tensor.data.data(), 3000, MelSpectrogram::Layout::MEL_MAJOR);
+    MelSpectrogram::normalize_whisper(tensor.data.data(), tensor.data.size());
+    auto end = std::chrono::high_resolution_clock::now();
+    assert(frames == 3000);
+
+    float max_val = -1e9f, min_val = 1e9f;
+    for (float v : tensor.data) {
+        max_val = std::max(max_val, v);
+        min_val = std::min(min_val, v);
+    }
+    assert(max_val - min_val <= 2.0f + 1e-5f); // 8 log10 units / 4
+
+    double ms = std::chrono::duration<double, std::milli>(end - start).count();
+    std::cout << "  30 s log-mel: " << ms << " ms" << std::endl;
+    std::cout << "Mel Whisper Tensor Test Passed!" << std::endl;
+}
+
+int main() {
+    test_mel_tone_peak();
+    test_mel_layout_and_streaming();
+    test_mel_whisper_tensor();
+    return 0;
+}
@@ -0,0 +1,191 @@
+#include "../../../../src/core/signal/SensorFusion.h"
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cassert>
+
+using namespace minni::signal;
+
+// Deterministic noise in [-amp, amp]
+struct Noise {
+    unsigned state;
+    float next(float amp) {
+        state = state * 1103515245u + 12345u;
+        return (static_cast<float>((state >> 16) & 0x7fff) / 16384.0f - 1.0f) * amp;
+    }
+};
+
+// Constant-velocity model: x = [position, velocity], position measured
+static LinearKalmanFilter<2, 1> make_cv_filter(float dt) {
+    LinearKalmanFilter<2, 1> kf;
+    Matrix<2, 2> F = Matrix<2, 2>::identity();
+    F(0, 1) = dt;
+    Matrix<2, 2> Q = Matrix<2, 2>::zeros();
+    Q(0, 0) = 1e-4f;
+    Q(1, 1) = 1e-4f;
+    Matrix<1, 2> H = Matrix<1, 2>::zeros();
+    H(0, 0) = 1.0f;
+    Matrix<1, 1> R;
+    R[0] = 0.25f;
+    kf.set_transition(F);
+    kf.set_process_noise(Q);
+    kf.set_observation(H);
+    kf.set_measurement_noise(R);
+    return kf;
+}
+
+void test_linear_tracking() {
+    std::cout << "Running Linear Kalman Tracking Test..." << std::endl;
+    const float dt = 0.1f;
+    LinearKalmanFilter<2, 1> kf = make_cv_filter(dt);
+    Noise noise{1};
+
+    // Target moves at 2 m/s from 1 m
+    for (int step = 1; step <= 200; ++step) {
+        kf.predict();
+        Vector<1> z;
+        z[0] = 1.0f + 2.0f * dt * step + noise.next(0.5f);
+        assert(kf.update(z));
+    }
+    const float truth = 1.0f + 2.0f * dt * 200;
+    assert(std::abs(kf.state()[0] - truth) < 0.2f);
+    assert(std::abs(kf.state()[1] - 2.0f) < 0.2f);
+    // Covariance stays symmetric and shrinks below the measurement noise
+    assert(std::abs(kf.covariance()(0, 1) - kf.covariance()(1, 0)) < 1e-6f);
+    assert(kf.covariance()(0, 0) < 0.25f);
+
+    // A second sensor measuring velocity directly, fused into the same state
+    Matrix<1, 2> Hv = Matrix<1, 2>::zeros();
+    Hv(0, 1) = 1.0f;
+    Matrix<1, 1> Rv;
+    Rv[0] = 0.01f;
+    Vector<1> v;
+    v[0] = 2.0f;
+    float var_before = kf.covariance()(1, 1);
+    assert(kf.update(v, Hv, Rv));
+    assert(kf.covariance()(1, 1) < var_before);
+
+    std::cout << "Linear Kalman Tracking Test Passed!" << std::endl;
+}
+
+void test_ekf_ranging() {
+    std::cout << "Running EKF Ranging Test..." << std::endl;
+    // Static 2D position observed through ranges to three anchors (RTT-style)
+    const float anchors[3][2] = {{0.0f, 0.0f}, {10.0f, 0.0f}, {0.0f, 10.0f}};
+    const float px = 3.0f, py = 4.0f;
+
+    ExtendedKalmanFilter<2> ekf;
+    Vector<2> x0;
+    x0[0] = 5.0f;
+    x0[1] = 5.0f;
+    Matrix<2, 2> P0 = Matrix<2, 2>::identity();
+    P0(0, 0) = P0(1, 1) = 25.0f;
+    ekf.set_state(x0, P0);
+
+    auto h = [&](const Vector<2>& x) {
+        Vector<3> r;
+        for (int a = 0; a < 3; ++a) {
+            float dx = x[0] - anchors[a][0], dy = x[1] - anchors[a][1];
+            r[a] = std::sqrt(dx * dx + dy * dy);
+        }
+        return r;
+    };
+    auto jac = [&](const Vector<2>& x) {
+        Matrix<3, 2> J;
+        for (int a = 0; a < 3; ++a) {
+            float dx = x[0] - anchors[a][0], dy = x[1] - anchors[a][1];
+            float r = std::sqrt(dx * dx + dy * dy);
+            J(a, 0) = dx / r;
+            J(a, 1) = dy / r;
+        }
+        return J;
+    };
+    auto f = [](const Vector<2>& x) { return x; };
+    auto f_jac = [](const Vector<2>&) { return Matrix<2, 2>::identity(); };
+
+    Matrix<3, 3> R = Matrix<3, 3>::identity();
+    for (int i = 0; i < 3; ++i) R(i, i) = 0.04f;
+    Matrix<2, 2> Q = Matrix<2, 2>::zeros();
+
+    Noise noise{2};
+    Vector<2> truth;
+    truth[0] = px;
+    truth[1] = py;
+    for (int step = 0; step < 50; ++step) {
+        ekf.predict(f, f_jac, Q);
+        Vector<3> z = h(truth);
+        for (int a = 0; a < 3; ++a) z[a] += noise.next(0.2f);
+        assert(ekf.update(z, h, jac, R));
+    }
+    assert(std::abs(ekf.state()[0] - px) < 0.1f);
+    assert(std::abs(ekf.state()[1] - py) < 0.1f);
+    std::cout << "EKF Ranging Test Passed!" << std::endl;
+}
+
+void test_track_batch() {
+    std::cout << "Running Kalman Track Batch Test..." << std::endl;
+    const size_t tracks = 37;
+    const float dt = 0.1f;
+
+    // Position + velocity measured (M = 2) so the batched Cholesky is exercised
+    KalmanTrackBatch<2, 2> batch(tracks);
+    Matrix<2, 2> F = Matrix<2, 2>::identity();
+    F(0, 1) = dt;
+    Matrix<2, 2> Q = Matrix<2, 2>::identity();
+    Q(0, 0) = Q(1, 1) = 1e-3f;
+    Matrix<2, 2> H = Matrix<2, 2>::identity();
+    H(1, 0) = 0.5f; // Correlated second sensor
+    Matrix<2, 2> R = Matrix<2, 2>::identity();
+    R(0, 0) = 0.3f;
+    R(1, 1) = 0.2f;
+    R(0, 1) = R(1, 0) = 0.05f;
+
+    std::vector<LinearKalmanFilter<2, 2>> singles(tracks);
+    for (auto& kf : singles) {
+        kf.set_transition(F);
+        kf.set_process_noise(Q);
+        kf.set_observation(H);
+        kf.set_measurement_noise(R);
+    }
+    batch.set_transition(F);
+    batch.set_process_noise(Q);
+    batch.set_observation(H);
+    batch.set_measurement_noise(R);
+
+    Noise noise{3};
+    std::vector<float> z(2 * tracks), weight(tracks);
+    for (int step = 0; step < 30; ++step) {
+        batch.predict();
+        for (size_t t = 0; t < tracks; ++t) {
+            singles[t].predict();
+            z[t] = 0.1f * t + noise.next(1.0f);
+            z[tracks + t] = noise.next(1.0f);
+            // Every third track misses every other measurement
+            weight[t] = (t % 3 == 0 && step % 2 == 1) ? 0.0f : 1.0f;
+            if (weight[t] > 0.0f) {
+                Vector<2> zt;
+                zt[0] = z[t];
+                zt[1] = z[tracks + t];
+                singles[t].update(zt);
+            }
+        }
+        batch.update(z.data(), weight.data());
+    }
+
+    for (size_t t = 0; t < tracks; ++t) {
+        for (size_t i = 0; i < 2; ++i) {
+            assert(std::abs(batch.state(i)[t] - singles[t].state()[i]) < 1e-3f);
+            for (size_t j = 0; j < 2; ++j) {
+                assert(std::abs(batch.covariance(i, j)[t] - singles[t].covariance()(i, j)) < 1e-4f);
+            }
+        }
+    }
+    std::cout << "Kalman Track Batch Test Passed!" << std::endl;
+}
+
+int main() {
+    test_linear_tracking();
+    test_ekf_ranging();
+    test_track_batch();
+    return 0;
+}
@@ -3,6 +3,26 @@
 #include <vector>
 #include <cmath>
 #include <cassert>
+#include <cstdlib>
+#include <new>
+
+// Count heap allocations to check the steady-state frame path
+static size_t g_allocations = 0;
+
+void* operator new(size_t size) {
+    ++g_allocations;
+    void* p = std::malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept {
+    std::free(p);
+}
 
 // Helper
 bool vec_approx_eq(const std::vector<float>& a, const std::vector<float>& b, float epsilon = 1e-3) {
@@ -52,8 +72,100 @@ void test_processor_window() {
     std::cout << "SignalProcessor Window Test Passed!" << std::endl;
 }
 
+void test_processor_rfft() {
+    std::cout << "Running SignalProcessor RFFT Test..." << std::endl;
+
+    minni::signal::SignalProcessor processor;
+    std::vector<float> input = {1.0f, 2.0f, 3.0f, 4.0f, 0.0f, -1.0f, 0.5f, 2.0f};
+
+    // Magnitudes of the real FFT match the first N/2 + 1 bins of the complex FFT
+    processor.load(input);
+    processor.fft(false);
+    processor.magnitude();
+    std::vector<float> full = processor.get_output();
+
+    processor.load(input);
+    processor.rfft();
+    assert(processor.size() == 5);
+    processor.irfft();
+    assert(vec_approx_eq(processor.get_output(), input));
+
+    processor.rfft();
+    processor.magnitude();
+    assert(vec_approx_eq(processor.get_output(), std::vector<float>(full.begin(), full.begin() + 5)));
+
+    std::cout << "SignalProcessor RFFT Test Passed!" << std::endl;
+}
+
+void test_processor_zero_alloc() {
+    std::cout << "Running SignalProcessor Zero-Allocation Test..." << std::endl;
+
+    const size_t n = 400; // Non power of 2: plans with scratch buffers
+    std::vector<float> input(n), window(n, 0.5f), out(n);
+    for (size_t i = 0; i < n; ++i) input[i] = std::sin(0.1f * i);
+
+    minni::signal::SignalProcessor processor;
+    processor.reserve(n);
+
+    // First frame builds the plans
+    processor.load(input.data(), n);
+    processor.apply_window(window.data(), n);
+    processor.fft(false);
+    processor.magnitude();
+    processor.load(input.data(), n);
+    processor.rfft();
+    processor.irfft();
+    processor.copy_output(out.data(), n);
+
+    size_t before = g_allocations;
+    for (int frame = 0; frame < 10; ++frame) {
+        processor.load(input.data(), n);
+        processor.apply_window(window.data(), n);
+        processor.fft(false);
+        processor.magnitude();
+        processor.copy_output(out.data(), n);
+
+        processor.load(input.data(), n);
+        processor.rfft();
+        processor.irfft();
+        processor.copy_output(out.data(), n);
+    }
+    assert(g_allocations == before);
+    for (size_t i = 0; i < n; ++i) {
+        assert(std::abs(out[i] - input[i]) < 1e-3f);
+    }
+
+    // bind(): in place on caller memory, no copies at all
+    std::vector<float> real(input), imag(n, 0.0f);
+    processor.bind(real.data(), imag.data(), n);
+    before = g_allocations;
+    processor.fft(false);
+    processor.fft(true);
+    assert(g_allocations == before);
+    assert(processor.real_data() == real.data());
+    for (size_t i = 0; i < n; ++i) {
+        assert(std::abs(real[i] - input[i]) < 1e-3f);
+        assert(std::abs(imag[i]) < 1e-3f);
+    }
+
+    // bind() without an imaginary buffer + rfft on caller memory
+    std::vector<float> frame(input);
+    processor.bind(frame.data(), nullptr, n);
+    processor.rfft();
+    assert(processor.size() == n / 2 + 1);
+    processor.irfft();
+    assert(processor.size() == n);
+    for (size_t i = 0; i < n; ++i) {
+        assert(std::abs(frame[i] - input[i]) < 1e-3f);
+    }
+
+    std::cout << "SignalProcessor Zero-Allocation Test Passed!" << std::endl;
+}
+
 int main() {
     test_processor_chain();
     test_processor_window();
+    test_processor_rfft();
+    test_processor_zero_alloc();
     return 0;
 }
@@ -0,0 +1,172 @@
+#include "../../../../src/core/signal/FirFilter.h"
+#include "../../../../src/core/signal/IirFilter.h"
+#include "../../../../src/core/signal/DSPKernel.h"
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cassert>
+
+using namespace minni::signal;
+
+static std::vector<float> make_signal(size_t n, unsigned seed) {
+    std::vector<float> x(n);
+    unsigned state = seed;
+    for (size_t i = 0; i < n; ++i) {
+        state = state * 1103515245u + 12345u;
+        x[i] = static_cast<float>((state >> 16) & 0x7fff) / 16384.0f - 1.0f;
+    }
+    return x;
+}
+
+void test_fir_block_split() {
+    std::cout << "Running FIR Block Split Test..." << std::endl;
+    const size_t n = 1000;
+    std::vector<float> x = make_signal(n, 1);
+    std::vector<float> taps = make_signal(37, 2);
+
+    std::vector<float> expected(n);
+    DSPKernel::fir_filter_direct(x.data(), n, taps.data(), taps.size(), expected.data());
+
+    // Odd block sizes, some larger than the internal chunk
+    FirFilter fir(taps.data(), taps.size(), 1, 64);
+    std::vector<float> out(n);
+    const size_t blocks[] = {1, 7, 64, 3, 200, 13};
+    size_t pos = 0, b = 0;
+    while (pos < n) {
+        size_t len = std::min(blocks[b++ % 6], n - pos);
+        fir.process(x.data() + pos, out.data() + pos, len);
+        pos += len;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        assert(std::abs(out[i] - expected[i]) < 1e-4f);
+    }
+
+    // reset() restarts from zero history
+    fir.reset();
+    fir.process(x.data(), out.data(), 10);
+    for (size_t i = 0; i < 10; ++i) {
+        assert(std::abs(out[i] - expected[i]) < 1e-4f);
+    }
+    std::cout << "FIR Block Split Test Passed!" << std::endl;
+}
+
+void test_fir_multichannel() {
+    std::cout << "Running FIR Multichannel Test..." << std::endl;
+    const size_t n = 300, ch = 3;
+    std::vector<float> taps = make_signal(16, 3);
+    std::vector<std::vector<float>> planar(ch), expected(ch);
+    std::vector<float> interleaved(n * ch);
+    for (size_t c = 0; c < ch; ++c) {
+        planar[c] = make_signal(n, 10 + static_cast<unsigned>(c));
+        expected[c].resize(n);
+        DSPKernel::fir_filter_direct(planar[c].data(), n, taps.data(), taps.size(), expected[c].data());
+        for (size_t i = 0; i < n; ++i) interleaved[i * ch + c] = planar[c][i];
+    }
+
+    // Interleaved, in place, two blocks
+    FirFilter fir(taps.data(), taps.size(), ch, 32);
+    fir.process(interleaved.data(), interleaved.data(), 101);
+    fir.process(interleaved.data() + 101 * ch, interleaved.data() + 101 * ch, n - 101);
+    for (size_t c = 0; c < ch; ++c) {
+        for (size_t i = 0; i < n; ++i) {
+            assert(std::abs(interleaved[i * ch + c] - expected[c][i]) < 1e-4f);
+        }
+    }
+
+    // Planar
+    FirFilter fir_planar(taps.data(), taps.size(), ch);
+    std::vector<std::vector<float>> out(ch, std::vector<float>(n));
+    const float* in_ptr[3];
+    float* out_ptr[3];
+    for (size_t half = 0; half < 2; ++half) {
+        size_t begin = half * 150;
+        for (size_t c = 0; c < ch; ++c) {
+            in_ptr[c] = planar[c].data() + begin;
+            out_ptr[c] = out[c].data() + begin;
+        }
+        fir_planar.process_planar(in_ptr, out_ptr, 150);
+    }
+    for (size_t c = 0; c < ch; ++c) {
+        for (size_t i = 0; i < n; ++i) {
+            assert(std::abs(out[c][i] - expected[c][i]) < 1e-4f);
+        }
+    }
+    std::cout << "FIR Multichannel Test Passed!" << std::endl;
+}
+
+void test_iir_streaming() {
+    std::cout << "Running IIR Streaming Test..." << std::endl;
+    const size_t n = 512, ch = 10; // 10 channels: SIMD groups plus a scalar tail
+    std::vector<IirFilter::Biquad> sections = IirFilter::butterworth_lowpass(5, 1000.0f, 50.0f);
+    assert(sections.size() == 3);
+
+    std::vector<std::vector<float>> planar(ch);
+    std::vector<float> interleaved(n * ch);
+    for (size_t c = 0; c < ch; ++c) {
+        planar[c] = make_signal(n, 20 + static_cast<unsigned>(c));
+        for (size_t i = 0; i < n; ++i) interleaved[i * ch + c] = planar[c][i];
+    }
+
+    // Reference: one mono filter per channel over the whole signal
+    std::vector<std::vector<float>> expected(ch, std::vector<float>(n));
+    for (size_t c = 0; c < ch; ++c) {
+        IirFilter mono(sections.data(), sections.size());
+        mono.process(planar[c].data(), expected[c].data(), n);
+    }
+
+    IirFilter multi(sections.data(), sections.size(), ch);
+    multi.process(interleaved.data(), interleaved.data(), 100);
+    multi.process(interleaved.data() + 100 * ch, interleaved.data() + 100 * ch, n - 100);
+
+    IirFilter multi_planar(sections.data(), sections.size(), ch);
+    std::vector<float*> ptr(ch);
+    for (size_t c = 0; c < ch; ++c) ptr[c] = planar[c].data();
+    multi_planar.process_planar(ptr.data(), ptr.data(), n);
+
+    for (size_t c = 0; c < ch; ++c) {
+        for (size_t i = 0; i < n; ++i) {
+            assert(std::abs(interleaved[i * ch + c] - expected[c][i]) < 1e-5f);
+            assert(std::abs(planar[c][i] - expected[c][i]) < 1e-5f);
+        }
+    }
+    std::cout << "IIR Streaming Test Passed!" << std::endl;
+}
+
+void test_iir_response() {
+    std::cout << "Running IIR Response Test..." << std::endl;
+    const float fs = 1000.0f;
+    std::vector<IirFilter::Biquad> lp = IirFilter::butterworth_lowpass(4, fs, 50.0f);
+    IirFilter filter(lp.data(), lp.size());
+
+    // DC passes with unit gain
+    std::vector<float> dc(2000, 1.0f);
+    filter.process(dc.data(), dc.data(), dc.size());
+    assert(std::abs(dc.back() - 1.0f) < 1e-3f);
+
+    // 300 Hz is far in the stop band (~ -62 dB for 4th order)
+    filter.reset();
+    std::vector<float> tone(2000);
+    for (size_t i = 0; i < tone.size(); ++i) {
+        tone[i] = std::sin(2.0f * 3.14159265f * 300.0f * i / fs);
+    }
+    filter.process(tone.data(), tone.data(), tone.size());
+    float peak = 0.0f;
+    for (size_t i = 1000; i < tone.size(); ++i) peak = std::max(peak, std::abs(tone[i]));
+    assert(peak < 0.01f);
+
+    // High-pass blocks DC
+    IirFilter::Biquad hp = IirFilter::highpass(fs, 10.0f);
+    IirFilter hpf(&hp, 1);
+    std::vector<float> step(2000, 1.0f);
+    hpf.process(step.data(), step.data(), step.size());
+    assert(std::abs(step.back()) < 1e-3f);
+    std::cout << "IIR Response Test Passed!" << std::endl;
+}
+
+int main() {
+    test_fir_block_split();
+    test_fir_multichannel();
+    test_iir_streaming();
+    test_iir_response();
+    return 0;
+}
@@ -0,0 +1,244 @@
+#include "../../../../src/core/signal/VectorMath.h"
+#include "../../../../src/core/signal/DSPKernel.h"
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cassert>
+#include <cstring>
+#include <limits>
+
+using namespace minni::signal;
+
+// Distance in representable floats between a float result and the exact (double) value
+static double ulp_error(float got, double exact) {
+    if (std::isnan(exact)) return std::isnan(got) ? 0.0 : 1e9;
+    if (std::isinf(exact)) return (std::isinf(got) && (got > 0) == (exact > 0)) ? 0.0 : 1e9;
+    float rounded = static_cast<float>(exact);
+    float ulp = std::nextafter(std::fabs(rounded), std::numeric_limits<float>::infinity()) - std::fabs(rounded);
+    if (std::isinf(ulp)) ulp = std::ldexp(1.0f, 104); // FLT_MAX neighbourhood
+    return std::fabs(static_cast<double>(got) - exact) / ulp;
+}
+
+// Deterministic inputs in [lo, hi]
+static std::vector<float> make_inputs(size_t n, float lo, float hi) {
+    std::vector<float> x(n);
+    unsigned state = 7;
+    for (size_t i = 0; i < n; ++i) {
+        state = state * 1103515245u + 12345u;
+        float u = static_cast<float>((state >> 8) & 0xffffff) / 16777216.0f;
+        x[i] = lo + (hi - lo) * u;
+    }
+    return x;
+}
+
+void test_log() {
+    std::cout << "Running VectorMath Log Test..." << std::endl;
+    // Sweep whole binades, 1e-40 (subnormal) .. 1e38
+    std::vector<float> x;
+    for (float v = 1e-40f; v < 1e38f; v *= 1.0013f) x.push_back(v);
+    std::vector<float> y(x.size());
+    VectorMath::log(x.data(), y.data(), x.size());
+    double worst = 0.0;
+    for (size_t i = 0; i < x.size(); ++i) {
+        worst = std::max(worst, ulp_error(y[i], std::log(static_cast<double>(x[i]))));
+    }
+    std::cout << "  max error: " << worst << " ulp" << std::endl;
+    assert(worst <= 1.0);
+
+    float special[5] = {0.0f, -1.0f, std::numeric_limits<float>::infinity(),
+                        std::numeric_limits<float>::quiet_NaN(), 1.0f};
+    float out[5];
+    VectorMath::log(special, out, 5);
+    assert(std::isinf(out[0]) && out[0] < 0);
+    assert(std::isnan(out[1]));
+    assert(std::isinf(out[2]) && out[2] > 0);
+    assert(std::isnan(out[3]));
+    assert(out[4] == 0.0f);
+    std::cout << "VectorMath Log Test Passed!" << std::endl;
+}
+
+void test_exp() {
+    std::cout << "Running VectorMath Exp Test..." << std::endl;
+    std::vector<float> x = make_inputs(200003, -87.3f, 87.3f);
+    std::vector<float> y(x.size());
+    VectorMath::exp(x.data(), y.data(), x.size());
+    double worst = 0.0;
+    for (size_t i = 0; i < x.size(); ++i) {
+        worst = std::max(worst, ulp_error(y[i], std::exp(static_cast<double>(x[i]))));
+    }
+    std::cout << "  max error: " << worst << " ulp" << std::endl;
+    assert(worst <= 2.0);
+
+    float special[5] = {100.0f, -200.0f, 0.0f, std::numeric_limits<float>::quiet_NaN(), -95.0f};
+    float out[5];
+    VectorMath::exp(special, out, 5);
+    assert(std::isinf(out[0]));
+    assert(out[1] == 0.0f);
+    assert(out[2] == 1.0f);
+    assert(std::isnan(out[3]));
+    assert(out[4] > 0.0f && std::fabs(out[4] - std::exp(-95.0f)) < 1e-44f); // Subnormal
+    std::cout << "VectorMath Exp Test Passed!" << std::endl;
+}
+
+void test_sincos() {
+    std::cout << "Running VectorMath SinCos Test..." << std::endl;
+    std::vector<float> x = make_inputs(200003, -8192.0f, 8192.0f);
+    std::vector<float> small = make_inputs(50001, -4.0f, 4.0f);
+    x.insert(x.end(), small.begin(), small.end());
+
+    std::vector<float> s(x.size()), c(x.size()), s2(x.size());
+    VectorMath::sincos(x.data(), s.data(), c.data(), x.size());
+    VectorMath::sin(x.data(), s2.data(), x.size());
+
+    double worst = 0.0;
+    for (size_t i = 0; i < x.size(); ++i) {
+        double es = std::sin(static_cast<double>(x[i]));
+        double ec = std::cos(static_cast<double>(x[i]));
+        // Relative bound away from zeros, absolute bound near them
+        double err_s = std::fabs(es) > 1e-3 ? ulp_error(s[i], es) : std::fabs(s[i] - es) / 2e-7 * 2.0;
+        double err_c = std::fabs(ec) > 1e-3 ? ulp_error(c[i], ec) : std::fabs(c[i] - ec) / 2e-7 * 2.0;
+        worst = std::max(worst, std::max(err_s, err_c));
+        assert(s2[i] == s[i]);
+    }
+    std::cout << "  max error: " << worst << " ulp" << std::endl;
+    assert(worst <= 2.0);
+
+    // Beyond the reduction range: libm fallback, in place
+    std::vector<float> big = {1e6f, -3e7f, 1e30f, 5.0f, 0.5f, -0.25f, 100.0f, 1e5f, 2.0f};
+    std::vector<float> ref = big;
+    VectorMath::cos(big.data(), big.data(), big.size());
+    for (size_t i = 0; i < big.size(); ++i) {
+        assert(std::fabs(big[i] - std::cos(ref[i])) < 1e-6f);
+    }
+    std::cout << "VectorMath SinCos Test Passed!" << std::endl;
+}
+
+void test_sqrt() {
+    std::cout << "Running VectorMath Sqrt Test..." << std::endl;
+    std::vector<float> x = make_inputs(100003, 1e-6f, 1e6f);
+    std::vector<float> y(x.size()), r(x.size());
+    VectorMath::sqrt(x.data(), y.data(), x.size());
+    VectorMath::rsqrt(x.data(), r.data(), x.size());
+    double worst = 0.0;
+    for (size_t i = 0; i < x.size(); ++i) {
+        assert(y[i] == std::sqrt(x[i]));
+        worst = std::max(worst, ulp_error(r[i], 1.0 / std::sqrt(static_cast<double>(x[i]))));
+    }
+    std::cout << "  rsqrt max error: " << worst << " ulp" << std::endl;
+    assert(worst <= 1.5);
+
+    // Special values in every lane of a full vector and in the scalar tail: the
+    // answer must not depend on where an element sits
+    const float inf = std::numeric_limits<float>::infinity();
+    const float special[] = {0.0f, -0.0f, inf, 1e-40f, 1.4e-45f, 1.17e-38f, 4.0f, -1.0f};
+    const size_t count = sizeof(special) / sizeof(special[0]);
+    std::vector<float> in(3 * count + 3);
+    for (size_t i = 0; i < in.size(); ++i) in[i] = special[i % count];
+    std::vector<float> out(in.size());
+    VectorMath::rsqrt(in.data(), out.data(), in.size());
+    for (size_t i = 0; i < in.size(); ++i) {
+        const float expected = 1.0f / std::sqrt(in[i]);
+        if (std::isnan(expected)) {
+            assert(std::isnan(out[i]));
+        } else {
+            assert(out[i] == expected);
+        }
+    }
+    assert(std::isinf(out[0]) && out[0] > 0);
+    assert(std::isinf(out[1]) && out[1] < 0);
+    assert(out[2] == 0.0f);
+    assert(std::isfinite(out[3]) && out[3] > 0);
+    std::cout << "VectorMath Sqrt Test Passed!" << std::endl;
+}
+
+// Bitwise comparison of every vector lane against a one-element call (the scalar tail)
+static void check_lanes_match_tail(void (*fn)(const float*, float*, size_t), const std::vector<float>& x) {
+    std::vector<float> batch(x.size());
+    fn(x.data(), batch.data(), x.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+        float single;
+        fn(&x[i], &single, 1);
+        assert(std::memcmp(&single, &batch[i], sizeof(float)) == 0);
+    }
+}
+
+void test_length_independence() {
+    std::cout << "Running VectorMath Length Independence Test..." << std::endl;
+    const float inf = std::numeric_limits<float>::infinity();
+    const std::vector<float> special = {0.0f, -0.0f, inf, -inf, 1e-40f, -1e-40f, 1.0f, -1.0f};
+
+    std::vector<float> positive = make_inputs(200000, 1e-30f, 1e30f);
+    std::vector<float> wide = make_inputs(200000, -100.0f, 100.0f);
+    std::vector<float> trig = make_inputs(200000, -8192.0f, 8192.0f);
+    for (auto* v : {&positive, &wide, &trig}) v->insert(v->end(), special.begin(), special.end());
+
+    check_lanes_match_tail(VectorMath::log, positive);
+    check_lanes_match_tail(VectorMath::exp, wide);
+    check_lanes_match_tail(VectorMath::sin, trig);
+    check_lanes_match_tail(VectorMath::cos, trig);
+    check_lanes_match_tail(VectorMath::rsqrt, positive);
+
+    // sin keeps the sign of zero
+    float neg_zero = -0.0f, out;
+    VectorMath::sin(&neg_zero, &out, 1);
+    assert(out == 0.0f && std::signbit(out));
+    std::cout << "VectorMath Length Independence Test Passed!" << std::endl;
+}
+
+void test_dsp_ops() {
+    std::cout << "Running DSPKernel Log/Softmax Test..." << std::endl;
+    const size_t n = 37;
+    std::vector<float> re = make_inputs(n, -3.0f, 3.0f);
+    std::vector<float> im = make_inputs(n, -1.0f, 2.0f);
+    re[5] = 0.0f;
+    im[5] = 0.0f;
+
+    std::vector<float> mag(n), logmag(n);
+    DSPKernel::complex_magnitude(re.data(), im.data(), mag.data(), n);
+    DSPKernel::log_magnitude(re.data(), im.data(), logmag.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+        assert(std::fabs(mag[i] - std::sqrt(re[i] * re[i] + im[i] * im[i])) < 1e-6f);
+        float expect = std::log(std::max(mag[i], 1e-10f));
+        assert(std::fabs(logmag[i] - expect) < 1e-5f);
+    }
+
+    // dB: power and amplitude conventions, relative to a reference
+    std::vector<float> power = {1.0f, 10.0f, 100.0f, 0.0f, 0.5f};
+    std::vector<float> db(power.size());
+    DSPKernel::db_scale(power.data(), db.data(), power.size());
+    assert(std::fabs(db[0]) < 1e-5f);
+    assert(std::fabs(db[1] - 10.0f) < 1e-4f);
+    assert(std::fabs(db[2] - 20.0f) < 1e-4f);
+    assert(std::fabs(db[3] + 100.0f) < 1e-3f); // Clamped at the floor
+    DSPKernel::db_scale(power.data(), db.data(), power.size(), false, 10.0f);
+    assert(std::fabs(db[1]) < 1e-5f);
+    assert(std::fabs(db[2] - 20.0f) < 1e-4f);
+
+    // Softmax: sums to one, matches a double reference, stable for large logits
+    std::vector<float> logits = make_inputs(n, -20.0f, 20.0f);
+    logits[3] = 500.0f;
+    logits[4] = 499.0f;
+    std::vector<float> p(n);
+    DSPKernel::softmax(logits.data(), p.data(), n);
+    double sum = 0.0, ref_sum = 0.0;
+    for (size_t i = 0; i < n; ++i) ref_sum += std::exp(static_cast<double>(logits[i]) - 500.0);
+    for (size_t i = 0; i < n; ++i) {
+        sum += p[i];
+        double expect = std::exp(static_cast<double>(logits[i]) - 500.0) / ref_sum;
+        assert(std::fabs(p[i] - expect) < 1e-6);
+    }
+    assert(std::fabs(sum - 1.0) < 1e-5);
+    DSPKernel::softmax(logits.data(), logits.data(), n); // In place
+    assert(logits[3] == p[3]);
+    std::cout << "DSPKernel Log/Softmax Test Passed!" << std::endl;
+}
+
+int main() {
+    test_log();
+    test_exp();
+    test_sincos();
+    test_sqrt();
+    test_length_independence();
+    test_dsp_ops();
+    return 0;
+}
@@ -13,6 +13,9 @@ g++ -std=c++17 -Isrc/core \
     testing/unit/core/logic/test_knowledge_graph.cpp \
     src/core/logic/KnowledgeGraph.cpp \
     src/core/signal/DSPKernel.cpp \
+    src/core/signal/VectorMath.cpp \
+    src/core/signal/FFTPlan.cpp \
+    src/core/signal/PartitionedConvolver.cpp \
     src/core/optimization/Quantizer.cpp \
     src/core/security/SecurityManager.cpp \
     -o testing/unit/bin/test_kg
@@ -33,6 +36,9 @@ echo "========================================"
 g++ -std=c++17 -Isrc/core \
     testing/unit/core/signal/test_dsp_kernel.cpp \
     src/core/signal/DSPKernel.cpp \
+    src/core/signal/VectorMath.cpp \
+    src/core/signal/FFTPlan.cpp \
+    src/core/signal/PartitionedConvolver.cpp \
     -o testing/unit/bin/test_dsp
 
 if [ $? -eq 0 ]; then
@@ -48,9 +54,17 @@ echo "========================================"
 echo "Compiling SatSolver tests..."
 echo "========================================"
 
-g++ -std=c++17 -Isrc/core \
+g++ -std=c++17 -Isrc/core -pthread \
     testing/unit/core/logic/test_sat_solver.cpp \
     src/core/logic/SatSolver.cpp \
+    src/core/logic/PbEncoder.cpp \
+    src/core/logic/CdclSolver.cpp \
+    src/core/logic/ClauseArena.cpp \
+    src/core/logic/DratWriter.cpp \
+    src/core/logic/DimacsReader.cpp \
+    src/core/logic/PortfolioSolver.cpp \
+    src/core/logic/ClauseExchange.cpp \
+    src/core/logic/Preprocessor.cpp \
     -o testing/unit/bin/test_sat
 
 if [ $? -eq 0 ]; then
@@ -61,6 +75,137 @@ else
     exit 1
 fi
 
+echo ""
+echo "========================================"
+echo "Compiling DimacsReader tests..."
+echo "========================================"
+
+g++ -std=c++17 -Isrc/core -pthread \
+    testing/unit/core/logic/test_dimacs_reader.cpp \
+    src/core/logic/DimacsReader.cpp \
+    src/core/logic/SatSolver.cpp \
+    src/core/logic/PbEncoder.cpp \
+    src/core/logic/CdclSolver.cpp \
+    src/core/logic/ClauseArena.cpp \
+    src/core/logic/DratWriter.cpp \
+    src/core/logic/PortfolioSolver.cpp \
+    src/core/logic/ClauseExchange.cpp \
+    src/core/logic/Preprocessor.cpp \
+    -o testing/unit/bin/test_dimacs_reader
+
+if [ $? -eq 0 ]; then
+    echo "Compilation success. Running tests..."
+    ./testing/unit/bin/test_dimacs_reader
+else
+    echo "ERROR: Compilation failed for DimacsReader tests."
+    exit 1
+fi
+
+echo ""
+echo "========================================"
+echo "Compiling PortfolioSolver tests..."
+echo "========================================"
+
+g++ -std=c++17 -Isrc/core -pthread \
+    testing/unit/core/logic/test_portfolio_solver.cpp \
+    src/core/logic/PortfolioSolver.cpp \
+    src/core/logic/ClauseExchange.cpp \
+    src/core/logic/Preprocessor.cpp \
+    src/core/logic/CdclSolver.cpp \
+    src/core/logic/ClauseArena.cpp \
+    src/core/logic/DratWriter.cpp \
+    src/core/logic/SatSolver.cpp \
+    src/core/logic/PbEncoder.cpp \
+    src/core/logic/DimacsReader.cpp \
+    -o testing/unit/bin/test_portfolio_solver
+
+if [ $? -eq 0 ]; then
+    echo "Compilation success. Running tests..."
+    ./testing/unit/bin/test_portfolio_solver
+else
+    echo "ERROR: Compilation failed for PortfolioSolver tests."
+    exit 1
+fi
+
+echo ""
+echo "========================================"
+echo "Compiling Preprocessor tests..."
+echo "========================================"
+
+g++ -std=c++17 -Isrc/core -pthread \
+    testing/unit/core/logic/test_preprocessor.cpp \
+    src/core/logic/Preprocessor.cpp \
+    src/core/logic/CdclSolver.cpp \
+    src/core/logic/ClauseArena.cpp \
+    src/core/logic/DratWriter.cpp \
+    src/core/logic/SatSolver.cpp \
+    src/core/logic/PbEncoder.cpp \
+    src/core/logic/DimacsReader.cpp \
+    src/core/logic/PortfolioSolver.cpp \
+    src/core/logic/ClauseExchange.cpp \
+    -o testing/unit/bin/test_preprocessor
+
+if [ $? -eq 0 ]; then
+    echo "Compilation success. Running tests..."
+    ./testing/unit/bin/test_preprocessor
+else
+    echo "ERROR: Compilation failed for Preprocessor tests."
+    exit 1
+fi
+
+echo ""
+echo "========================================"
+echo "Compiling MaxSAT tests..."
+echo "========================================"
+
+g++ -std=c++17 -Isrc/core -pthread \
+    testing/unit/core/logic/test_maxsat.cpp \
+    src/core/logic/MaxSatSolver.cpp \
+    src/core/logic/PbEncoder.cpp \
+    src/core/logic/SatSolver.cpp \
+    src/core/logic/CdclSolver.cpp \
+    src/core/logic/ClauseArena.cpp \
+    src/core/logic/DratWriter.cpp \
+    src/core/logic/DimacsReader.cpp \
+    src/core/logic/PortfolioSolver.cpp \
+    src/core/logic/ClauseExchange.cpp \
+    src/core/logic/Preprocessor.cpp \
+    -o testing/unit/bin/test_maxsat
+
+if [ $? -eq 0 ]; then
+    echo "Compilation success. Running tests..."
+    ./testing/unit/bin/test_maxsat
+else
+    echo "ERROR: Compilation failed for MaxSAT tests."
+    exit 1
+fi
+
+echo ""
+echo "========================================"
+echo "Compiling DRAT proof tests..."
+echo "========================================"
+
+g++ -std=c++17 -Isrc/core -pthread \
+    testing/unit/core/logic/test_drat_proof.cpp \
+    src/core/logic/DratWriter.cpp \
+    src/core/logic/SatSolver.cpp \
+    src/core/logic/PbEncoder.cpp \
+    src/core/logic/CdclSolver.cpp \
+    src/core/logic/ClauseArena.cpp \
+    src/core/logic/DimacsReader.cpp \
+    src/core/logic/PortfolioSolver.cpp \
+    src/core/logic/ClauseExchange.cpp \
+    src/core/logic/Preprocessor.cpp \
+    -o testing/unit/bin/test_drat_proof
+
+if [ $? -eq 0 ]; then
+    echo "Compilation success. Running tests..."
+    ./testing/unit/bin/test_drat_proof
+else
+    echo "ERROR: Compilation failed for DRAT proof tests."
+    exit 1
+fi
+
 echo ""
 echo "========================================"
 echo "Compiling RuleEngine tests..."
@@ -87,6 +232,9 @@ echo "========================================"
 g++ -std=c++17 -Isrc/core \
     testing/unit/core/signal/test_fft.cpp \
     src/core/signal/DSPKernel.cpp \
+    src/core/signal/VectorMath.cpp \
+    src/core/signal/FFTPlan.cpp \
+    src/core/signal/PartitionedConvolver.cpp \
     -o testing/unit/bin/test_fft
 
 if [ $? -eq 0 ]; then
@@ -97,6 +245,92 @@ else
     exit 1
 fi
 
+echo ""
+echo "========================================"
+echo "Compiling Streaming Filter tests..."
+echo "========================================"
+
+g++ -std=c++17 -Isrc/core \
+    testing/unit/core/signal/test_streaming_filters.cpp \
+    src/core/signal/FirFilter.cpp \
+    src/core/signal/IirFilter.cpp \
+    src/core/signal/DSPKernel.cpp \
+    src/core/signal/VectorMath.cpp \
+    src/core/signal/FFTPlan.cpp \
+    src/core/signal/PartitionedConvolver.cpp \
+    -o testing/unit/bin/test_streaming_filters
+
+if [ $? -eq 0 ]; then
+    echo "Compilation success. Running tests..."
+    ./testing/unit/bin/test_streaming_filters
+else
+    echo "ERROR: Compilation failed for Streaming Filter tests."
+    exit 1
+fi
+
+echo ""
+echo "========================================"
+echo "Compiling MelSpectrogram tests..."
+echo "========================================"
+
+g++ -std=c++17 -Isrc/core \
+    testing/unit/core/signal/test_mel_spectrogram.cpp \
+    src/core/signal/MelSpectrogram.cpp \
+    src/core/signal/DSPKernel.cpp \
+    src/core/signal/VectorMath.cpp \
+    src/core/signal/FFTPlan.cpp \
+    src/core/signal/PartitionedConvolver.cpp \
+    -o testing/unit/bin/test_mel_spectrogram
+
+if [ $? -eq 0 ]; then
+    echo "Compilation success. Running tests..."
+    ./testing/unit/bin/test_mel_spectrogram
+else
+    echo "ERROR: Compilation failed for MelSpectrogram tests."
+    exit 1
+fi
+
+echo ""
+echo "========================================"
+echo "Compiling VectorMath tests..."
+echo "========================================"
+
+g++ -std=c++17 -Isrc/core \
+    testing/unit/core/signal/test_vector_math.cpp \
+    src/core/signal/DSPKernel.cpp \
+    src/core/signal/VectorMath.cpp \
+    src/core/signal/FFTPlan.cpp \
+    src/core/signal/PartitionedConvolver.cpp \
+    -o testing/unit/bin/test_vector_math
+
+if [ $? -eq 0 ]; then
+    echo "Compilation success. Running tests..."
+    ./testing/unit/bin/test_vector_math
+else
+    echo "ERROR: Compilation failed for VectorMath tests."
+    exit 1
+fi
+
+# The default build has no -mavx2, so the AVX2 paths only run in this second build
+if grep -q avx2 /proc/cpuinfo 2>/dev/null && grep -q fma /proc/cpuinfo 2>/dev/null; then
+    echo "Compiling VectorMath tests (AVX2 + FMA)..."
+    g++ -std=c++17 -mavx2 -mfma -Isrc/core \
+        testing/unit/core/signal/test_vector_math.cpp \
+        src/core/signal/DSPKernel.cpp \
+        src/core/signal/VectorMath.cpp \
+        src/core/signal/FFTPlan.cpp \
+        src/core/signal/PartitionedConvolver.cpp \
+        -o testing/unit/bin/test_vector_math_avx2
+
+    if [ $? -eq 0 ]; then
+        echo "Compilation success. Running tests..."
+        ./testing/unit/bin/test_vector_math_avx2
+    else
+        echo "ERROR: Compilation failed for VectorMath AVX2 tests."
+        exit 1
+    fi
+fi
+
 echo ""
 echo "========================================"
 echo "Compiling SignalProcessor tests..."
@@ -106,6 +340,9 @@ g++ -std=c++17 -Isrc/core \
     testing/unit/core/signal/test_signal_processor.cpp \
     src/core/signal/SignalProcessor.cpp \
     src/core/signal/DSPKernel.cpp \
+    src/core/signal/VectorMath.cpp \
+    src/core/signal/FFTPlan.cpp \
+    src/core/signal/PartitionedConvolver.cpp \
     -o testing/unit/bin/test_processor
 
 if [ $? -eq 0 ]; then
@@ -124,6 +361,9 @@ echo "========================================"
 g++ -std=c++17 -Isrc/core \
     testing/unit/core/signal/test_similarity.cpp \
     src/core/signal/DSPKernel.cpp \
+    src/core/signal/VectorMath.cpp \
+    src/core/signal/FFTPlan.cpp \
+    src/core/signal/PartitionedConvolver.cpp \
     -o testing/unit/bin/test_similarity
 
 if [ $? -eq 0 ]; then
@@ -142,6 +382,7 @@ echo "========================================"
 g++ -std=c++17 -Isrc/core \
     testing/unit/core/signal/test_kalman.cpp \
     src/core/signal/KalmanFilter.cpp \
+    src/core/signal/KalmanFilterBank.cpp \
     -o testing/unit/bin/test_kalman
 
 if [ $? -eq 0 ]; then
@@ -152,6 +393,23 @@ else
     exit 1
 fi
 
+echo ""
+echo "========================================"
+echo "Compiling SensorFusion tests..."
+echo "========================================"
+
+g++ -std=c++17 -Isrc/core \
+    testing/unit/core/signal/test_sensor_fusion.cpp \
+    -o testing/unit/bin/test_sensor_fusion
+
+if [ $? -eq 0 ]; then
+    echo "Compilation success. Running tests..."
+    ./testing/unit/bin/test_sensor_fusion
+else
+    echo "ERROR: Compilation failed for SensorFusion tests."
+    exit 1
+fi
+
 echo ""
 echo "========================================"
 echo "Compiling VectorStore tests..."
@@ -161,6 +419,9 @@ g++ -std=c++17 -Isrc/core \
     testing/unit/core/logic/test_vector_store.cpp \
     src/core/logic/VectorStore.cpp \
     src/core/signal/DSPKernel.cpp \
+    src/core/signal/VectorMath.cpp \
+    src/core/signal/FFTPlan.cpp \
+    src/core/signal/PartitionedConvolver.cpp \
     src/core/optimization/Quantizer.cpp \
     src/core/security/SecurityManager.cpp \
     -o testing/unit/bin/test_vector_store
@@ -182,6 +443,9 @@ g++ -std=c++17 -Isrc/core \
     testing/unit/core/logic/test_kg_embeddings.cpp \
     src/core/logic/KnowledgeGraph.cpp \
     src/core/signal/DSPKernel.cpp \
+    src/core/signal/VectorMath.cpp \
+    src/core/signal/FFTPlan.cpp \
+    src/core/signal/PartitionedConvolver.cpp \
     src/core/optimization/Quantizer.cpp \
     src/core/security/SecurityManager.cpp \
     -o testing/unit/bin/test_kg_embeddings
@@ -212,6 +476,33 @@ else
     exit 1
 fi
 
+echo ""
+echo "========================================"
+echo "Compiling ProductQuantizer tests..."
+echo "========================================"
+
+g++ -std=c++17 -Isrc/core \
+    testing/unit/core/optimization/test_product_quantizer.cpp \
+    src/core/optimization/KMeansTrainer.cpp \
+    src/core/optimization/ProductQuantizer.cpp \
+    src/core/optimization/Quantizer.cpp \
+    src/core/logic/VectorStore.cpp \
+    src/core/signal/DSPKernel.cpp \
+    src/core/signal/VectorMath.cpp \
+    src/core/signal/FFTPlan.cpp \
+    src/core/signal/PartitionedConvolver.cpp \
+    src/core/security/SecurityManager.cpp \
+    -pthread \
+    -o testing/unit/bin/test_product_quantizer
+
+if [ $? -eq 0 ]; then
+    echo "Compilation success. Running tests..."
+    ./testing/unit/bin/test_product_quantizer
+else
+    echo "ERROR: Compilation failed for ProductQuantizer tests."
+    exit 1
+fi
+
 echo ""
 echo "========================================"
 echo "Compiling RuleEngine String tests..."
@@ -239,6 +530,9 @@ g++ -std=c++17 -Isrc/core \
     testing/unit/core/logic/test_vector_store_quantized.cpp \
     src/core/logic/VectorStore.cpp \
     src/core/signal/DSPKernel.cpp \
+    src/core/signal/VectorMath.cpp \
+    src/core/signal/FFTPlan.cpp \
+    src/core/signal/PartitionedConvolver.cpp \
     src/core/optimization/Quantizer.cpp \
     src/core/security/SecurityManager.cpp \
     -o testing/unit/bin/test_vector_store_quantized
@@ -260,6 +554,9 @@ g++ -std=c++17 -Isrc/core \
     testing/unit/core/logic/test_vector_store_persistence.cpp \
     src/core/logic/VectorStore.cpp \
     src/core/signal/DSPKernel.cpp \
+    src/core/signal/VectorMath.cpp \
+    src/core/signal/FFTPlan.cpp \
+    src/core/signal/PartitionedConvolver.cpp \
     src/core/optimization/Quantizer.cpp \
     src/core/security/SecurityManager.cpp \
     -o testing/unit/bin/test_vector_store_persistence
@@ -281,6 +578,9 @@ g++ -std=c++17 -Isrc/core \
     testing/unit/core/logic/test_kg_quantized.cpp \
     src/core/logic/KnowledgeGraph.cpp \
     src/core/signal/DSPKernel.cpp \
+    src/core/signal/VectorMath.cpp \
+    src/core/signal/FFTPlan.cpp \
+    src/core/signal/PartitionedConvolver.cpp \
     src/core/optimization/Quantizer.cpp \
     src/core/security/SecurityManager.cpp \
     -o testing/unit/bin/test_kg_quantized
@@ -302,6 +602,9 @@ g++ -std=c++17 -Isrc/core \
     testing/unit/core/logic/test_kg_persistence.cpp \
     src/core/logic/KnowledgeGraph.cpp \
     src/core/signal/DSPKernel.cpp \
+    src/core/signal/VectorMath.cpp \
+    src/core/signal/FFTPlan.cpp \
+    src/core/signal/PartitionedConvolver.cpp \
     src/core/optimization/Quantizer.cpp \
     src/core/security/SecurityManager.cpp \
     -o testing/unit/bin/test_kg_persistence
@@ -343,6 +646,9 @@ g++ -std=c++17 -Isrc/core \
     src/core/logic/FlatVectorStore.cpp \
     src/core/platform/MemoryMapper.cpp \
     src/core/signal/DSPKernel.cpp \
+    src/core/signal/VectorMath.cpp \
+    src/core/signal/FFTPlan.cpp \
+    src/core/signal/PartitionedConvolver.cpp \
     src/core/optimization/Quantizer.cpp \
     src/core/security/SecurityManager.cpp \
     -o testing/unit/bin/test_flat_vector_store
@@ -355,6 +661,33 @@ else
     exit 1
 fi
 
+echo ""
+echo "========================================"
+echo "Compiling EmbeddingImporter tests..."
+echo "========================================"
+
+g++ -std=c++17 -Isrc/core -pthread \
+    testing/unit/core/logic/test_embedding_importer.cpp \
+    src/core/logic/EmbeddingImporter.cpp \
+    src/core/logic/VectorStore.cpp \
+    src/core/logic/FlatVectorStore.cpp \
+    src/core/platform/MemoryMapper.cpp \
+    src/core/signal/DSPKernel.cpp \
+    src/core/signal/VectorMath.cpp \
+    src/core/signal/FFTPlan.cpp \
+    src/core/signal/PartitionedConvolver.cpp \
+    src/core/optimization/Quantizer.cpp \
+    src/core/security/SecurityManager.cpp \
+    -o testing/unit/bin/test_embedding_importer
+
+if [ $? -eq 0 ]; then
+    echo "Compilation success. Running tests..."
+    ./testing/unit/bin/test_embedding_importer
+else
+    echo "ERROR: Compilation failed for EmbeddingImporter tests."
+    exit 1
+fi
+
 echo ""
 echo "========================================"
 echo "Compiling SecurityManager tests..."
@@ -385,6 +718,9 @@ g++ -std=c++17 -Isrc/core \
     src/core/security/SecurityManager.cpp \
     src/core/optimization/Quantizer.cpp \
     src/core/signal/DSPKernel.cpp \
+    src/core/signal/VectorMath.cpp \
+    src/core/signal/FFTPlan.cpp \
+    src/core/signal/PartitionedConvolver.cpp \
     -o testing/unit/bin/test_encrypted_persistence
 
 if [ $? -eq 0 ]; then